@@ -30,6 +30,11 @@ namespace Simd
 {
     SIMD_INLINE size_t GetAlignment()
     {
+#ifdef SIMD_AVX512BF16_ENABLE
+        if (Avx512bf16::Enable)
+            return sizeof(__m512i);
+        else
+#endif
 #ifdef SIMD_AVX512VNNI_ENABLE
         if (Avx512vnni::Enable)
             return sizeof(__m512i);
@@ -2086,20 +2086,21 @@ namespace Simd
             ConvParam32f param(batch, conv, gemm);
             if (!param.Valid())
                 return NULL;
-            else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
-                return new SynetConvolution32fDepthwiseDotProduct(param);
-            else if (SynetConvolution32fWinograd::Preferable(param))
-                return new SynetConvolution32fWinograd(param);
-            else if (SynetConvolution32fGemmNT::Preferable(param))
-                return new SynetConvolution32fGemmNT(param);
-            else if (SynetConvolution32fDirectNchw::Preferable(param))
-                return new Avx::SynetConvolution32fDirectNchw(param);
-            else if (SynetConvolution32fNhwcDirect::Preferable(param))
-                return new SynetConvolution32fNhwcDirect(param);
-            else if (SynetConvolution32fDirectNhwc::Preferable(param))
-                return new SynetConvolution32fDirectNhwc(param);
-            else
-                return new SynetConvolution32fGemmNN(param);
+            Base::SynetConvolution32fCandidates candidates(param, "Avx");
+            if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+                candidates.Add<SynetConvolution32fDepthwiseDotProduct>("DepthwiseDotProduct");
+            if (SynetConvolution32fWinograd::Preferable(param))
+                candidates.Add<SynetConvolution32fWinograd>("Winograd");
+            if (SynetConvolution32fGemmNT::Preferable(param))
+                candidates.Add<SynetConvolution32fGemmNT>("GemmNT");
+            if (SynetConvolution32fDirectNchw::Preferable(param))
+                candidates.Add<Avx::SynetConvolution32fDirectNchw>("DirectNchw");
+            if (SynetConvolution32fNhwcDirect::Preferable(param))
+                candidates.Add<SynetConvolution32fNhwcDirect>("NhwcDirect");
+            if (SynetConvolution32fDirectNhwc::Preferable(param))
+                candidates.Add<SynetConvolution32fDirectNhwc>("DirectNhwc");
+            candidates.Add<SynetConvolution32fGemmNN>("GemmNN");
+            return candidates.Select();
         }
     }
 #endif//SIMD_AVX_ENABLE
@@ -0,0 +1,68 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void Float32ToBFloat16(const float * src, uint16_t * dst)
+        {
+            __m256i lo = Float32ToBFloat16(_mm256_loadu_ps(src + 0));
+            __m256i hi = Float32ToBFloat16(_mm256_loadu_ps(src + F));
+            _mm256_storeu_si256((__m256i*)dst, _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8));
+        }
+
+        void Float32ToBFloat16(const float * src, size_t size, uint16_t * dst)
+        {
+            size_t size16 = Simd::AlignLo(size, DF);
+            size_t i = 0;
+            for (; i < size16; i += DF)
+                Float32ToBFloat16(src + i, dst + i);
+            for (; i < size; ++i)
+                dst[i] = Base::Float32ToBFloat16(src[i]);
+        }
+
+        SIMD_INLINE void BFloat16ToFloat32(const uint16_t * src, float * dst)
+        {
+            __m256i _src = _mm256_loadu_si256((__m256i*)src);
+            _mm256_storeu_ps(dst + 0, BFloat16ToFloat32(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(_src))));
+            _mm256_storeu_ps(dst + F, BFloat16ToFloat32(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(_src, 1))));
+        }
+
+        void BFloat16ToFloat32(const uint16_t * src, size_t size, float * dst)
+        {
+            size_t size16 = Simd::AlignLo(size, DF);
+            size_t i = 0;
+            for (; i < size16; i += DF)
+                BFloat16ToFloat32(src + i, dst + i);
+            for (; i < size; ++i)
+                dst[i] = Base::BFloat16ToFloat32(src[i]);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
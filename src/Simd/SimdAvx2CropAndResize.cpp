@@ -0,0 +1,105 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdCropAndResize.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        static void CropResizeRowV(const uint8_t * src0, const uint8_t * src1, size_t size, int32_t alpha, uint16_t * dst)
+        {
+            int32_t alpha0 = Base::CROP_RESIZE_RANGE - alpha;
+            __m256i _alpha0 = _mm256_set1_epi16(int16_t(alpha0)), _alpha1 = _mm256_set1_epi16(int16_t(alpha));
+            size_t sizeA = AlignLo(size, HA), i = 0;
+            for (; i < sizeA; i += HA)
+            {
+                __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(src0 + i)));
+                __m256i s1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(src1 + i)));
+                _mm256_storeu_si256((__m256i*)(dst + i), _mm256_add_epi16(_mm256_mullo_epi16(s0, _alpha0), _mm256_mullo_epi16(s1, _alpha1)));
+            }
+            for (; i < size; ++i)
+                dst[i] = uint16_t(src0[i] * alpha0 + src1[i] * alpha);
+        }
+
+        static void CropResizeRowH(const uint16_t * src, const int32_t * index0, const int32_t * index1, const int32_t * alpha, size_t size, uint8_t * dst)
+        {
+            __m256i range = _mm256_set1_epi32(Base::CROP_RESIZE_RANGE), round = _mm256_set1_epi32(Base::CROP_RESIZE_ROUND), mask = _mm256_set1_epi32(0xFFFF);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+            {
+                __m256i a1 = _mm256_loadu_si256((__m256i*)(alpha + i)), a0 = _mm256_sub_epi32(range, a1);
+                __m256i s0 = _mm256_and_si256(_mm256_i32gather_epi32((int*)src, _mm256_loadu_si256((__m256i*)(index0 + i)), 2), mask);
+                __m256i s1 = _mm256_and_si256(_mm256_i32gather_epi32((int*)src, _mm256_loadu_si256((__m256i*)(index1 + i)), 2), mask);
+                __m256i d = _mm256_add_epi32(_mm256_add_epi32(_mm256_mullo_epi32(s0, a0), _mm256_mullo_epi32(s1, a1)), round);
+                d = _mm256_srli_epi32(d, 2 * Base::CROP_RESIZE_SHIFT);
+                d = _mm256_packus_epi16(_mm256_packus_epi32(d, K_ZERO), K_ZERO);
+                *(int32_t*)(dst + i + 0) = _mm_cvtsi128_si32(_mm256_castsi256_si128(d));
+                *(int32_t*)(dst + i + 4) = _mm_cvtsi128_si32(_mm256_extracti128_si256(d, 1));
+            }
+            for (; i < size; ++i)
+                dst[i] = uint8_t((src[index0[i]] * (Base::CROP_RESIZE_RANGE - alpha[i]) + src[index1[i]] * alpha[i] + Base::CROP_RESIZE_ROUND) >> (2 * Base::CROP_RESIZE_SHIFT));
+        }
+
+        static void CropResizeRowV(const float * src0, const float * src1, size_t size, float alpha, float * dst)
+        {
+            float alpha0 = 1.0f - alpha;
+            __m256 _alpha0 = _mm256_set1_ps(alpha0), _alpha1 = _mm256_set1_ps(alpha);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+                _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(src0 + i), _alpha0), _mm256_mul_ps(_mm256_loadu_ps(src1 + i), _alpha1)));
+            for (; i < size; ++i)
+                dst[i] = src0[i] * alpha0 + src1[i] * alpha;
+        }
+
+        static void CropResizeRowH(const float * src, const int32_t * index0, const int32_t * index1, const float * alpha, size_t size, float * dst)
+        {
+            __m256 one = _mm256_set1_ps(1.0f);
+            size_t sizeF = AlignLo(size, F), i = 0;
+            for (; i < sizeF; i += F)
+            {
+                __m256 a1 = _mm256_loadu_ps(alpha + i), a0 = _mm256_sub_ps(one, a1);
+                __m256 s0 = _mm256_i32gather_ps(src, _mm256_loadu_si256((__m256i*)(index0 + i)), 4);
+                __m256 s1 = _mm256_i32gather_ps(src, _mm256_loadu_si256((__m256i*)(index1 + i)), 4);
+                _mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_mul_ps(s0, a0), _mm256_mul_ps(s1, a1)));
+            }
+            for (; i < size; ++i)
+                dst[i] = src[index0[i]] * (1.0f - alpha[i]) + src[index1[i]] * alpha[i];
+        }
+
+        void CropAndResize(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, SimdResizeChannelType type,
+            const SimdResizeRoi * rois, size_t count, size_t dstWidth, size_t dstHeight, SimdResizeMethodType method)
+        {
+            if (method == SimdResizeMethodBilinear)
+                Base::CropAndResizeBilinear(src, srcWidth, srcHeight, srcStride, channels, type, rois, count, dstWidth, dstHeight,
+                    CropResizeRowV, CropResizeRowH, CropResizeRowV, CropResizeRowH);
+            else
+                Base::CropAndResize(src, srcWidth, srcHeight, srcStride, channels, type, rois, count, dstWidth, dstHeight, method);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -24,6 +24,7 @@
 #include "Simd/SimdMemory.h"
 #include "Simd/SimdStore.h"
 #include "Simd/SimdDetection.h"
+#include "Simd/SimdArray.h"
 #include "Simd/SimdBase.h"
 
 namespace Simd
@@ -34,6 +35,70 @@ namespace Simd
         using namespace Simd::Detection;
 
         const __m256i K32_PERMUTE = SIMD_MM256_SETR_EPI32(0, 2, 4, 6, 1, 3, 5, 7);
+        const __m256i K32_LANES = SIMD_MM256_SETR_EPI32(0, 1, 2, 3, 4, 5, 6, 7);
+
+        const int EARLY_STAGES = 6;
+
+        SIMD_INLINE size_t Lane(size_t offset, int i)
+        {
+            return offset + i;
+        }
+
+        SIMD_INLINE size_t Lane(__m256i offset, int i)
+        {
+            uint32_t SIMD_ALIGNED(32) buffer[8];
+            _mm256_store_si256((__m256i*)buffer, offset);
+            return buffer[i];
+        }
+
+        SIMD_INLINE __m256i TailMask(size_t col, size_t done)
+        {
+            return _mm256_cmpgt_epi32(_mm256_add_epi32(_mm256_set1_epi32((int)col), K32_LANES), _mm256_set1_epi32((int)done - 1));
+        }
+
+        SIMD_INLINE size_t PushSurvivors(__m256i result, size_t col, int32_t * cols, size_t count)
+        {
+            int bits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(result, _mm256_setzero_si256())));
+            for (int j = 0; bits; ++j, bits >>= 1)
+                if (bits & 1)
+                    cols[count++] = int32_t(col + j);
+            return count;
+        }
+
+        SIMD_INLINE size_t PushSurvivors(__m256i result, size_t col, const __m256 & norm, int32_t * cols, float * norms, size_t count)
+        {
+            int bits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(result, _mm256_setzero_si256())));
+            if (bits == 0)
+                return count;
+            float SIMD_ALIGNED(32) _norm[8];
+            _mm256_store_ps(_norm, norm);
+            for (int j = 0; bits; ++j, bits >>= 1)
+            {
+                if (bits & 1)
+                {
+                    cols[count] = int32_t(col + j);
+                    norms[count++] = _norm[j];
+                }
+            }
+            return count;
+        }
+
+        SIMD_INLINE __m256i LoadSurvivors(int32_t * cols, size_t count, size_t i, size_t base, __m256i & result)
+        {
+            size_t n = Simd::Min<size_t>(8, count - i);
+            for (size_t j = n; j < 8; ++j)
+                cols[i + j] = cols[i];
+            result = _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32((int)n), K32_LANES), K32_00000001);
+            return _mm256_add_epi32(_mm256_set1_epi32((int)base), _mm256_loadu_si256((__m256i*)(cols + i)));
+        }
+
+        SIMD_INLINE void StoreSurvivors(const int32_t * cols, size_t count, size_t i, __m256i result, uint32_t * dst)
+        {
+            uint32_t SIMD_ALIGNED(32) _result[8];
+            _mm256_store_si256((__m256i*)_result, result);
+            for (size_t j = 0, n = Simd::Min<size_t>(8, count - i); j < n; ++j)
+                dst[cols[i + j]] = _result[j];
+        }
 
         SIMD_INLINE void UnpackMask16i(const uint8_t * src, uint16_t * dst, const __m256i & mask)
         {
@@ -160,19 +225,32 @@ namespace Simd
             return _mm256_mul_ps(_mm256_cvtepi32_ps(sum), _mm256_broadcast_ss(&rect.weight));
         }
 
+        SIMD_INLINE __m256 WeightedSum32f(const WeightedRect & rect, __m256i offset)
+        {
+            __m256i s0 = _mm256_i32gather_epi32((int*)rect.p0, offset, 4);
+            __m256i s1 = _mm256_i32gather_epi32((int*)rect.p1, offset, 4);
+            __m256i s2 = _mm256_i32gather_epi32((int*)rect.p2, offset, 4);
+            __m256i s3 = _mm256_i32gather_epi32((int*)rect.p3, offset, 4);
+            __m256i sum = _mm256_sub_epi32(_mm256_sub_epi32(s0, s1), _mm256_sub_epi32(s2, s3));
+            return _mm256_mul_ps(_mm256_cvtepi32_ps(sum), _mm256_broadcast_ss(&rect.weight));
+        }
+
         SIMD_INLINE void StageSum32f(const float * leaves, float threshold, const __m256 & sum, const __m256 & norm, __m256 & stageSum)
         {
             __m256 mask = _mm256_cmp_ps(_mm256_mul_ps(_mm256_set1_ps(threshold), norm), sum, _CMP_GT_OQ);
             stageSum = _mm256_add_ps(stageSum, _mm256_blendv_ps(_mm256_broadcast_ss(leaves + 1), _mm256_broadcast_ss(leaves + 0), mask));
         }
 
-        void Detect32f(const HidHaarCascade & hid, size_t offset, const __m256 & norm, __m256i & result)
+        template<class Offset> void Detect32f(const HidHaarCascade & hid, Offset offset, const __m256 & norm, int startStage, int endStage, __m256i & result)
         {
             typedef HidHaarCascade Hid;
-            const float * leaves = hid.leaves.data();
-            const Hid::Node * node = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
-            for (int i = 0, n = (int)hid.stages.size(); i < n; ++i)
+            if (startStage >= endStage)
+                return;
+            const float * leaves = hid.leaves.data() + stages[startStage].first * 2;
+            const Hid::Node * node = hid.nodes.data() + stages[startStage].first;
+            bool last = endStage == (int)hid.stages.size();
+            for (int i = startStage; i < endStage; ++i)
             {
                 const Hid::Stage & stage = stages[i];
                 if (stage.canSkip)
@@ -203,7 +281,7 @@ namespace Simd
                 int resultCount = ResultCount(result);
                 if (resultCount == 0)
                     return;
-                else if (resultCount == 1)
+                else if (resultCount == 1 && last)
                 {
                     uint32_t SIMD_ALIGNED(32) _result[8];
                     float SIMD_ALIGNED(32) _norm[8];
@@ -213,7 +291,7 @@ namespace Simd
                     {
                         if (_result[j])
                         {
-                            _result[j] = Base::Detect32f(hid, offset + j, i + 1, _norm[j]) > 0 ? 1 : 0;
+                            _result[j] = Base::Detect32f(hid, Lane(offset, j), i + 1, _norm[j]) > 0 ? 1 : 0;
                             break;
                         }
                     }
@@ -228,11 +306,14 @@ namespace Simd
             size_t width = rect.Width();
             size_t alignedWidth = Simd::AlignLo(width, 8);
             size_t evenWidth = Simd::AlignLo(width, 2);
+            int early = Simd::Min(EARLY_STAGES, (int)hid.stages.size()), stages = (int)hid.stages.size();
 
             Buffer<uint32_t> buffer(width);
+            Array32i cols(width + 8);
+            Array32f norms(width + 8);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 1)
             {
-                size_t col = 0;
+                size_t col = 0, count = 0;
                 size_t p_offset = row * hid.sum.stride / sizeof(uint32_t) + rect.left;
                 size_t pq_offset = row * hid.sqsum.stride / sizeof(uint32_t) + rect.left;
 
@@ -244,21 +325,28 @@ namespace Simd
                     if (_mm256_testz_si256(result, K32_00000001))
                         continue;
                     __m256 norm = Norm32fp(hid, pq_offset + col);
-                    Detect32f(hid, p_offset + col, norm, result);
-                    _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
+                    Detect32f(hid, p_offset + col, norm, 0, early, result);
+                    count = PushSurvivors(result, col, norm, cols.data, norms.data, count);
                 }
                 if (evenWidth > alignedWidth + 2)
                 {
                     col = evenWidth - 8;
-                    __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
+                    __m256i result = _mm256_and_si256(_mm256_loadu_si256((__m256i*)(buffer.m + col)), TailMask(col, alignedWidth));
                     if (!_mm256_testz_si256(result, K32_00000001))
                     {
                         __m256 norm = Norm32fp(hid, pq_offset + col);
-                        Detect32f(hid, p_offset + col, norm, result);
-                        _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
+                        Detect32f(hid, p_offset + col, norm, 0, early, result);
+                        count = PushSurvivors(result, col, norm, cols.data, norms.data, count);
                     }
                     col += 8;
                 }
+                for (size_t i = 0; i < count; i += 8)
+                {
+                    __m256i result;
+                    __m256i offset = LoadSurvivors(cols.data, count, i, p_offset, result);
+                    Detect32f(hid, offset, _mm256_loadu_ps(norms.data + i), early, stages, result);
+                    StoreSurvivors(cols.data, count, i, result, buffer.d);
+                }
                 for (; col < width; col += 1)
                 {
                     if (buffer.m[col] == 0)
@@ -302,7 +390,7 @@ namespace Simd
                     if (_mm256_testz_si256(result, K32_00000001))
                         continue;
                     __m256 norm = Norm32fi(hid, pq_offset + col);
-                    Detect32f(hid, p_offset + col / 2, norm, result);
+                    Detect32f(hid, p_offset + col / 2, norm, 0, (int)hid.stages.size(), result);
                     _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
                 }
                 if (evenWidth > alignedWidth)
@@ -312,7 +400,7 @@ namespace Simd
                     if (!_mm256_testz_si256(result, K32_00000001))
                     {
                         __m256 norm = Norm32fi(hid, pq_offset + col);
-                        Detect32f(hid, p_offset + col / 2, norm, result);
+                        Detect32f(hid, p_offset + col / 2, norm, 0, (int)hid.stages.size(), result);
                         _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
                     }
                     col += HA;
@@ -353,12 +441,17 @@ namespace Simd
             return _mm256_cmpeq_epi32(_mm256_max_epu32(a, b), a);
         }
 
-        template<int i> SIMD_INLINE void Load(__m256i a[16], const HidLbpFeature<uint32_t> & feature, ptrdiff_t offset)
+        template<int i> SIMD_INLINE void Load(__m256i a[16], const HidLbpFeature<uint32_t> & feature, size_t offset)
         {
             a[i] = _mm256_loadu_si256((__m256i*)(feature.p[i] + offset));
         }
 
-        SIMD_INLINE void Calculate(const HidLbpFeature<uint32_t> & feature, ptrdiff_t offset, __m256i & index, __m256i & shuffle, __m256i & mask)
+        template<int i> SIMD_INLINE void Load(__m256i a[16], const HidLbpFeature<uint32_t> & feature, __m256i offset)
+        {
+            a[i] = _mm256_i32gather_epi32((int*)feature.p[i], offset, 4);
+        }
+
+        template<class Offset> SIMD_INLINE void Calculate(const HidLbpFeature<uint32_t> & feature, Offset offset, __m256i & index, __m256i & shuffle, __m256i & mask)
         {
             __m256i a[16];
             Load<5>(a, feature, offset);
@@ -394,7 +487,7 @@ namespace Simd
             mask = _mm256_shuffle_epi8(K8_SHUFFLE_BITS, mask);
         }
 
-        SIMD_INLINE __m256i LeafMask(const HidLbpFeature<uint32_t> & feature, ptrdiff_t offset, const int * subset)
+        template<class Offset> SIMD_INLINE __m256i LeafMask(const HidLbpFeature<uint32_t> & feature, Offset offset, const int * subset)
         {
             __m256i index, shuffle, mask;
             Calculate(feature, offset, index, shuffle, mask);
@@ -410,7 +503,7 @@ namespace Simd
             return _mm256_andnot_si256(_mm256_cmpeq_epi32(value, _mm256_setzero_si256()), K_INV_ZERO);
         }
 
-        void Detect(const HidLbpCascade<float, uint32_t> & hid, size_t offset, int startStage, __m256i & result)
+        template<class Offset> void Detect(const HidLbpCascade<float, uint32_t> & hid, Offset offset, int startStage, int endStage, __m256i & result)
         {
             typedef HidLbpCascade<float, uint32_t> Hid;
 
@@ -419,9 +512,12 @@ namespace Simd
             const Hid::Leave * leaves = hid.leaves.data();
             const Hid::Node * nodes = hid.nodes.data();
             const Hid::Stage * stages = hid.stages.data();
+            if (startStage >= endStage)
+                return;
             int nodeOffset = stages[startStage].first;
             int leafOffset = 2 * nodeOffset;
-            for (int i_stage = startStage, n_stages = (int)hid.stages.size(); i_stage < n_stages; i_stage++)
+            bool last = endStage == (int)hid.stages.size();
+            for (int i_stage = startStage; i_stage < endStage; i_stage++)
             {
                 const Hid::Stage & stage = stages[i_stage];
                 __m256 sum = _mm256_setzero_ps();
@@ -438,7 +534,7 @@ namespace Simd
                 int resultCount = ResultCount(result);
                 if (resultCount == 0)
                     return;
-                else if (resultCount == 1)
+                else if (resultCount == 1 && last)
                 {
                     uint32_t SIMD_ALIGNED(32) _result[8];
                     _mm256_store_si256((__m256i*)_result, result);
@@ -446,7 +542,7 @@ namespace Simd
                     {
                         if (_result[i])
                         {
-                            _result[i] = Base::Detect(hid, offset + i, i_stage + 1) > 0 ? 1 : 0;
+                            _result[i] = Base::Detect(hid, Lane(offset, i), i_stage + 1) > 0 ? 1 : 0;
                             break;
                         }
                     }
@@ -461,11 +557,13 @@ namespace Simd
             size_t width = rect.Width();
             size_t alignedWidth = Simd::AlignLo(width, 8);
             size_t evenWidth = Simd::AlignLo(width, 2);
+            int early = Simd::Min(EARLY_STAGES, (int)hid.stages.size()), stages = (int)hid.stages.size();
 
             Buffer<uint32_t> buffer(width);
+            Array32i cols(width + 8);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 1)
             {
-                size_t col = 0;
+                size_t col = 0, count = 0;
                 size_t offset = row * hid.sum.stride / sizeof(uint32_t) + rect.left;
 
                 UnpackMask32i(mask.data + row*mask.stride + rect.left, width, buffer.m, K8_01);
@@ -475,20 +573,27 @@ namespace Simd
                     __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
                     if (_mm256_testz_si256(result, K32_00000001))
                         continue;
-                    Detect(hid, offset + col, 0, result);
-                    _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
+                    Detect(hid, offset + col, 0, early, result);
+                    count = PushSurvivors(result, col, cols.data, count);
                 }
                 if (evenWidth > alignedWidth + 2)
                 {
                     col = evenWidth - 8;
-                    __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
+                    __m256i result = _mm256_and_si256(_mm256_loadu_si256((__m256i*)(buffer.m + col)), TailMask(col, alignedWidth));
                     if (!_mm256_testz_si256(result, K32_00000001))
                     {
-                        Detect(hid, offset + col, 0, result);
-                        _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
+                        Detect(hid, offset + col, 0, early, result);
+                        count = PushSurvivors(result, col, cols.data, count);
                     }
                     col += 8;
                 }
+                for (size_t i = 0; i < count; i += 8)
+                {
+                    __m256i result;
+                    __m256i offsets = LoadSurvivors(cols.data, count, i, offset, result);
+                    Detect(hid, offsets, early, stages, result);
+                    StoreSurvivors(cols.data, count, i, result, buffer.d);
+                }
                 for (; col < width; col += 1)
                 {
                     if (buffer.m[col] == 0)
@@ -529,7 +634,7 @@ namespace Simd
                     __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
                     if (_mm256_testz_si256(result, K32_00000001))
                         continue;
-                    Detect(hid, offset + col / 2, 0, result);
+                    Detect(hid, offset + col / 2, 0, (int)hid.stages.size(), result);
                     _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
                 }
                 if (evenWidth > alignedWidth)
@@ -538,7 +643,7 @@ namespace Simd
                     __m256i result = _mm256_loadu_si256((__m256i*)(buffer.m + col));
                     if (!_mm256_testz_si256(result, K32_00000001))
                     {
-                        Detect(hid, offset + col / 2, 0, result);
+                        Detect(hid, offset + col / 2, 0, (int)hid.stages.size(), result);
                         _mm256_storeu_si256((__m256i*)(buffer.d + col), result);
                     }
                     col += HA;
@@ -0,0 +1,194 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistances.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<class T> struct DotTraits;
+
+        template<> struct DotTraits<float>
+        {
+            typedef __m256 Vec;
+            static const size_t Step = 8;
+
+            static SIMD_INLINE Vec Zero() { return _mm256_setzero_ps(); }
+            static SIMD_INLINE Vec Load(const float * p) { return _mm256_loadu_ps(p); }
+            static SIMD_INLINE Vec Tail(size_t tail) { return RightNotZero32f(tail); }
+            static SIMD_INLINE Vec And(Vec a, Vec mask) { return _mm256_and_ps(a, mask); }
+            static SIMD_INLINE void Madd(Vec a, Vec b, Vec & sum) { sum = _mm256_fmadd_ps(a, b, sum); }
+            static SIMD_INLINE float Sum(Vec sum) { return Avx::ExtractSum(sum); }
+            static SIMD_INLINE __m128 Sums(const Vec * sums) { return Avx::Extract4Sums(sums); }
+        };
+
+        template<> struct DotTraits<uint16_t> : public DotTraits<float>
+        {
+            static SIMD_INLINE Vec Load(const uint16_t * p) { return _mm256_cvtph_ps(_mm_loadu_si128((__m128i*)p)); }
+        };
+
+        template<> struct DotTraits<int8_t>
+        {
+            typedef __m256i Vec;
+            static const size_t Step = 16;
+
+            static SIMD_INLINE Vec Zero() { return _mm256_setzero_si256(); }
+            static SIMD_INLINE Vec Load(const int8_t * p) { return _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i*)p)); }
+            static SIMD_INLINE Vec Tail(size_t tail) 
+            { 
+                const int16_t mask[32] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 };
+                return _mm256_loadu_si256((__m256i*)(mask + tail));
+            }
+            static SIMD_INLINE Vec And(Vec a, Vec mask) { return _mm256_and_si256(a, mask); }
+            static SIMD_INLINE void Madd(Vec a, Vec b, Vec & sum) { sum = _mm256_add_epi32(sum, _mm256_madd_epi16(a, b)); }
+            static SIMD_INLINE float Sum(Vec sum) { return float(ExtractSum<int32_t>(sum)); }
+            static SIMD_INLINE __m128 Sums(const Vec * sums) 
+            { 
+                __m256i sum = _mm256_hadd_epi32(_mm256_hadd_epi32(sums[0], sums[1]), _mm256_hadd_epi32(sums[2], sums[3]));
+                return _mm_cvtepi32_ps(_mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1)));
+            }
+        };
+
+        template<class T, size_t M> SIMD_INLINE void MicroDots4(size_t K, const void * const * A, const void * const * B, float * dots, size_t stride)
+        {
+            typedef DotTraits<T> D;
+            typedef typename D::Vec Vec;
+            const T * a[M], * b[4];
+            Vec va[M], sums[M][4];
+            for (size_t i = 0; i < M; ++i)
+            {
+                a[i] = (const T*)A[i];
+                for (size_t j = 0; j < 4; ++j)
+                    sums[i][j] = D::Zero();
+            }
+            for (size_t j = 0; j < 4; ++j)
+                b[j] = (const T*)B[j];
+            size_t KS = AlignLo(K, D::Step);
+            for (size_t k = 0; k < KS; k += D::Step)
+            {
+                for (size_t i = 0; i < M; ++i)
+                    va[i] = D::Load(a[i] + k);
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    Vec vb = D::Load(b[j] + k);
+                    for (size_t i = 0; i < M; ++i)
+                        D::Madd(va[i], vb, sums[i][j]);
+                }
+            }
+            if (KS < K)
+            {
+                size_t k = K - D::Step;
+                Vec tail = D::Tail(K - KS);
+                for (size_t i = 0; i < M; ++i)
+                    va[i] = D::And(D::Load(a[i] + k), tail);
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    Vec vb = D::Load(b[j] + k);
+                    for (size_t i = 0; i < M; ++i)
+                        D::Madd(va[i], vb, sums[i][j]);
+                }
+            }
+            for (size_t i = 0; i < M; ++i)
+                _mm_storeu_ps(dots + i * stride, D::Sums(sums[i]));
+        }
+
+        template<class T, size_t M> SIMD_INLINE void MicroDots1(size_t K, const void * const * A, const void * B, float * dots, size_t stride)
+        {
+            typedef DotTraits<T> D;
+            typedef typename D::Vec Vec;
+            const T * a[M], * b = (const T*)B;
+            Vec sums[M];
+            for (size_t i = 0; i < M; ++i)
+            {
+                a[i] = (const T*)A[i];
+                sums[i] = D::Zero();
+            }
+            size_t KS = AlignLo(K, D::Step);
+            for (size_t k = 0; k < KS; k += D::Step)
+            {
+                Vec vb = D::Load(b + k);
+                for (size_t i = 0; i < M; ++i)
+                    D::Madd(D::Load(a[i] + k), vb, sums[i]);
+            }
+            if (KS < K)
+            {
+                size_t k = K - D::Step;
+                Vec tail = D::Tail(K - KS), vb = D::Load(b + k);
+                for (size_t i = 0; i < M; ++i)
+                    D::Madd(D::And(D::Load(a[i] + k), tail), vb, sums[i]);
+            }
+            for (size_t i = 0; i < M; ++i)
+                dots[i * stride] = D::Sum(sums[i]);
+        }
+
+        template<class T, size_t M> SIMD_INLINE void RowDots(size_t N, size_t K, const void * const * A, const void * const * B, float * dots, size_t stride)
+        {
+            size_t N4 = AlignLo(N, 4), j = 0;
+            for (; j < N4; j += 4)
+                MicroDots4<T, M>(K, A, B + j, dots + j, stride);
+            for (; j < N; j += 1)
+                MicroDots1<T, M>(K, A, B[j], dots + j, stride);
+        }
+
+        template<class T> void Dots(size_t M, size_t N, size_t K, const void * const * A, const void * const * B, float * dots, size_t stride)
+        {
+            size_t M3 = AlignLoAny(M, 3), i = 0;
+            for (; i < M3; i += 3)
+                RowDots<T, 3>(N, K, A + i, B, dots + i * stride, stride);
+            if (M - M3 == 2)
+                RowDots<T, 2>(N, K, A + i, B, dots + i * stride, stride);
+            else if (M - M3 == 1)
+                RowDots<T, 1>(N, K, A + i, B, dots + i * stride, stride);
+        }
+
+        void * DistancesInit(size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance, const void * const * B, const float * bScales)
+        {
+            DistancesParam param(N, K, type, distance);
+            if (!param.Valid() || B == NULL)
+                return NULL;
+            switch (type)
+            {
+            case SimdTensorData32f:
+                if (K >= DotTraits<float>::Step)
+                    return new Base::Distances(param, B, bScales, Dots<float>, 3, 4);
+                break;
+            case SimdTensorData16f:
+                if (K >= DotTraits<uint16_t>::Step)
+                    return new Base::Distances(param, B, bScales, Dots<uint16_t>, 3, 4);
+                break;
+            case SimdTensorData8i:
+                if (K >= DotTraits<int8_t>::Step)
+                    return new Base::Distances(param, B, bScales, Dots<int8_t>, 3, 4);
+                break;
+            default:
+                break;
+            }
+            return Base::DistancesInit(N, K, type, distance, B, bScales);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
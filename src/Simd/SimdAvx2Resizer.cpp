@@ -638,6 +638,150 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Base::ResizerByteFilter(param)
+        {
+            size_t ky2 = AlignHi(_ky, 2);
+            _ayp.Resize(_param.dstH * ky2, true);
+            for (size_t dy = 0; dy < _param.dstH; ++dy)
+                for (size_t k = 0; k < _ky; ++k)
+                    _ayp[dy * ky2 + k] = (int16_t)_ay[dy * _ky + k];
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowV16(const uint8_t * src, size_t srcStride, const int32_t * ay, size_t ky, int32_t * dst)
+        {
+            __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256();
+            size_t k = 0;
+            for (; k + 1 < ky; k += 2, src += 2 * srcStride)
+            {
+                __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+                __m256i s1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(src + srcStride)));
+                __m256i a = _mm256_set1_epi32(ay[k / 2]);
+                lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, s1), a));
+                hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, s1), a));
+            }
+            if (k < ky)
+            {
+                __m256i s0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)src));
+                __m256i a = _mm256_set1_epi32(ay[k / 2]);
+                lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(s0, K_ZERO), a));
+                hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(s0, K_ZERO), a));
+            }
+            __m256i round = _mm256_set1_epi32(Base::FILTER_V_ROUND);
+            lo = _mm256_srai_epi32(_mm256_add_epi32(lo, round), Base::FILTER_V_SHIFT);
+            hi = _mm256_srai_epi32(_mm256_add_epi32(hi, round), Base::FILTER_V_SHIFT);
+            _mm256_storeu_si256((__m256i*)dst + 0, _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256((__m256i*)dst + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+
+        void ResizerByteFilter::RunV(const uint8_t * src, size_t srcStride, size_t dy, int32_t * dst)
+        {
+            size_t size = _param.srcW * _param.channels;
+            if (size < HA)
+            {
+                Base::ResizerByteFilter::RunV(src, srcStride, dy, dst);
+                return;
+            }
+            size_t sizeHA = AlignLo(size, HA);
+            const int32_t * ay = (const int32_t*)(_ayp.data + dy * AlignHi(_ky, 2));
+            for (size_t x = 0; x < sizeHA; x += HA)
+                ResizerByteFilterRowV16(src + x, srcStride, ay, _ky, dst + x);
+            if (sizeHA < size)
+                ResizerByteFilterRowV16(src + size - HA, srcStride, ay, _ky, dst + size - HA);
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowH8(const int32_t * src, const int32_t * ix, const int32_t * ax, size_t kx, size_t cn, size_t rs, uint8_t * dst)
+        {
+            __m256i idx = _mm256_loadu_si256((__m256i*)ix);
+            __m256i step = _mm256_set1_epi32((int32_t)cn);
+            __m256i sum = _mm256_setzero_si256();
+            for (size_t k = 0; k < kx; ++k, ax += rs)
+            {
+                __m256i s = _mm256_i32gather_epi32(src, idx, 4);
+                sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(s, _mm256_loadu_si256((__m256i*)ax)));
+                idx = _mm256_add_epi32(idx, step);
+            }
+            sum = _mm256_srai_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(Base::FILTER_H_ROUND)), Base::FILTER_H_SHIFT);
+            __m128i s16 = _mm_packs_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(s16, s16));
+        }
+
+        void ResizerByteFilter::RunH(const int32_t * src, uint8_t * dst)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn;
+            if (rs < F)
+            {
+                Base::ResizerByteFilter::RunH(src, dst);
+                return;
+            }
+            size_t rsF = AlignLo(rs, F);
+            for (size_t dx = 0; dx < rsF; dx += F)
+                ResizerByteFilterRowH8(src, _ix.data + dx, _ax.data + dx, _kx, cn, rs, dst + dx);
+            if (rsF < rs)
+                ResizerByteFilterRowH8(src, _ix.data + rs - F, _ax.data + rs - F, _kx, cn, rs, dst + rs - F);
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Base::ResizerFloatFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerFloatFilterRowV8(const float * src, size_t srcStride, const float * ay, size_t ky, float * dst)
+        {
+            __m256 sum = _mm256_mul_ps(_mm256_loadu_ps(src), _mm256_set1_ps(ay[0]));
+            for (size_t k = 1; k < ky; ++k)
+                sum = _mm256_fmadd_ps(_mm256_loadu_ps(src + k * srcStride), _mm256_set1_ps(ay[k]), sum);
+            _mm256_storeu_ps(dst, sum);
+        }
+
+        void ResizerFloatFilter::RunV(const float * src, size_t srcStride, size_t dy, float * dst)
+        {
+            size_t size = _param.srcW * _param.channels;
+            if (size < F)
+            {
+                Base::ResizerFloatFilter::RunV(src, srcStride, dy, dst);
+                return;
+            }
+            size_t sizeF = AlignLo(size, F);
+            const float * ay = _ay.data + dy * _ky;
+            for (size_t x = 0; x < sizeF; x += F)
+                ResizerFloatFilterRowV8(src + x, srcStride, ay, _ky, dst + x);
+            if (sizeF < size)
+                ResizerFloatFilterRowV8(src + size - F, srcStride, ay, _ky, dst + size - F);
+        }
+
+        SIMD_INLINE void ResizerFloatFilterRowH8(const float * src, const int32_t * ix, const float * ax, size_t kx, size_t cn, size_t rs, float * dst)
+        {
+            __m256i idx = _mm256_loadu_si256((__m256i*)ix);
+            __m256i step = _mm256_set1_epi32((int32_t)cn);
+            __m256 sum = _mm256_setzero_ps();
+            for (size_t k = 0; k < kx; ++k, ax += rs)
+            {
+                sum = _mm256_fmadd_ps(_mm256_i32gather_ps(src, idx, 4), _mm256_loadu_ps(ax), sum);
+                idx = _mm256_add_epi32(idx, step);
+            }
+            _mm256_storeu_ps(dst, sum);
+        }
+
+        void ResizerFloatFilter::RunH(const float * src, float * dst)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn;
+            if (rs < F)
+            {
+                Base::ResizerFloatFilter::RunH(src, dst);
+                return;
+            }
+            size_t rsF = AlignLo(rs, F);
+            for (size_t dx = 0; dx < rsF; dx += F)
+                ResizerFloatFilterRowH8(src, _ix.data + dx, _ax.data + dx, _kx, cn, rs, dst + dx);
+            if (rsF < rs)
+                ResizerFloatFilterRowH8(src, _ix.data + rs - F, _ax.data + rs - F, _kx, cn, rs, dst + rs - F);
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m256i));
@@ -647,6 +791,10 @@ namespace Simd
                 return new ResizerByteArea(param);
             else if (param.IsFloatBilinear())
                 return new ResizerFloatBilinear(param);
+            else if (param.IsByteFilter())
+                return new ResizerByteFilter(param);
+            else if (param.IsFloatFilter())
+                return new ResizerFloatFilter(param);
             else
                 return Avx::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
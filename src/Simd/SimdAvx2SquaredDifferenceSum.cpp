@@ -25,6 +25,7 @@
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdSet.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -130,6 +131,54 @@ namespace Simd
             else
                 SquaredDifferenceSumMasked<false>(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
         }
+
+        SIMD_INLINE void SquaredDifferenceSums16(const uint8_t * a, const uint8_t * b, size_t bStride, size_t count, uint64_t * sums)
+        {
+            const __m256i _a = _mm256_broadcastsi128_si256(_mm_loadu_si128((__m128i*)a));
+            size_t count2 = AlignLo(count, 2), i = 0;
+            for (; i < count2; i += 2, b += 2 * bStride)
+            {
+                __m256i _b = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((__m128i*)b)), _mm_loadu_si128((__m128i*)(b + bStride)), 1);
+                __m256i sum = SquaredDifference(_a, _b);
+                sum = _mm256_hadd_epi32(sum, sum);
+                sum = _mm256_hadd_epi32(sum, sum);
+                sums[i + 0] = (uint32_t)_mm256_extract_epi32(sum, 0);
+                sums[i + 1] = (uint32_t)_mm256_extract_epi32(sum, 4);
+            }
+            if (i < count)
+                Base::SquaredDifferenceSums(a, b, bStride, 16, count - i, sums + i);
+        }
+
+        void SquaredDifferenceSums(const uint8_t * a, const uint8_t * b, size_t bStride, size_t size, size_t count, uint64_t * sums)
+        {
+            assert(size < 0x10000);
+
+            if (size == 16)
+            {
+                SquaredDifferenceSums16(a, b, bStride, count, sums);
+                return;
+            }
+            if (size < A)
+            {
+                Base::SquaredDifferenceSums(a, b, bStride, size, count, sums);
+                return;
+            }
+            size_t bodySize = AlignLo(size, A);
+            __m256i tailMask = SetMask<uint8_t>(0, A - size + bodySize, 0xFF);
+            for (size_t i = 0; i < count; ++i, b += bStride)
+            {
+                __m256i sum = _mm256_setzero_si256();
+                for (size_t j = 0; j < bodySize; j += A)
+                    sum = _mm256_add_epi32(sum, SquaredDifference(_mm256_loadu_si256((__m256i*)(a + j)), _mm256_loadu_si256((__m256i*)(b + j))));
+                if (size - bodySize)
+                {
+                    const __m256i _a = _mm256_and_si256(tailMask, _mm256_loadu_si256((__m256i*)(a + size - A)));
+                    const __m256i _b = _mm256_and_si256(tailMask, _mm256_loadu_si256((__m256i*)(b + size - A)));
+                    sum = _mm256_add_epi32(sum, SquaredDifference(_a, _b));
+                }
+                sums[i] = ExtractSum<uint32_t>(sum);
+            }
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
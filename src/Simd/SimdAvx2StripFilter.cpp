@@ -0,0 +1,82 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStripFilter.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void * StripFilterInit(size_t width, size_t height, size_t channels, SimdStripFilterType type, const float * radius)
+        {
+            StripFilterParam param(width, height, channels, type, radius, A);
+            if (!param.Valid())
+                return NULL;
+            switch (type)
+            {
+            case SimdStripFilterGaussianBlur3x3:
+                if ((width - 1) * channels >= A)
+                    return new Base::StripFilter(param, GaussianBlur3x3);
+                break;
+            case SimdStripFilterMedianSquare3x3:
+                if ((width - 1) * channels >= A)
+                    return new Base::StripFilter(param, MedianFilterSquare3x3);
+                break;
+            case SimdStripFilterMedianSquare5x5:
+                if ((width - 2) * channels >= A)
+                    return new Base::StripFilter(param, MedianFilterSquare5x5);
+                break;
+            case SimdStripFilterSobelDx:
+                if (width > A)
+                    return new Base::StripFilter(param, Base::StripFilterGray<SobelDx>);
+                break;
+            case SimdStripFilterSobelDxAbs:
+                if (width > A)
+                    return new Base::StripFilter(param, Base::StripFilterGray<SobelDxAbs>);
+                break;
+            case SimdStripFilterSobelDy:
+                if (width > A)
+                    return new Base::StripFilter(param, Base::StripFilterGray<SobelDy>);
+                break;
+            case SimdStripFilterSobelDyAbs:
+                if (width > A)
+                    return new Base::StripFilter(param, Base::StripFilterGray<SobelDyAbs>);
+                break;
+            case SimdStripFilterLaplace:
+                if (width > A)
+                    return new Base::StripFilter(param, Base::StripFilterGray<Laplace>);
+                break;
+            case SimdStripFilterLaplaceAbs:
+                if (width > A)
+                    return new Base::StripFilter(param, Base::StripFilterGray<LaplaceAbs>);
+                break;
+            default:
+                break;
+            }
+            return Base::StripFilterInit(width, height, channels, type, radius);
+        }
+    }
+#endif //SIMD_AVX2_ENABLE
+}
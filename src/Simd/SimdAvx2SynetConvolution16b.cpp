@@ -0,0 +1,124 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution16b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template<size_t M> SIMD_INLINE void Gemm16bMx16(const uint16_t * src, size_t K, size_t srcStride, const uint16_t * weight, float * dst, size_t dstStride, size_t tail)
+        {
+            __m256 d0[M], d1[M];
+            for (size_t i = 0; i < M; ++i)
+            {
+                d0[i] = _mm256_setzero_ps();
+                d1[i] = _mm256_setzero_ps();
+            }
+            for (size_t k = 0; k < K; k += 2, weight += 2 * DF)
+            {
+                __m256i w0 = _mm256_loadu_si256((__m256i*)weight + 0);
+                __m256i w1 = _mm256_loadu_si256((__m256i*)weight + 1);
+                __m256 w0e = BFloat16EvenToFloat32(w0), w0o = BFloat16OddToFloat32(w0);
+                __m256 w1e = BFloat16EvenToFloat32(w1), w1o = BFloat16OddToFloat32(w1);
+                for (size_t i = 0; i < M; ++i)
+                {
+                    __m256i s = _mm256_set1_epi32(*(int32_t*)(src + i * srcStride + k));
+                    __m256 se = BFloat16EvenToFloat32(s), so = BFloat16OddToFloat32(s);
+                    d0[i] = _mm256_fmadd_ps(se, w0e, d0[i]);
+                    d1[i] = _mm256_fmadd_ps(se, w1e, d1[i]);
+                    d0[i] = _mm256_fmadd_ps(so, w0o, d0[i]);
+                    d1[i] = _mm256_fmadd_ps(so, w1o, d1[i]);
+                }
+            }
+            if (tail == DF)
+            {
+                for (size_t i = 0; i < M; ++i, dst += dstStride)
+                {
+                    _mm256_storeu_ps(dst + 0, d0[i]);
+                    _mm256_storeu_ps(dst + F, d1[i]);
+                }
+            }
+            else
+            {
+                float buf[DF];
+                for (size_t i = 0; i < M; ++i, dst += dstStride)
+                {
+                    _mm256_storeu_ps(buf + 0, d0[i]);
+                    _mm256_storeu_ps(buf + F, d1[i]);
+                    for (size_t j = 0; j < tail; ++j)
+                        dst[j] = buf[j];
+                }
+            }
+        }
+
+        typedef void(*Gemm16bMx16Ptr)(const uint16_t * src, size_t K, size_t srcStride, const uint16_t * weight, float * dst, size_t dstStride, size_t tail);
+
+        static void Gemm16b(const uint16_t * src, size_t M, size_t K, size_t srcStride, const uint16_t * weight, size_t D, float * dst, size_t dstStride)
+        {
+            assert(K % 2 == 0);
+            const size_t M4 = AlignLoAny(M, 4);
+            Gemm16bMx16Ptr gemmTail = NULL;
+            switch (M - M4)
+            {
+            case 1: gemmTail = Gemm16bMx16<1>; break;
+            case 2: gemmTail = Gemm16bMx16<2>; break;
+            case 3: gemmTail = Gemm16bMx16<3>; break;
+            }
+            for (size_t d = 0; d < D; d += DF)
+            {
+                size_t tail = Simd::Min(DF, D - d);
+                const uint16_t * w = weight + d * K;
+                size_t i = 0;
+                for (; i < M4; i += 4)
+                    Gemm16bMx16<4>(src + i * srcStride, K, srcStride, w, dst + i * dstStride + d, dstStride, tail);
+                if (gemmTail)
+                    gemmTail(src + i * srcStride, K, srcStride, w, dst + i * dstStride + d, dstStride, tail);
+            }
+        }
+
+        SynetConvolution16bNhwcGemm::SynetConvolution16bNhwcGemm(const ConvParam16b & p)
+            : Base::SynetConvolution16bNhwcGemm(p)
+        {
+            _gemm = Gemm16b;
+            _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
+            _toBFloat16 = Avx2::Float32ToBFloat16;
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters * conv)
+        {
+            ConvParam16b param(batch, conv);
+            if (!param.Valid())
+                return NULL;
+            return new SynetConvolution16bNhwcGemm(param);
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
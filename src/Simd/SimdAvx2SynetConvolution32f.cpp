@@ -130,6 +130,34 @@ namespace Simd
         SynetConvolution32fGemmNN::SynetConvolution32fGemmNN(const ConvParam32f & p)
             : Avx::SynetConvolution32fGemmNN(p)
         {
+            SetEdges();
+            _gemm.Init(InitGemmFuncs(Avx2::Gemm32fNN, "Avx2", p.gemm, "Ext"));
+            if (_param.trans && _param.group == 1)
+            {
+                if (GemmRuntime())
+                {
+                    _gemmCb.Init(InitGemmCbFuncs(Avx2::Gemm32fNNcbBufferSize, Avx2::Gemm32fNNcbReorderB, Avx2::Gemm32fNNcbRun, "Avx2", GemmKernelF2, GemmKernelF3));
+                    _nhwcWeight.Resize(_gemmCb.At(0).BufferSize(_M*_merge, _N, _K));
+                }
+                else
+                    _nhwcWeight.Resize(Avx2::Gemm32fNNcbBufferSize(_M*_merge, _N, _K, GemmKernelAny, NHWC_GEMM_COMPATIBLE));
+                _nhwcRun = Avx2::Gemm32fNNcbRun;
+                _nhwcReorderB = Avx2::Gemm32fNNcbReorderB;
+            }
+            _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
+        }
+
+        bool SynetConvolution32fGemmNN::Reshape(size_t srcH, size_t srcW)
+        {
+            if (!Avx::SynetConvolution32fGemmNN::Reshape(srcH, srcW))
+                return false;
+            SetEdges();
+            return true;
+        }
+
+        void SynetConvolution32fGemmNN::SetEdges()
+        {
+            const ConvParam32f & p = _param;
             _index.Resize(F);
             for (size_t i = 0; i < F; ++i)
                 _index[i] = int(i * p.strideX);
@@ -151,20 +179,6 @@ namespace Simd
                 }
                 _start[kx] = int(kx * p.dilationX - p.padX + _nose[kx] * p.strideX);
             }
-            _gemm.Init(InitGemmFuncs(Avx2::Gemm32fNN, "Avx2", p.gemm, "Ext"));
-            if (_param.trans && _param.group == 1)
-            {
-                if (GemmRuntime())
-                {
-                    _gemmCb.Init(InitGemmCbFuncs(Avx2::Gemm32fNNcbBufferSize, Avx2::Gemm32fNNcbReorderB, Avx2::Gemm32fNNcbRun, "Avx2", GemmKernelF2, GemmKernelF3));
-                    _nhwcWeight.Resize(_gemmCb.At(0).BufferSize(_M*_merge, _N, _K));
-                }
-                else
-                    _nhwcWeight.Resize(Avx2::Gemm32fNNcbBufferSize(_M*_merge, _N, _K, GemmKernelAny, NHWC_GEMM_COMPATIBLE));
-                _nhwcRun = Avx2::Gemm32fNNcbRun;
-                _nhwcReorderB = Avx2::Gemm32fNNcbReorderB;
-            }
-            _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
         }
 
         void SynetConvolution32fGemmNN::ImgToCol(const float * src, float * dst)
@@ -1653,20 +1667,23 @@ namespace Simd
             ConvParam32f param(batch, conv, gemm);
             if (!param.Valid())
                 return NULL;
-            else if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
-                return new Avx::SynetConvolution32fDepthwiseDotProduct(param);
-            else if (SynetConvolution32fWinograd::Preferable(param))
-                return new SynetConvolution32fWinograd(param);
-            else if (SynetConvolution32fGemmNT::Preferable(param))
-                return new SynetConvolution32fGemmNT(param);
-            else if (SynetConvolution32fDirectNchw::Preferable(param))
-                return new Avx2::SynetConvolution32fDirectNchw(param);
-            else if (SynetConvolution32fNhwcDirect::Preferable(param))
-                return new SynetConvolution32fNhwcDirect(param);
-            else if (SynetConvolution32fDirectNhwc::Preferable(param))
-                return new SynetConvolution32fDirectNhwc(param);
-            else
-                return new SynetConvolution32fGemmNN(param);
+            Base::SynetConvolution32fCandidates candidates(param, "Avx2");
+            if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+                candidates.Add<Avx::SynetConvolution32fDepthwiseDotProduct>("DepthwiseDotProduct");
+            if (SynetConvolution32fWinograd::Preferable(param))
+                candidates.Add<SynetConvolution32fWinograd>("Winograd");
+            if (SynetConvolution32fGemmNT::Preferable(param))
+                candidates.Add<SynetConvolution32fGemmNT>("GemmNT");
+            if (SynetConvolution32fDirectNchw::Preferable(param))
+                candidates.Add<Avx2::SynetConvolution32fDirectNchw>("DirectNchw");
+            if (SynetConvolution32fNhwcDirect::Preferable(param))
+                candidates.Add<SynetConvolution32fNhwcDirect>("NhwcDirect");
+            if (SynetConvolution32fDirectNhwc::Preferable(param))
+                candidates.Add<SynetConvolution32fDirectNhwc>("DirectNhwc");
+            candidates.Add<SynetConvolution32fGemmNN>("GemmNN");
+            if (SynetConvolution32fSparse::Preferable(param))
+                return new SynetConvolution32fSparse(param, (SynetConvolution32f*)candidates.Select());
+            return candidates.Select();
         }
     }
 #endif//SIMD_AVX2_ENABLE
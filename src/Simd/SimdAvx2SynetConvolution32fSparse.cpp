@@ -0,0 +1,103 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdTranspose.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        static void SparseGemm(size_t M, size_t N, const int32_t * rows, const int32_t * cols, const float * values, const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            size_t N4F = AlignLo(N, 4 * F), NF = AlignLo(N, F);
+            for (size_t i = 0; i < M; ++i)
+            {
+                int32_t beg = rows[i], end = rows[i + 1];
+                size_t j = 0;
+                for (; j < N4F; j += 4 * F)
+                {
+                    __m256 d0 = _mm256_setzero_ps(), d1 = _mm256_setzero_ps(), d2 = _mm256_setzero_ps(), d3 = _mm256_setzero_ps();
+                    for (int32_t k = beg; k < end; ++k)
+                    {
+                        const float * s = src + cols[k] * srcStride + j;
+                        __m256 w = _mm256_set1_ps(values[k]);
+                        d0 = _mm256_fmadd_ps(w, _mm256_loadu_ps(s + 0 * F), d0);
+                        d1 = _mm256_fmadd_ps(w, _mm256_loadu_ps(s + 1 * F), d1);
+                        d2 = _mm256_fmadd_ps(w, _mm256_loadu_ps(s + 2 * F), d2);
+                        d3 = _mm256_fmadd_ps(w, _mm256_loadu_ps(s + 3 * F), d3);
+                    }
+                    _mm256_storeu_ps(dst + j + 0 * F, d0);
+                    _mm256_storeu_ps(dst + j + 1 * F, d1);
+                    _mm256_storeu_ps(dst + j + 2 * F, d2);
+                    _mm256_storeu_ps(dst + j + 3 * F, d3);
+                }
+                for (; j < NF; j += F)
+                {
+                    __m256 d0 = _mm256_setzero_ps();
+                    for (int32_t k = beg; k < end; ++k)
+                        d0 = _mm256_fmadd_ps(_mm256_set1_ps(values[k]), _mm256_loadu_ps(src + cols[k] * srcStride + j), d0);
+                    _mm256_storeu_ps(dst + j, d0);
+                }
+                for (; j < N; ++j)
+                {
+                    float d0 = 0.0f;
+                    for (int32_t k = beg; k < end; ++k)
+                        d0 += values[k] * src[cols[k] * srcStride + j];
+                    dst[j] = d0;
+                }
+                dst += dstStride;
+            }
+        }
+
+        static void Transpose(const float * src, size_t srcStride, size_t rows, size_t cols, float * dst, size_t dstStride)
+        {
+            size_t rowsF = AlignLo(rows, F), colsF = AlignLo(cols, F), r = 0;
+            for (; r < rowsF; r += F)
+            {
+                size_t c = 0;
+                for (; c < colsF; c += F)
+                    Avx::Transpose8x8<false>(src + r * srcStride + c, srcStride, dst + c * dstStride + r, dstStride);
+                for (; c < cols; ++c)
+                    for (size_t i = 0; i < F; ++i)
+                        dst[c * dstStride + r + i] = src[(r + i) * srcStride + c];
+            }
+            for (; r < rows; ++r)
+                for (size_t c = 0; c < cols; ++c)
+                    dst[c * dstStride + r] = src[r * srcStride + c];
+        }
+
+        SynetConvolution32fSparse::SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense)
+            : Base::SynetConvolution32fSparse(p, dense)
+        {
+            _F = F;
+            _sparseGemm = SparseGemm;
+            _transpose = Transpose;
+            _biasAndActivation = Avx2::ConvolutionBiasAndActivation;
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
@@ -817,6 +817,8 @@ namespace Simd
                 return NULL;
             else if (SynetConvolution8iNhwcDepthwise::Preferable(param))
                 return new SynetConvolution8iNhwcDepthwise(param);
+            else if (SynetConvolution8iNhwcWinograd::Preferable(param))
+                return new SynetConvolution8iNhwcWinograd(param);
             else if (SynetConvolution8iNhwcDirect::Preferable(param))
                 return new SynetConvolution8iNhwcDirect(param);
             else
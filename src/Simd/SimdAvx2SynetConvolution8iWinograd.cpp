@@ -0,0 +1,171 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetConvolution8iCommon.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+#include "Simd/SimdCpu.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE)   
+    namespace Avx2
+    {
+        using AlgParam = SynetConvolution8iNhwcWinograd::AlgParam;
+
+        SIMD_INLINE void WinogradKernel3x3Block2x2SetInput8i16(const __m256i s[16], int16_t* dst, size_t stride)
+        {
+            __m256i t[16];
+            for (size_t col = 0; col < 4; ++col)
+            {
+                t[0 + col] = _mm256_sub_epi16(s[0 + col], s[8 + col]);
+                t[4 + col] = _mm256_add_epi16(s[4 + col], s[8 + col]);
+                t[8 + col] = _mm256_sub_epi16(s[8 + col], s[4 + col]);
+                t[12 + col] = _mm256_sub_epi16(s[4 + col], s[12 + col]);
+            }
+            for (size_t row = 0; row < 16; row += 4)
+            {
+                _mm256_storeu_si256((__m256i*)(dst + (row + 0) * stride), _mm256_sub_epi16(t[row + 0], t[row + 2]));
+                _mm256_storeu_si256((__m256i*)(dst + (row + 1) * stride), _mm256_add_epi16(t[row + 1], t[row + 2]));
+                _mm256_storeu_si256((__m256i*)(dst + (row + 2) * stride), _mm256_sub_epi16(t[row + 2], t[row + 1]));
+                _mm256_storeu_si256((__m256i*)(dst + (row + 3) * stride), _mm256_sub_epi16(t[row + 1], t[row + 3]));
+            }
+        }
+
+        static void WinogradKernel3x3Block2x2SetInput8i(const uint8_t* src, const ConvParam8i& p, const AlgParam& a, size_t tileY, size_t tileE, uint8_t zero, int16_t* dst)
+        {
+            size_t srcC16 = AlignLo(p.srcC, 16);
+            __m256i _zero = _mm256_set1_epi16(zero);
+            for (size_t ty = tileY; ty < tileE; ++ty)
+            {
+                for (size_t tx = 0; tx < a.tileW; ++tx)
+                {
+                    int16_t* pDst = dst + ((ty - tileY) * a.tileW + tx) * a.srcC;
+                    const uint8_t* ps[16];
+                    for (size_t row = 0, i = 0; row < 4; ++row)
+                    {
+                        size_t sy = ty * 2 + row - p.padY;
+                        for (size_t col = 0; col < 4; ++col, ++i)
+                        {
+                            size_t sx = tx * 2 + col - p.padX;
+                            ps[i] = (sy < p.srcH && sx < p.srcW) ? src + (sy * p.srcW + sx) * p.srcC : NULL;
+                        }
+                    }
+                    size_t c = 0;
+                    for (; c < srcC16; c += 16)
+                    {
+                        __m256i s[16];
+                        for (size_t i = 0; i < 16; ++i)
+                            s[i] = ps[i] ? _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i*)(ps[i] + c))) : _zero;
+                        WinogradKernel3x3Block2x2SetInput8i16(s, pDst + c, a.strideS);
+                    }
+                    for (; c < p.srcC; ++c)
+                    {
+                        int16_t s[16], t[16];
+                        for (size_t i = 0; i < 16; ++i)
+                            s[i] = ps[i] ? ps[i][c] : zero;
+                        for (size_t col = 0; col < 4; ++col)
+                        {
+                            t[0 + col] = s[0 + col] - s[8 + col];
+                            t[4 + col] = s[4 + col] + s[8 + col];
+                            t[8 + col] = s[8 + col] - s[4 + col];
+                            t[12 + col] = s[4 + col] - s[12 + col];
+                        }
+                        for (size_t row = 0; row < 16; row += 4)
+                        {
+                            pDst[(row + 0) * a.strideS + c] = t[row + 0] - t[row + 2];
+                            pDst[(row + 1) * a.strideS + c] = t[row + 1] + t[row + 2];
+                            pDst[(row + 2) * a.strideS + c] = t[row + 2] - t[row + 1];
+                            pDst[(row + 3) * a.strideS + c] = t[row + 1] - t[row + 3];
+                        }
+                    }
+                    for (; c < a.srcC; ++c)
+                        for (size_t i = 0; i < 16; ++i)
+                            pDst[i * a.strideS + c] = 0;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<size_t M, size_t cols> SIMD_INLINE void WinogradGemm8i(size_t N, size_t K, const int16_t* src, const int16_t* weight, int32_t* dst)
+        {
+            __m256i d[M][2], w0, w1, s0;
+            for (size_t i = 0; i < M; ++i)
+                d[i][0] = _mm256_setzero_si256(), d[i][1] = _mm256_setzero_si256();
+            for (size_t k = 0; k < K; k += 2)
+            {
+                const int16_t* w = weight + k * N;
+                w0 = _mm256_loadu_si256((__m256i*)w);
+                if (cols > 1)
+                    w1 = _mm256_loadu_si256((__m256i*)(w + DF));
+                for (size_t i = 0; i < M; ++i)
+                {
+                    s0 = _mm256_set1_epi32(*(int32_t*)(src + i * K + k));
+                    d[i][0] = _mm256_add_epi32(d[i][0], _mm256_madd_epi16(s0, w0));
+                    if (cols > 1)
+                        d[i][1] = _mm256_add_epi32(d[i][1], _mm256_madd_epi16(s0, w1));
+                }
+            }
+            for (size_t i = 0; i < M; ++i)
+            {
+                _mm256_storeu_si256((__m256i*)(dst + i * N), d[i][0]);
+                if (cols > 1)
+                    _mm256_storeu_si256((__m256i*)(dst + i * N + F), d[i][1]);
+            }
+        }
+
+        template<size_t M> void WinogradGemm8i(size_t N, size_t K, const int16_t* src, const int16_t* weight, int32_t* dst)
+        {
+            size_t N2 = AlignLo(N, DF), j = 0;
+            for (; j < N2; j += DF)
+                WinogradGemm8i<M, 2>(N, K, src, weight + j * 2, dst + j);
+            if (j < N)
+                WinogradGemm8i<M, 1>(N, K, src, weight + j * 2, dst + j);
+        }
+
+        static void WinogradGemm8i(size_t M, size_t N, size_t K, const int16_t* src, const int16_t* weight, int32_t* dst)
+        {
+            size_t M4 = AlignLo(M, 4), i = 0;
+            for (; i < M4; i += 4)
+                WinogradGemm8i<4>(N, K, src + i * K, weight, dst + i * N);
+            for (; i < M; ++i)
+                WinogradGemm8i<1>(N, K, src + i * K, weight, dst + i * N);
+        }
+
+        //---------------------------------------------------------------------
+
+        SynetConvolution8iNhwcWinograd::SynetConvolution8iNhwcWinograd(const ConvParam8i& p)
+            : Base::SynetConvolution8iNhwcWinograd(p)
+        {
+            SetAlgParam(F, Base::AlgCacheL2());
+            _setInput = WinogradKernel3x3Block2x2SetInput8i;
+            _gemm = WinogradGemm8i;
+            _convertSrc = Avx2::SynetConvert32fTo8u;
+        }
+    }
+#endif
+}
@@ -0,0 +1,71 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetYuvToTensor.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        static void BlendRows(const float * row0, const float * row1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            size_t sizeF = AlignLo(size, F), i = 0;
+            __m256 _alpha = _mm256_set1_ps(alpha);
+            for (; i < sizeF; i += F)
+            {
+                __m256 r0 = _mm256_loadu_ps(row0 + i);
+                __m256 r1 = _mm256_loadu_ps(row1 + i);
+                __m256 value = _mm256_fmadd_ps(_mm256_sub_ps(r1, r0), _alpha, r0);
+                _mm256_storeu_ps(dst + i, _mm256_fmadd_ps(value, _mm256_loadu_ps(scale + i), _mm256_loadu_ps(shift + i)));
+            }
+            for (; i < size; ++i)
+                dst[i] = (row0[i] + (row1[i] - row0[i]) * alpha) * scale[i] + shift[i];
+        }
+
+        SynetYuvToTensor::SynetYuvToTensor(const YuvToTensorParam & param)
+            : Base::SynetYuvToTensor(param)
+        {
+            if (param.srcW >= DA)
+            {
+                _yuv420pToBgr = Avx2::Yuv420pToBgr;
+                _deinterleaveUv = Avx2::DeinterleaveUv;
+            }
+            _blendRows = BlendRows;
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetYuvToTensorInit(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH,
+            SimdPixelFormatType order, const float * mean, const float * scale, SimdTensorFormatType format)
+        {
+            YuvToTensorParam param(srcW, srcH, layout, dstW, dstH, order, mean, scale, format);
+            if (!param.Valid())
+                return NULL;
+            return new SynetYuvToTensor(param);
+        }
+    }
+#endif//SIMD_AVX2_ENABLE
+}
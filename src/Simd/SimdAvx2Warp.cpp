@@ -0,0 +1,261 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarp.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        WarpByte::WarpByte(const WarpParam & param)
+            : Base::WarpByte(param)
+        {
+        }
+
+        template<bool perspective> SIMD_INLINE void EstimateRow8(const float * ax, const float * ay, const float * aw, 
+            __m256 cx, __m256 cy, __m256 cw, __m256 max, __m256 scale, __m256i last, int shift, int32_t * fx, int32_t * fy, uint8_t * in)
+        {
+            const __m256 _min = _mm256_set1_ps(-2.0f);
+            const __m256 _half = _mm256_set1_ps(0.5f);
+            __m256 sx = _mm256_add_ps(_mm256_loadu_ps(ax), cx);
+            __m256 sy = _mm256_add_ps(_mm256_loadu_ps(ay), cy);
+            if (perspective)
+            {
+                __m256 w = _mm256_add_ps(_mm256_loadu_ps(aw), cw);
+                __m256 positive = _mm256_cmp_ps(w, _mm256_setzero_ps(), _CMP_GT_OQ);
+                sx = _mm256_blendv_ps(_min, _mm256_div_ps(sx, w), positive);
+                sy = _mm256_blendv_ps(_min, _mm256_div_ps(sy, w), positive);
+            }
+            sx = _mm256_min_ps(_mm256_max_ps(sx, _min), _mm256_permute_ps(max, 0x00));
+            sy = _mm256_min_ps(_mm256_max_ps(sy, _min), _mm256_permute_ps(max, 0x55));
+            __m256i _fx = _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_add_ps(_mm256_mul_ps(sx, scale), _half)));
+            __m256i _fy = _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_add_ps(_mm256_mul_ps(sy, scale), _half)));
+            _mm256_storeu_si256((__m256i*)fx, _fx);
+            _mm256_storeu_si256((__m256i*)fy, _fy);
+            __m256i ix = _mm256_srai_epi32(_fx, shift), iy = _mm256_srai_epi32(_fy, shift);
+            __m256i lastX = _mm256_shuffle_epi32(last, 0x00), lastY = _mm256_shuffle_epi32(last, 0x55);
+            __m256i inX = _mm256_andnot_si256(_mm256_cmpgt_epi32(ix, lastX), _mm256_cmpgt_epi32(ix, K_INV_ZERO));
+            __m256i inY = _mm256_andnot_si256(_mm256_cmpgt_epi32(iy, lastY), _mm256_cmpgt_epi32(iy, K_INV_ZERO));
+            __m256i mask = _mm256_and_si256(inX, inY);
+            __m128i mask16 = _mm_packs_epi32(_mm256_castsi256_si128(mask), _mm256_extracti128_si256(mask, 1));
+            _mm_storel_epi64((__m128i*)in, _mm_packs_epi16(mask16, mask16));
+        }
+
+        void WarpByte::EstimateRow(size_t dy)
+        {
+            size_t dstW = _param.dstW, dstWF = AlignLo(dstW, F);
+            if (dstW < F)
+            {
+                Base::WarpByte::EstimateRow(dy);
+                return;
+            }
+            bool nearest = _param.IsNearest();
+            __m256 cx = _mm256_set1_ps(_cx[dy]), cy = _mm256_set1_ps(_cy[dy]), cw = _mm256_set1_ps(_param.perspective ? _cw[dy] : 1.0f);
+            __m256 max = _mm256_setr_ps(float(_param.srcW + 1), float(_param.srcH + 1), 0, 0, float(_param.srcW + 1), float(_param.srcH + 1), 0, 0);
+            __m256 scale = _mm256_set1_ps(nearest ? 1.0f : float(Base::WARP_RANGE));
+            int shift = nearest ? 0 : Base::WARP_SHIFT;
+            int lastX = int(_param.srcW) - (nearest ? 1 : 2), lastY = int(_param.srcH) - (nearest ? 1 : 2);
+            __m256i last = _mm256_setr_epi32(lastX, lastY, 0, 0, lastX, lastY, 0, 0);
+            if (_param.perspective)
+            {
+                for (size_t dx = 0; dx < dstWF; dx += F)
+                    EstimateRow8<true>(_ax.data + dx, _ay.data + dx, _aw.data + dx, cx, cy, cw, max, scale, last, shift, _fx.data + dx, _fy.data + dx, _in.data + dx);
+                if (dstWF < dstW)
+                {
+                    size_t dx = dstW - F;
+                    EstimateRow8<true>(_ax.data + dx, _ay.data + dx, _aw.data + dx, cx, cy, cw, max, scale, last, shift, _fx.data + dx, _fy.data + dx, _in.data + dx);
+                }
+            }
+            else
+            {
+                for (size_t dx = 0; dx < dstWF; dx += F)
+                    EstimateRow8<false>(_ax.data + dx, _ay.data + dx, NULL, cx, cy, cw, max, scale, last, shift, _fx.data + dx, _fy.data + dx, _in.data + dx);
+                if (dstWF < dstW)
+                {
+                    size_t dx = dstW - F;
+                    EstimateRow8<false>(_ax.data + dx, _ay.data + dx, NULL, cx, cy, cw, max, scale, last, shift, _fx.data + dx, _fy.data + dx, _in.data + dx);
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void InterpolateBilinear1(const uint8_t * src, size_t srcStride, int fx, int fy, uint8_t * dst)
+        {
+            const uint8_t * s0 = src + (fy >> Base::WARP_SHIFT) * srcStride + (fx >> Base::WARP_SHIFT), * s1 = s0 + srcStride;
+            int ax1 = fx & (Base::WARP_RANGE - 1), ax0 = Base::WARP_RANGE - ax1;
+            int ay1 = fy & (Base::WARP_RANGE - 1), ay0 = Base::WARP_RANGE - ay1;
+            dst[0] = (uint8_t)(((s0[0] * ax0 + s0[1] * ax1) * ay0 + (s1[0] * ax0 + s1[1] * ax1) * ay1 + Base::WARP_ROUND) >> 2 * Base::WARP_SHIFT);
+        }
+
+        SIMD_INLINE __m256i LoadPair(const uint8_t * src, const int32_t * offset)
+        {
+            return _mm256_setr_epi32(
+                *(uint16_t*)(src + offset[0]), *(uint16_t*)(src + offset[1]), *(uint16_t*)(src + offset[2]), *(uint16_t*)(src + offset[3]),
+                *(uint16_t*)(src + offset[4]), *(uint16_t*)(src + offset[5]), *(uint16_t*)(src + offset[6]), *(uint16_t*)(src + offset[7]));
+        }
+
+        SIMD_INLINE void InterpolateBilinear8x1(const uint8_t * src, size_t srcStride, const int32_t * fx, const int32_t * fy, uint8_t * dst)
+        {
+            const __m256i K16_00FF = _mm256_set1_epi32(0x00FF);
+            const __m256i K32_FF00 = _mm256_set1_epi32(0xFF00);
+            const __m256i RANGE = _mm256_set1_epi32(Base::WARP_RANGE);
+            const __m256i MASK = _mm256_set1_epi32(Base::WARP_RANGE - 1);
+            __m256i _fx = _mm256_loadu_si256((__m256i*)fx);
+            __m256i _fy = _mm256_loadu_si256((__m256i*)fy);
+            SIMD_ALIGNED(32) int32_t offset[F];
+            __m256i ix = _mm256_srai_epi32(_fx, Base::WARP_SHIFT), iy = _mm256_srai_epi32(_fy, Base::WARP_SHIFT);
+            _mm256_store_si256((__m256i*)offset, _mm256_add_epi32(_mm256_mullo_epi32(iy, _mm256_set1_epi32((int32_t)srcStride)), ix));
+            __m256i p0 = LoadPair(src, offset), p1 = LoadPair(src + srcStride, offset);
+            p0 = _mm256_or_si256(_mm256_and_si256(p0, K16_00FF), _mm256_slli_epi32(_mm256_and_si256(p0, K32_FF00), 8));
+            p1 = _mm256_or_si256(_mm256_and_si256(p1, K16_00FF), _mm256_slli_epi32(_mm256_and_si256(p1, K32_FF00), 8));
+            __m256i ax1 = _mm256_and_si256(_fx, MASK), ax = _mm256_or_si256(_mm256_sub_epi32(RANGE, ax1), _mm256_slli_epi32(ax1, 16));
+            __m256i ay1 = _mm256_and_si256(_fy, MASK), ay0 = _mm256_sub_epi32(RANGE, ay1);
+            __m256i r0 = _mm256_mullo_epi32(_mm256_madd_epi16(p0, ax), ay0);
+            __m256i r1 = _mm256_mullo_epi32(_mm256_madd_epi16(p1, ax), ay1);
+            __m256i d = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(r0, r1), _mm256_set1_epi32(Base::WARP_ROUND)), 2 * Base::WARP_SHIFT);
+            __m128i d16 = _mm_packs_epi32(_mm256_castsi256_si128(d), _mm256_extracti128_si256(d, 1));
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(d16, d16));
+        }
+
+        template<size_t cn> SIMD_INLINE __m128i LoadBilinear(const uint8_t * s0, size_t srcStride);
+
+        template<> SIMD_INLINE __m128i LoadBilinear<2>(const uint8_t * s0, size_t srcStride)
+        {
+            const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x2, 0x1, 0x3, -1, -1, -1, -1, 0x8, 0xA, 0x9, 0xB, -1, -1, -1, -1);
+            __m128i s = _mm_unpacklo_epi64(_mm_cvtsi32_si128(*(int32_t*)s0), _mm_cvtsi32_si128(*(int32_t*)(s0 + srcStride)));
+            return _mm_shuffle_epi8(s, SHUFFLE);
+        }
+
+        template<> SIMD_INLINE __m128i LoadBilinear<3>(const uint8_t * s0, size_t srcStride)
+        {
+            const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x5, 0x1, 0x6, 0x2, 0x7, -1, -1, 0x8, 0xD, 0x9, 0xE, 0xA, 0xF, -1, -1);
+            const uint8_t * s1 = s0 + srcStride;
+            __m128i r0 = _mm_unpacklo_epi32(_mm_cvtsi32_si128(*(int32_t*)s0), _mm_cvtsi32_si128(*(int32_t*)(s0 + 2)));
+            __m128i r1 = _mm_unpacklo_epi32(_mm_cvtsi32_si128(*(int32_t*)s1), _mm_cvtsi32_si128(*(int32_t*)(s1 + 2)));
+            return _mm_shuffle_epi8(_mm_unpacklo_epi64(r0, r1), SHUFFLE);
+        }
+
+        template<> SIMD_INLINE __m128i LoadBilinear<4>(const uint8_t * s0, size_t srcStride)
+        {
+            const __m128i SHUFFLE = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF);
+            __m128i s = _mm_unpacklo_epi64(_mm_loadl_epi64((__m128i*)s0), _mm_loadl_epi64((__m128i*)(s0 + srcStride)));
+            return _mm_shuffle_epi8(s, SHUFFLE);
+        }
+
+        template<size_t cn> SIMD_INLINE void StoreBilinear(int32_t value, uint8_t * dst)
+        {
+            for (size_t c = 0; c < cn; ++c)
+                dst[c] = uint8_t(value >> 8 * c);
+        }
+
+        template<> SIMD_INLINE void StoreBilinear<4>(int32_t value, uint8_t * dst)
+        {
+            *(int32_t*)dst = value;
+        }
+
+        template<size_t cn> SIMD_INLINE void InterpolateBilinear(const uint8_t * src, size_t srcStride, int fx, int fy, uint8_t * dst)
+        {
+            const uint8_t * s0 = src + (fy >> Base::WARP_SHIFT) * srcStride + (fx >> Base::WARP_SHIFT) * cn;
+            int ax1 = fx & (Base::WARP_RANGE - 1), ax0 = Base::WARP_RANGE - ax1;
+            int ay1 = fy & (Base::WARP_RANGE - 1), ay0 = Base::WARP_RANGE - ay1;
+            __m128i s = LoadBilinear<cn>(s0, srcStride);
+            __m128i ax = _mm_set1_epi32(ax0 | (ax1 << 16));
+            __m128i r0 = _mm_mullo_epi32(_mm_madd_epi16(_mm_unpacklo_epi8(s, _mm_setzero_si128()), ax), _mm_set1_epi32(ay0));
+            __m128i r1 = _mm_mullo_epi32(_mm_madd_epi16(_mm_unpackhi_epi8(s, _mm_setzero_si128()), ax), _mm_set1_epi32(ay1));
+            __m128i d = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(r0, r1), _mm_set1_epi32(Base::WARP_ROUND)), 2 * Base::WARP_SHIFT);
+            d = _mm_packus_epi16(_mm_packs_epi32(d, d), d);
+            StoreBilinear<cn>(_mm_cvtsi128_si32(d), dst);
+        }
+
+        void WarpByte::InterpolateRow(const uint8_t * src, size_t srcStride, uint8_t * dst)
+        {
+            size_t cn = _param.channels, dstW = _param.dstW;
+            if (_param.IsNearest())
+            {
+                Base::WarpByte::InterpolateRow(src, srcStride, dst);
+                return;
+            }
+            bool transparent = _param.Border() == SimdWarpBorderTransparent;
+            switch (cn)
+            {
+            case 1:
+            {
+                size_t dx = 0;
+                for (; dx < dstW; )
+                {
+                    if (dx + F <= dstW && *(uint64_t*)(_in.data + dx) == 0xFFFFFFFFFFFFFFFF)
+                    {
+                        InterpolateBilinear8x1(src, srcStride, _fx.data + dx, _fy.data + dx, dst + dx);
+                        dx += F;
+                    }
+                    else
+                    {
+                        if (_in[dx])
+                            InterpolateBilinear1(src, srcStride, _fx[dx], _fy[dx], dst + dx);
+                        else if (!transparent)
+                            InterpolateBorder(src, srcStride, dx, dst + dx);
+                        dx += 1;
+                    }
+                }
+                break;
+            }
+            case 2: InterpolateRow<2>(src, srcStride, transparent, dst); break;
+            case 3: InterpolateRow<3>(src, srcStride, transparent, dst); break;
+            case 4: InterpolateRow<4>(src, srcStride, transparent, dst); break;
+            }
+        }
+
+        template<size_t cn> void WarpByte::InterpolateRow(const uint8_t * src, size_t srcStride, bool transparent, uint8_t * dst)
+        {
+            for (size_t dx = 0, dstW = _param.dstW; dx < dstW; ++dx, dst += cn)
+            {
+                if (_in[dx])
+                    InterpolateBilinear<cn>(src, srcStride, _fx[dx], _fy[dx], dst);
+                else if (!transparent)
+                    InterpolateBorder(src, srcStride, dx, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, mat, false, flags, border, A);
+            if (!param.valid)
+                return NULL;
+            return new WarpByte(param);
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, mat, true, flags, border, A);
+            if (!param.valid)
+                return NULL;
+            return new WarpByte(param);
+        }
+    }
+#endif //SIMD_AVX2_ENABLE
+}
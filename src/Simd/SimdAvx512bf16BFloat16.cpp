@@ -0,0 +1,55 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdAvx512bf16.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BF16_ENABLE    
+    namespace Avx512bf16
+    {
+        SIMD_INLINE void Float32ToBFloat16(const float * src, uint16_t * dst, __mmask16 srcLo, __mmask16 srcHi, __mmask32 dstTail)
+        {
+            __m512 lo = _mm512_maskz_loadu_ps(srcLo, src + 0);
+            __m512 hi = _mm512_maskz_loadu_ps(srcHi, src + F);
+            _mm512_mask_storeu_epi16(dst, dstTail, (__m512i)_mm512_cvtne2ps_pbh(hi, lo));
+        }
+
+        void Float32ToBFloat16(const float * src, size_t size, uint16_t * dst)
+        {
+            size_t size32 = Simd::AlignLo(size, DF);
+            size_t i = 0;
+            for (; i < size32; i += DF)
+                Float32ToBFloat16(src + i, dst + i, __mmask16(-1), __mmask16(-1), __mmask32(-1));
+            if (i < size)
+            {
+                ptrdiff_t tail = size - i;
+                Float32ToBFloat16(src + i, dst + i, TailMask16(tail), TailMask16(tail - F), TailMask32(tail));
+            }
+        }
+    }
+#endif// SIMD_AVX512BF16_ENABLE
+}
@@ -0,0 +1,146 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution16b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdAvx512bf16.h"
+#include "Simd/SimdAvx512f.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BF16_ENABLE    
+    namespace Avx512bf16
+    {
+        template<size_t M, size_t N> SIMD_INLINE void Gemm16bMxN(const uint16_t * src, size_t K, size_t srcStride, const uint16_t * weight, float * dst, size_t dstStride, __mmask16 tail)
+        {
+            __m512 d0[M], d1[M];
+            for (size_t i = 0; i < M; ++i)
+            {
+                d0[i] = _mm512_setzero_ps();
+                if (N > 1)
+                    d1[i] = _mm512_setzero_ps();
+            }
+            const uint16_t * weight1 = weight + K * F;
+            for (size_t k = 0; k < K; k += 2, weight += DF, weight1 += DF)
+            {
+                __m512bh w0 = (__m512bh)_mm512_loadu_si512(weight);
+                __m512bh w1;
+                if (N > 1)
+                    w1 = (__m512bh)_mm512_loadu_si512(weight1);
+                for (size_t i = 0; i < M; ++i)
+                {
+                    __m512bh s = (__m512bh)_mm512_set1_epi32(*(int32_t*)(src + i * srcStride + k));
+                    d0[i] = _mm512_dpbf16_ps(d0[i], s, w0);
+                    if (N > 1)
+                        d1[i] = _mm512_dpbf16_ps(d1[i], s, w1);
+                }
+            }
+            for (size_t i = 0; i < M; ++i, dst += dstStride)
+            {
+                if (N > 1)
+                {
+                    _mm512_storeu_ps(dst, d0[i]);
+                    _mm512_mask_storeu_ps(dst + F, tail, d1[i]);
+                }
+                else
+                    _mm512_mask_storeu_ps(dst, tail, d0[i]);
+            }
+        }
+
+        typedef void(*Gemm16bMxNPtr)(const uint16_t * src, size_t K, size_t srcStride, const uint16_t * weight, float * dst, size_t dstStride, __mmask16 tail);
+
+        template<size_t N> Gemm16bMxNPtr GetGemm16bMxN(size_t M)
+        {
+            switch (M)
+            {
+            case 0: return NULL;
+            case 1: return Gemm16bMxN<1, N>;
+            case 2: return Gemm16bMxN<2, N>;
+            case 3: return Gemm16bMxN<3, N>;
+            case 4: return Gemm16bMxN<4, N>;
+            case 5: return Gemm16bMxN<5, N>;
+            case 6: return Gemm16bMxN<6, N>;
+            case 7: return Gemm16bMxN<7, N>;
+            case 8: return Gemm16bMxN<8, N>;
+            case 9: return Gemm16bMxN<9, N>;
+            case 10: return Gemm16bMxN<10, N>;
+            case 11: return Gemm16bMxN<11, N>;
+            case 12: return Gemm16bMxN<12, N>;
+            }
+            assert(0);
+            return NULL;
+        }
+
+        static void Gemm16b(const uint16_t * src, size_t M, size_t K, size_t srcStride, const uint16_t * weight, size_t D, float * dst, size_t dstStride)
+        {
+            assert(K % 2 == 0);
+            const size_t n = 12, Mn = AlignLoAny(M, n), m = M - Mn;
+            const size_t DD = AlignLo(D, DF), tail = D - DD;
+            Gemm16bMxNPtr bodyN = Gemm16bMxN<n, 2>, tailN = GetGemm16bMxN<2>(m);
+            Gemm16bMxNPtr body1 = Gemm16bMxN<n, 1>, tail1 = GetGemm16bMxN<1>(m);
+            for (size_t d = 0; d < D; d += DF)
+            {
+                const uint16_t * w = weight + d * K;
+                float * out = dst + d;
+                if (d < DD || tail > F)
+                {
+                    __mmask16 mask = d < DD ? __mmask16(-1) : TailMask16(tail - F);
+                    size_t i = 0;
+                    for (; i < Mn; i += n)
+                        bodyN(src + i * srcStride, K, srcStride, w, out + i * dstStride, dstStride, mask);
+                    if (m)
+                        tailN(src + i * srcStride, K, srcStride, w, out + i * dstStride, dstStride, mask);
+                }
+                else
+                {
+                    __mmask16 mask = TailMask16(tail);
+                    size_t i = 0;
+                    for (; i < Mn; i += n)
+                        body1(src + i * srcStride, K, srcStride, w, out + i * dstStride, dstStride, mask);
+                    if (m)
+                        tail1(src + i * srcStride, K, srcStride, w, out + i * dstStride, dstStride, mask);
+                }
+            }
+        }
+
+        SynetConvolution16bNhwcGemm::SynetConvolution16bNhwcGemm(const ConvParam16b & p)
+            : Base::SynetConvolution16bNhwcGemm(p)
+        {
+            _gemm = Gemm16b;
+            _biasAndActivation = Avx512f::ConvolutionBiasAndActivation;
+            _toBFloat16 = Avx512bf16::Float32ToBFloat16;
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters * conv)
+        {
+            ConvParam16b param(batch, conv);
+            if (!param.Valid())
+                return NULL;
+            return new SynetConvolution16bNhwcGemm(param);
+        }
+    }
+#endif//SIMD_AVX512BF16_ENABLE
+}
@@ -0,0 +1,73 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template<bool mask> SIMD_INLINE void Float32ToBFloat16(const float * src, uint16_t * dst, const __mmask16 * srcTails, __mmask32 dstTail)
+        {
+            __m512i lo = Float32ToBFloat16(_mm512_maskz_loadu_ps(srcTails[0], src + 0));
+            __m512i hi = Float32ToBFloat16(_mm512_maskz_loadu_ps(srcTails[1], src + F));
+            _mm512_mask_storeu_epi16(dst, dstTail, _mm512_permutexvar_epi32(K32_PERMUTE_FOR_PACK, _mm512_packus_epi32(lo, hi)));
+        }
+
+        void Float32ToBFloat16(const float * src, size_t size, uint16_t * dst)
+        {
+            size_t size32 = Simd::AlignLo(size, DF);
+            __mmask16 srcTails[2] = { __mmask16(-1), __mmask16(-1) };
+            size_t i = 0;
+            for (; i < size32; i += DF)
+                Float32ToBFloat16<false>(src + i, dst + i, srcTails, __mmask32(-1));
+            if (i < size)
+            {
+                ptrdiff_t tail = size - i;
+                srcTails[0] = TailMask16(tail);
+                srcTails[1] = TailMask16(tail - F);
+                Float32ToBFloat16<true>(src + i, dst + i, srcTails, TailMask32(tail));
+            }
+        }
+
+        SIMD_INLINE void BFloat16ToFloat32(const uint16_t * src, float * dst, __mmask16 srcTail)
+        {
+            __m512i _src = _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(srcTail, src));
+            _mm512_mask_storeu_ps(dst, srcTail, BFloat16ToFloat32(_src));
+        }
+
+        void BFloat16ToFloat32(const uint16_t * src, size_t size, float * dst)
+        {
+            size_t size16 = Simd::AlignLo(size, F);
+            size_t i = 0;
+            for (; i < size16; i += F)
+                BFloat16ToFloat32(src + i, dst + i, __mmask16(-1));
+            if (i < size)
+                BFloat16ToFloat32(src + i, dst + i, TailMask16(size - i));
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -0,0 +1,322 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K32_PERMUTE_BGR_TO_BGRX = SIMD_MM512_SETR_EPI32(0, 1, 2, 0, 3, 4, 5, 0, 6, 7, 8, 0, 9, 10, 11, 0);
+        const __m512i K8_SHUFFLE_BGRX_TO_PLANAR = SIMD_MM512_SETR_EPI8(
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1,
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1,
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1,
+            0x0, 0x3, 0x6, 0x9, 0x1, 0x4, 0x7, 0xA, 0x2, 0x5, 0x8, 0xB, -1, -1, -1, -1);
+        const __m512i K8_SHUFFLE_BGRA_TO_PLANAR = SIMD_MM512_SETR_EPI8(
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF,
+            0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF);
+        const __m512i K32_PERMUTE_PLANAR_TO_BG = SIMD_MM512_SETR_EPI32(0, 4, 8, 12, 16, 20, 24, 28, 1, 5, 9, 13, 17, 21, 25, 29);
+        const __m512i K32_PERMUTE_PLANAR_TO_RA = SIMD_MM512_SETR_EPI32(2, 6, 10, 14, 18, 22, 26, 30, 3, 7, 11, 15, 19, 23, 27, 31);
+
+        SIMD_INLINE __m512i LoadPlanarBgr(const uint8_t * src)
+        {
+            __m512i bgr = _mm512_maskz_loadu_epi8(__mmask64(0x0000FFFFFFFFFFFF), src);
+            return _mm512_shuffle_epi8(_mm512_permutexvar_epi32(K32_PERMUTE_BGR_TO_BGRX, bgr), K8_SHUFFLE_BGRX_TO_PLANAR);
+        }
+
+        SIMD_INLINE __m512i LoadPlanarBgra(const uint8_t * src)
+        {
+            return _mm512_shuffle_epi8(_mm512_loadu_si512((__m512i*)src), K8_SHUFFLE_BGRA_TO_PLANAR);
+        }
+
+        SIMD_INLINE void PlanarToBgr(__m512i p0, __m512i p1, __m512i p2, __m512i p3, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            __m512i bg01 = _mm512_permutex2var_epi32(p0, K32_PERMUTE_PLANAR_TO_BG, p1);
+            __m512i bg23 = _mm512_permutex2var_epi32(p2, K32_PERMUTE_PLANAR_TO_BG, p3);
+            __m512i ra01 = _mm512_permutex2var_epi32(p0, K32_PERMUTE_PLANAR_TO_RA, p1);
+            __m512i ra23 = _mm512_permutex2var_epi32(p2, K32_PERMUTE_PLANAR_TO_RA, p3);
+            blue = _mm512_shuffle_i64x2(bg01, bg23, 0x44);
+            green = _mm512_shuffle_i64x2(bg01, bg23, 0xEE);
+            red = _mm512_shuffle_i64x2(ra01, ra23, 0x44);
+        }
+
+        template<SimdPixelFormatType format> SIMD_INLINE void LoadPixels(const uint8_t * src, __m512i & blue, __m512i & green, __m512i & red);
+
+        template<> SIMD_INLINE void LoadPixels<SimdPixelFormatBgr24>(const uint8_t * src, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            PlanarToBgr(LoadPlanarBgr(src + 0 * 48), LoadPlanarBgr(src + 1 * 48), LoadPlanarBgr(src + 2 * 48), LoadPlanarBgr(src + 3 * 48), blue, green, red);
+        }
+
+        template<> SIMD_INLINE void LoadPixels<SimdPixelFormatRgb24>(const uint8_t * src, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            PlanarToBgr(LoadPlanarBgr(src + 0 * 48), LoadPlanarBgr(src + 1 * 48), LoadPlanarBgr(src + 2 * 48), LoadPlanarBgr(src + 3 * 48), red, green, blue);
+        }
+
+        template<> SIMD_INLINE void LoadPixels<SimdPixelFormatBgra32>(const uint8_t * src, __m512i & blue, __m512i & green, __m512i & red)
+        {
+            PlanarToBgr(LoadPlanarBgra(src + 0 * A), LoadPlanarBgra(src + 1 * A), LoadPlanarBgra(src + 2 * A), LoadPlanarBgra(src + 3 * A), blue, green, red);
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToY16(__m512i b16, __m512i g16, __m512i r16)
+        {
+            static const __m512i B_R = SIMD_MM512_SET2_EPI16(T::BLUE_TO_Y, T::RED_TO_Y);
+            static const __m512i G_RT = SIMD_MM512_SET2_EPI16(T::GREEN_TO_Y, T::B_ROUND);
+            static const __m512i Y_LO = SIMD_MM512_SET1_EPI16(T::Y_LO);
+            __m512i lo = _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(_mm512_unpacklo_epi16(b16, r16), B_R),
+                _mm512_madd_epi16(_mm512_unpacklo_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            __m512i hi = _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(_mm512_unpackhi_epi16(b16, r16), B_R),
+                _mm512_madd_epi16(_mm512_unpackhi_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            return _mm512_add_epi16(_mm512_packs_epi32(lo, hi), Y_LO);
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToY8(__m512i blue, __m512i green, __m512i red)
+        {
+            return _mm512_packus_epi16(
+                BgrToY16<T>(_mm512_unpacklo_epi8(blue, K_ZERO), _mm512_unpacklo_epi8(green, K_ZERO), _mm512_unpacklo_epi8(red, K_ZERO)),
+                BgrToY16<T>(_mm512_unpackhi_epi8(blue, K_ZERO), _mm512_unpackhi_epi8(green, K_ZERO), _mm512_unpackhi_epi8(red, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToU16(__m512i b16, __m512i g16, __m512i r16)
+        {
+            static const __m512i B_R = SIMD_MM512_SET2_EPI16(T::BLUE_TO_U, T::RED_TO_U);
+            static const __m512i G_RT = SIMD_MM512_SET2_EPI16(T::GREEN_TO_U, T::B_ROUND);
+            static const __m512i UV_Z = SIMD_MM512_SET1_EPI16(T::UV_Z);
+            __m512i lo = _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(_mm512_unpacklo_epi16(b16, r16), B_R),
+                _mm512_madd_epi16(_mm512_unpacklo_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            __m512i hi = _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(_mm512_unpackhi_epi16(b16, r16), B_R),
+                _mm512_madd_epi16(_mm512_unpackhi_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            return _mm512_add_epi16(_mm512_packs_epi32(lo, hi), UV_Z);
+        }
+
+        template<class T> SIMD_INLINE __m512i BgrToV16(__m512i b16, __m512i g16, __m512i r16)
+        {
+            static const __m512i B_R = SIMD_MM512_SET2_EPI16(T::BLUE_TO_V, T::RED_TO_V);
+            static const __m512i G_RT = SIMD_MM512_SET2_EPI16(T::GREEN_TO_V, T::B_ROUND);
+            static const __m512i UV_Z = SIMD_MM512_SET1_EPI16(T::UV_Z);
+            __m512i lo = _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(_mm512_unpacklo_epi16(b16, r16), B_R),
+                _mm512_madd_epi16(_mm512_unpacklo_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            __m512i hi = _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(_mm512_unpackhi_epi16(b16, r16), B_R),
+                _mm512_madd_epi16(_mm512_unpackhi_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            return _mm512_add_epi16(_mm512_packs_epi32(lo, hi), UV_Z);
+        }
+
+        SIMD_INLINE __m512i AverageRows16(__m512i row0, __m512i row1)
+        {
+            return _mm512_srli_epi16(_mm512_add_epi16(_mm512_add_epi16(_mm512_maddubs_epi16(row0, K8_01), 
+                _mm512_maddubs_epi16(row1, K8_01)), K16_0002), 2);
+        }
+
+        template<class T, SimdPixelFormatType format> SIMD_INLINE void PixelsToYuv16(const uint8_t * src, size_t srcStride, 
+            uint8_t * y, size_t yStride, __m512i & u16, __m512i & v16)
+        {
+            __m512i blue[2], green[2], red[2];
+            LoadPixels<format>(src, blue[0], green[0], red[0]);
+            LoadPixels<format>(src + srcStride, blue[1], green[1], red[1]);
+            _mm512_storeu_si512((__m512i*)y, BgrToY8<T>(blue[0], green[0], red[0]));
+            _mm512_storeu_si512((__m512i*)(y + yStride), BgrToY8<T>(blue[1], green[1], red[1]));
+            __m512i b16 = AverageRows16(blue[0], blue[1]);
+            __m512i g16 = AverageRows16(green[0], green[1]);
+            __m512i r16 = AverageRows16(red[0], red[1]);
+            u16 = BgrToU16<T>(b16, g16, r16);
+            v16 = BgrToV16<T>(b16, g16, r16);
+        }
+
+        template<class T, SimdPixelFormatType format> SIMD_INLINE void PixelsToYuv8(const uint8_t * src, size_t srcStride,
+            uint8_t * y, size_t yStride, __m512i & u8, __m512i & v8)
+        {
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            __m512i u16[2], v16[2];
+            PixelsToYuv16<T, format>(src + 0 * A * size, srcStride, y + 0 * A, yStride, u16[0], v16[0]);
+            PixelsToYuv16<T, format>(src + 1 * A * size, srcStride, y + 1 * A, yStride, u16[1], v16[1]);
+            u8 = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(u16[0], u16[1]));
+            v8 = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_PACK, _mm512_packus_epi16(v16[0], v16[1]));
+        }
+
+        template<class T, SimdPixelFormatType format> void PixelToYuv420p(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            size_t widthDA = AlignLo(width, DA), tail = width - DA;
+            __m512i _u, _v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0; colY < widthDA; colY += DA)
+                {
+                    PixelsToYuv8<T, format>(src + colY * size, srcStride, y + colY, yStride, _u, _v);
+                    _mm512_storeu_si512((__m512i*)(u + colY / 2), _u);
+                    _mm512_storeu_si512((__m512i*)(v + colY / 2), _v);
+                }
+                if (widthDA < width)
+                {
+                    PixelsToYuv8<T, format>(src + tail * size, srcStride, y + tail, yStride, _u, _v);
+                    _mm512_storeu_si512((__m512i*)(u + tail / 2), _u);
+                    _mm512_storeu_si512((__m512i*)(v + tail / 2), _v);
+                }
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        const __m512i K64_PERMUTE_UV_LO = SIMD_MM512_SETR_EPI64(0, 1, 8, 9, 2, 3, 10, 11);
+        const __m512i K64_PERMUTE_UV_HI = SIMD_MM512_SETR_EPI64(4, 5, 12, 13, 6, 7, 14, 15);
+
+        template<bool nv21> SIMD_INLINE void StoreUv(uint8_t * uv, __m512i u, __m512i v)
+        {
+            __m512i lo = nv21 ? _mm512_unpacklo_epi8(v, u) : _mm512_unpacklo_epi8(u, v);
+            __m512i hi = nv21 ? _mm512_unpackhi_epi8(v, u) : _mm512_unpackhi_epi8(u, v);
+            _mm512_storeu_si512((__m512i*)uv + 0, _mm512_permutex2var_epi64(lo, K64_PERMUTE_UV_LO, hi));
+            _mm512_storeu_si512((__m512i*)uv + 1, _mm512_permutex2var_epi64(lo, K64_PERMUTE_UV_HI, hi));
+        }
+
+        template<class T, SimdPixelFormatType format, bool nv21> void PixelToNv(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            size_t widthDA = AlignLo(width, DA), tail = width - DA;
+            __m512i _u, _v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0; colY < widthDA; colY += DA)
+                {
+                    PixelsToYuv8<T, format>(src + colY * size, srcStride, y + colY, yStride, _u, _v);
+                    StoreUv<nv21>(uv + colY, _u, _v);
+                }
+                if (widthDA < width)
+                {
+                    PixelsToYuv8<T, format>(src + tail * size, srcStride, y + tail, yStride, _u, _v);
+                    StoreUv<nv21>(uv + tail, _u, _v);
+                }
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                uv += uvStride;
+            }
+        }
+
+        template<SimdPixelFormatType format> void PixelToYuv420p(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: PixelToYuv420p<Base::Bt601, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: PixelToYuv420p<Base::Bt709, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: PixelToYuv420p<Base::Bt2020, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: PixelToYuv420p<Base::Bt601Full, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: PixelToYuv420p<Base::Bt709Full, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: PixelToYuv420p<Base::Bt2020Full, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template<SimdPixelFormatType format, bool nv21> void PixelToNv(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: PixelToNv<Base::Bt601, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: PixelToNv<Base::Bt709, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: PixelToNv<Base::Bt2020, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt601Full: PixelToNv<Base::Bt601Full, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709Full: PixelToNv<Base::Bt709Full, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020Full: PixelToNv<Base::Bt2020Full, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420p<SimdPixelFormatBgr24>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420p<SimdPixelFormatBgra32>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void RgbToYuv420pV2(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420p<SimdPixelFormatRgb24>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatBgr24, false>(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatBgra32, false>(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void RgbToNv12(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatRgb24, false>(rgb, width, height, rgbStride, y, yStride, uv, uvStride, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        void BgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatBgr24, true>(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
+        }
+
+        void BgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatBgra32, true>(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
+        }
+
+        void RgbToNv21(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatRgb24, true>(rgb, width, height, rgbStride, y, yStride, vu, vuStride, yuvType);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -499,6 +499,76 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Avx2::ResizerByteFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowV16(const uint8_t * src, size_t srcStride, const int32_t * ay, size_t ky, int32_t * dst)
+        {
+            __m512i sum = _mm512_setzero_si512();
+            size_t k = 0;
+            for (; k + 1 < ky; k += 2, src += 2 * srcStride)
+            {
+                __m512i s0 = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)src));
+                __m512i s1 = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)(src + srcStride)));
+                __m512i s01 = _mm512_or_si512(s0, _mm512_slli_epi32(s1, 16));
+                sum = _mm512_add_epi32(sum, _mm512_madd_epi16(s01, _mm512_set1_epi32(ay[k / 2])));
+            }
+            if (k < ky)
+            {
+                __m512i s0 = _mm512_cvtepu8_epi32(_mm_loadu_si128((__m128i*)src));
+                sum = _mm512_add_epi32(sum, _mm512_madd_epi16(s0, _mm512_set1_epi32(ay[k / 2])));
+            }
+            sum = _mm512_srai_epi32(_mm512_add_epi32(sum, _mm512_set1_epi32(Base::FILTER_V_ROUND)), Base::FILTER_V_SHIFT);
+            _mm512_storeu_si512(dst, sum);
+        }
+
+        void ResizerByteFilter::RunV(const uint8_t * src, size_t srcStride, size_t dy, int32_t * dst)
+        {
+            size_t size = _param.srcW * _param.channels;
+            if (size < F)
+            {
+                Avx2::ResizerByteFilter::RunV(src, srcStride, dy, dst);
+                return;
+            }
+            size_t sizeF = AlignLo(size, F);
+            const int32_t * ay = (const int32_t*)(_ayp.data + dy * AlignHi(_ky, 2));
+            for (size_t x = 0; x < sizeF; x += F)
+                ResizerByteFilterRowV16(src + x, srcStride, ay, _ky, dst + x);
+            if (sizeF < size)
+                ResizerByteFilterRowV16(src + size - F, srcStride, ay, _ky, dst + size - F);
+        }
+
+        SIMD_INLINE void ResizerByteFilterRowH16(const int32_t * src, const int32_t * ix, const int32_t * ax, size_t kx, size_t cn, size_t rs, uint8_t * dst, __mmask16 tail = -1)
+        {
+            __m512i idx = _mm512_maskz_loadu_epi32(tail, ix);
+            __m512i step = _mm512_set1_epi32((int32_t)cn);
+            __m512i sum = _mm512_setzero_si512();
+            for (size_t k = 0; k < kx; ++k, ax += rs)
+            {
+                __m512i s = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), tail, idx, src, 4);
+                sum = _mm512_add_epi32(sum, _mm512_mullo_epi32(s, _mm512_maskz_loadu_epi32(tail, ax)));
+                idx = _mm512_add_epi32(idx, step);
+            }
+            sum = _mm512_srai_epi32(_mm512_add_epi32(sum, _mm512_set1_epi32(Base::FILTER_H_ROUND)), Base::FILTER_H_SHIFT);
+            sum = _mm512_min_epi32(_mm512_max_epi32(sum, _mm512_setzero_si512()), _mm512_set1_epi32(0xFF));
+            _mm512_mask_cvtepi32_storeu_epi8(dst, tail, sum);
+        }
+
+        void ResizerByteFilter::RunH(const int32_t * src, uint8_t * dst)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn, rsF = AlignLo(rs, F);
+            __mmask16 tail = TailMask16(rs - rsF);
+            size_t dx = 0;
+            for (; dx < rsF; dx += F)
+                ResizerByteFilterRowH16(src, _ix.data + dx, _ax.data + dx, _kx, cn, rs, dst + dx);
+            if (dx < rs)
+                ResizerByteFilterRowH16(src, _ix.data + dx, _ax.data + dx, _kx, cn, rs, dst + dx, tail);
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m512i));
@@ -506,6 +576,8 @@ namespace Simd
                 return new ResizerByteBilinear(param);
             else if (param.IsByteArea())
                 return new ResizerByteArea(param);
+            else if (param.IsByteFilter())
+                return new ResizerByteFilter(param);
             else
                 return Avx512f::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
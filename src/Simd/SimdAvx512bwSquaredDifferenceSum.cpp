@@ -25,6 +25,7 @@
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdSet.h"
 #include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -165,6 +166,50 @@ namespace Simd
             else
                 SquaredDifferenceSumMasked<false>(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
         }
+
+        SIMD_INLINE void SquaredDifferenceSums16(const uint8_t * a, const uint8_t * b, size_t bStride, size_t count, uint64_t * sums)
+        {
+            const __m512i _a = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i*)a));
+            const __m512i _idx = _mm512_setr_epi32(0, 4, 8, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+            size_t count4 = AlignLo(count, 4), i = 0;
+            for (; i < count4; i += 4, b += 4 * bStride)
+            {
+                __m512i _b = _mm512_castsi128_si512(_mm_loadu_si128((__m128i*)(b + 0 * bStride)));
+                _b = _mm512_inserti32x4(_b, _mm_loadu_si128((__m128i*)(b + 1 * bStride)), 1);
+                _b = _mm512_inserti32x4(_b, _mm_loadu_si128((__m128i*)(b + 2 * bStride)), 2);
+                _b = _mm512_inserti32x4(_b, _mm_loadu_si128((__m128i*)(b + 3 * bStride)), 3);
+                __m512i sum = SquaredDifference(_a, _b);
+                sum = _mm512_add_epi32(sum, _mm512_shuffle_epi32(sum, _MM_PERM_BADC));
+                sum = _mm512_add_epi32(sum, _mm512_shuffle_epi32(sum, _MM_PERM_CDAB));
+                sum = _mm512_permutexvar_epi32(_idx, sum);
+                _mm256_storeu_si256((__m256i*)(sums + i), _mm256_cvtepu32_epi64(_mm512_castsi512_si128(sum)));
+            }
+            if (i < count)
+                Base::SquaredDifferenceSums(a, b, bStride, 16, count - i, sums + i);
+        }
+
+        void SquaredDifferenceSums(const uint8_t * a, const uint8_t * b, size_t bStride, size_t size, size_t count, uint64_t * sums)
+        {
+            assert(size < 0x10000);
+
+            if (size == 16)
+            {
+                SquaredDifferenceSums16(a, b, bStride, count, sums);
+                return;
+            }
+            size_t alignedSize = AlignLo(size, A);
+            __mmask64 tailMask = TailMask64(size - alignedSize);
+            for (size_t i = 0; i < count; ++i, b += bStride)
+            {
+                __m512i sum = _mm512_setzero_si512();
+                size_t j = 0;
+                for (; j < alignedSize; j += A)
+                    SquaredDifferenceSum<false, false>(a + j, b + j, &sum);
+                if (j < size)
+                    SquaredDifferenceSum<false, true>(a + j, b + j, &sum, tailMask);
+                sums[i] = ExtractSum<uint32_t>(sum);
+            }
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
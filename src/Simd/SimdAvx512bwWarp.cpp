@@ -0,0 +1,178 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarp.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        WarpByte::WarpByte(const WarpParam & param)
+            : Avx2::WarpByte(param)
+        {
+        }
+
+        template<bool perspective> SIMD_INLINE void EstimateRow16(const float * ax, const float * ay, const float * aw, __m512 cx, __m512 cy, __m512 cw, 
+            __m512 maxX, __m512 maxY, __m512 scale, __m512i lastX, __m512i lastY, int shift, int32_t * fx, int32_t * fy, uint8_t * in, __mmask16 tail = -1)
+        {
+            const __m512 _min = _mm512_set1_ps(-2.0f);
+            const __m512 _half = _mm512_set1_ps(0.5f);
+            __m512 sx = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, ax), cx);
+            __m512 sy = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, ay), cy);
+            if (perspective)
+            {
+                __m512 w = _mm512_add_ps(_mm512_maskz_loadu_ps(tail, aw), cw);
+                __mmask16 positive = _mm512_cmp_ps_mask(w, _mm512_setzero_ps(), _CMP_GT_OQ);
+                sx = _mm512_mask_div_ps(_min, positive, sx, w);
+                sy = _mm512_mask_div_ps(_min, positive, sy, w);
+            }
+            sx = _mm512_min_ps(_mm512_max_ps(sx, _min), maxX);
+            sy = _mm512_min_ps(_mm512_max_ps(sy, _min), maxY);
+            __m512i _fx = _mm512_cvttps_epi32(_mm512_floor_ps(_mm512_add_ps(_mm512_mul_ps(sx, scale), _half)));
+            __m512i _fy = _mm512_cvttps_epi32(_mm512_floor_ps(_mm512_add_ps(_mm512_mul_ps(sy, scale), _half)));
+            _mm512_mask_storeu_epi32(fx, tail, _fx);
+            _mm512_mask_storeu_epi32(fy, tail, _fy);
+            __m512i ix = _mm512_srai_epi32(_fx, shift), iy = _mm512_srai_epi32(_fy, shift);
+            __mmask16 inX = _mm512_cmpge_epi32_mask(ix, _mm512_setzero_si512()) & _mm512_cmple_epi32_mask(ix, lastX);
+            __mmask16 inY = _mm512_cmpge_epi32_mask(iy, _mm512_setzero_si512()) & _mm512_cmple_epi32_mask(iy, lastY);
+            _mm512_mask_cvtepi32_storeu_epi8(in, tail, _mm512_maskz_mov_epi32(inX & inY, K_INV_ZERO));
+        }
+
+        void WarpByte::EstimateRow(size_t dy)
+        {
+            size_t dstW = _param.dstW, dstWF = AlignLo(dstW, F);
+            __mmask16 tail = TailMask16(dstW - dstWF);
+            bool nearest = _param.IsNearest();
+            __m512 cx = _mm512_set1_ps(_cx[dy]), cy = _mm512_set1_ps(_cy[dy]), cw = _mm512_set1_ps(_param.perspective ? _cw[dy] : 1.0f);
+            __m512 maxX = _mm512_set1_ps(float(_param.srcW + 1)), maxY = _mm512_set1_ps(float(_param.srcH + 1));
+            __m512 scale = _mm512_set1_ps(nearest ? 1.0f : float(Base::WARP_RANGE));
+            int shift = nearest ? 0 : Base::WARP_SHIFT;
+            __m512i lastX = _mm512_set1_epi32(int(_param.srcW) - (nearest ? 1 : 2));
+            __m512i lastY = _mm512_set1_epi32(int(_param.srcH) - (nearest ? 1 : 2));
+            if (_param.perspective)
+            {
+                size_t dx = 0;
+                for (; dx < dstWF; dx += F)
+                    EstimateRow16<true>(_ax.data + dx, _ay.data + dx, _aw.data + dx, cx, cy, cw, maxX, maxY, scale, lastX, lastY, shift, _fx.data + dx, _fy.data + dx, _in.data + dx);
+                if (tail)
+                    EstimateRow16<true>(_ax.data + dx, _ay.data + dx, _aw.data + dx, cx, cy, cw, maxX, maxY, scale, lastX, lastY, shift, _fx.data + dx, _fy.data + dx, _in.data + dx, tail);
+            }
+            else
+            {
+                size_t dx = 0;
+                for (; dx < dstWF; dx += F)
+                    EstimateRow16<false>(_ax.data + dx, _ay.data + dx, NULL, cx, cy, cw, maxX, maxY, scale, lastX, lastY, shift, _fx.data + dx, _fy.data + dx, _in.data + dx);
+                if (tail)
+                    EstimateRow16<false>(_ax.data + dx, _ay.data + dx, NULL, cx, cy, cw, maxX, maxY, scale, lastX, lastY, shift, _fx.data + dx, _fy.data + dx, _in.data + dx, tail);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void InterpolateBilinear1(const uint8_t * src, size_t srcStride, int fx, int fy, uint8_t * dst)
+        {
+            const uint8_t * s0 = src + (fy >> Base::WARP_SHIFT) * srcStride + (fx >> Base::WARP_SHIFT), * s1 = s0 + srcStride;
+            int ax1 = fx & (Base::WARP_RANGE - 1), ax0 = Base::WARP_RANGE - ax1;
+            int ay1 = fy & (Base::WARP_RANGE - 1), ay0 = Base::WARP_RANGE - ay1;
+            dst[0] = (uint8_t)(((s0[0] * ax0 + s0[1] * ax1) * ay0 + (s1[0] * ax0 + s1[1] * ax1) * ay1 + Base::WARP_ROUND) >> 2 * Base::WARP_SHIFT);
+        }
+
+        SIMD_INLINE __m512i LoadPair(const uint8_t * src, const int32_t * offset)
+        {
+            return _mm512_setr_epi32(
+                *(uint16_t*)(src + offset[0x0]), *(uint16_t*)(src + offset[0x1]), *(uint16_t*)(src + offset[0x2]), *(uint16_t*)(src + offset[0x3]),
+                *(uint16_t*)(src + offset[0x4]), *(uint16_t*)(src + offset[0x5]), *(uint16_t*)(src + offset[0x6]), *(uint16_t*)(src + offset[0x7]),
+                *(uint16_t*)(src + offset[0x8]), *(uint16_t*)(src + offset[0x9]), *(uint16_t*)(src + offset[0xA]), *(uint16_t*)(src + offset[0xB]),
+                *(uint16_t*)(src + offset[0xC]), *(uint16_t*)(src + offset[0xD]), *(uint16_t*)(src + offset[0xE]), *(uint16_t*)(src + offset[0xF]));
+        }
+
+        SIMD_INLINE void InterpolateBilinear16x1(const uint8_t * src, size_t srcStride, const int32_t * fx, const int32_t * fy, uint8_t * dst)
+        {
+            const __m512i K16_00FF = _mm512_set1_epi32(0x00FF);
+            const __m512i K32_FF00 = _mm512_set1_epi32(0xFF00);
+            const __m512i RANGE = _mm512_set1_epi32(Base::WARP_RANGE);
+            const __m512i MASK = _mm512_set1_epi32(Base::WARP_RANGE - 1);
+            __m512i _fx = _mm512_loadu_si512((__m512i*)fx);
+            __m512i _fy = _mm512_loadu_si512((__m512i*)fy);
+            SIMD_ALIGNED(64) int32_t offset[F];
+            __m512i ix = _mm512_srai_epi32(_fx, Base::WARP_SHIFT), iy = _mm512_srai_epi32(_fy, Base::WARP_SHIFT);
+            _mm512_store_si512((__m512i*)offset, _mm512_add_epi32(_mm512_mullo_epi32(iy, _mm512_set1_epi32((int32_t)srcStride)), ix));
+            __m512i p0 = LoadPair(src, offset), p1 = LoadPair(src + srcStride, offset);
+            p0 = _mm512_or_si512(_mm512_and_si512(p0, K16_00FF), _mm512_slli_epi32(_mm512_and_si512(p0, K32_FF00), 8));
+            p1 = _mm512_or_si512(_mm512_and_si512(p1, K16_00FF), _mm512_slli_epi32(_mm512_and_si512(p1, K32_FF00), 8));
+            __m512i ax1 = _mm512_and_si512(_fx, MASK), ax = _mm512_or_si512(_mm512_sub_epi32(RANGE, ax1), _mm512_slli_epi32(ax1, 16));
+            __m512i ay1 = _mm512_and_si512(_fy, MASK), ay0 = _mm512_sub_epi32(RANGE, ay1);
+            __m512i r0 = _mm512_mullo_epi32(_mm512_madd_epi16(p0, ax), ay0);
+            __m512i r1 = _mm512_mullo_epi32(_mm512_madd_epi16(p1, ax), ay1);
+            __m512i d = _mm512_srli_epi32(_mm512_add_epi32(_mm512_add_epi32(r0, r1), _mm512_set1_epi32(Base::WARP_ROUND)), 2 * Base::WARP_SHIFT);
+            _mm_storeu_si128((__m128i*)dst, _mm512_cvtepi32_epi8(d));
+        }
+
+        void WarpByte::InterpolateRow(const uint8_t * src, size_t srcStride, uint8_t * dst)
+        {
+            if (_param.IsNearest() || _param.channels != 1)
+            {
+                Avx2::WarpByte::InterpolateRow(src, srcStride, dst);
+                return;
+            }
+            bool transparent = _param.Border() == SimdWarpBorderTransparent;
+            for (size_t dx = 0, dstW = _param.dstW; dx < dstW; )
+            {
+                if (dx + F <= dstW && _mm_movemask_epi8(_mm_loadu_si128((__m128i*)(_in.data + dx))) == 0xFFFF)
+                {
+                    InterpolateBilinear16x1(src, srcStride, _fx.data + dx, _fy.data + dx, dst + dx);
+                    dx += F;
+                }
+                else
+                {
+                    if (_in[dx])
+                        InterpolateBilinear1(src, srcStride, _fx[dx], _fy[dx], dst + dx);
+                    else if (!transparent)
+                        InterpolateBorder(src, srcStride, dx, dst + dx);
+                    dx += 1;
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, mat, false, flags, border, A);
+            if (!param.valid)
+                return NULL;
+            return new WarpByte(param);
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, mat, true, flags, border, A);
+            if (!param.valid)
+                return NULL;
+            return new WarpByte(param);
+        }
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
@@ -167,11 +167,65 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Base::ResizerFloatFilter(param)
+        {
+        }
+
+        SIMD_INLINE void ResizerFloatFilterRowV16(const float * src, size_t srcStride, const float * ay, size_t ky, float * dst, __mmask16 tail = -1)
+        {
+            __m512 sum = _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, src), _mm512_set1_ps(ay[0]));
+            for (size_t k = 1; k < ky; ++k)
+                sum = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail, src + k * srcStride), _mm512_set1_ps(ay[k]), sum);
+            _mm512_mask_storeu_ps(dst, tail, sum);
+        }
+
+        void ResizerFloatFilter::RunV(const float * src, size_t srcStride, size_t dy, float * dst)
+        {
+            size_t size = _param.srcW * _param.channels, sizeF = AlignLo(size, F);
+            const float * ay = _ay.data + dy * _ky;
+            __mmask16 tail = TailMask16(size - sizeF);
+            size_t x = 0;
+            for (; x < sizeF; x += F)
+                ResizerFloatFilterRowV16(src + x, srcStride, ay, _ky, dst + x);
+            if (x < size)
+                ResizerFloatFilterRowV16(src + x, srcStride, ay, _ky, dst + x, tail);
+        }
+
+        SIMD_INLINE void ResizerFloatFilterRowH16(const float * src, const int32_t * ix, const float * ax, size_t kx, size_t cn, size_t rs, float * dst, __mmask16 tail = -1)
+        {
+            __m512i idx = _mm512_maskz_loadu_epi32(tail, ix);
+            __m512i step = _mm512_set1_epi32((int32_t)cn);
+            __m512 sum = _mm512_setzero_ps();
+            for (size_t k = 0; k < kx; ++k, ax += rs)
+            {
+                __m512 s = _mm512_mask_i32gather_ps(_mm512_setzero_ps(), tail, idx, src, 4);
+                sum = _mm512_fmadd_ps(s, _mm512_maskz_loadu_ps(tail, ax), sum);
+                idx = _mm512_add_epi32(idx, step);
+            }
+            _mm512_mask_storeu_ps(dst, tail, sum);
+        }
+
+        void ResizerFloatFilter::RunH(const float * src, float * dst)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn, rsF = AlignLo(rs, F);
+            __mmask16 tail = TailMask16(rs - rsF);
+            size_t dx = 0;
+            for (; dx < rsF; dx += F)
+                ResizerFloatFilterRowH16(src, _ix.data + dx, _ax.data + dx, _kx, cn, rs, dst + dx);
+            if (dx < rs)
+                ResizerFloatFilterRowH16(src, _ix.data + dx, _ax.data + dx, _kx, cn, rs, dst + dx, tail);
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(__m512));
             if (param.IsFloatBilinear())
                 return new ResizerFloatBilinear(param);
+            else if (param.IsFloatFilter())
+                return new ResizerFloatFilter(param);
             else
                 return Avx2::ResizerInit(srcX, srcY, dstX, dstY, channels, type, method);
         }
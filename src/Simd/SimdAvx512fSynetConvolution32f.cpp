@@ -452,6 +452,36 @@ namespace Simd
         SynetConvolution32fGemmNN::SynetConvolution32fGemmNN(const ConvParam32f & p)
             : Avx2::SynetConvolution32fGemmNN(p)
         {
+            SetEdges();
+            if (p.dstC == 8)
+                return;
+            _gemm.Init(InitGemmFuncs(Avx512f::Gemm32fNN, "Avx512f", p.gemm, "Ext"));
+            if (_param.trans && _param.group == 1)
+            {
+                if (GemmRuntime())
+                {
+                    _gemmCb.Init(InitGemmCbFuncs(Avx512f::Gemm32fNNcbBufferSize, Avx512f::Gemm32fNNcbReorderB, Avx512f::Gemm32fNNcbRun, "Avx512f", GemmKernelF2, GemmKernelF3));
+                    _nhwcWeight.Resize(_gemmCb.At(0).BufferSize(_M*_merge, _N, _K));
+                }
+                else
+                    _nhwcWeight.Resize(Avx512f::Gemm32fNNcbBufferSize(_M*_merge, _N, _K, GemmKernelAny, NHWC_GEMM_COMPATIBLE));
+                _nhwcRun = Avx512f::Gemm32fNNcbRun;
+                _nhwcReorderB = Avx512f::Gemm32fNNcbReorderB;
+            }
+            _biasAndActivation = _N > Avx::F ? Avx512f::ConvolutionBiasAndActivation : Avx::ConvolutionBiasAndActivation;
+        }
+
+        bool SynetConvolution32fGemmNN::Reshape(size_t srcH, size_t srcW)
+        {
+            if (!Avx2::SynetConvolution32fGemmNN::Reshape(srcH, srcW))
+                return false;
+            SetEdges();
+            return true;
+        }
+
+        void SynetConvolution32fGemmNN::SetEdges()
+        {
+            const ConvParam32f & p = _param;
             _index.Resize(F);
             for (size_t i = 0; i < F; ++i)
                 _index[i] = int(i * p.strideX);
@@ -472,22 +502,6 @@ namespace Simd
                     sx += p.strideX;
                 }
             }
-            if (p.dstC == 8)
-                return;
-            _gemm.Init(InitGemmFuncs(Avx512f::Gemm32fNN, "Avx512f", p.gemm, "Ext"));
-            if (_param.trans && _param.group == 1)
-            {
-                if (GemmRuntime())
-                {
-                    _gemmCb.Init(InitGemmCbFuncs(Avx512f::Gemm32fNNcbBufferSize, Avx512f::Gemm32fNNcbReorderB, Avx512f::Gemm32fNNcbRun, "Avx512f", GemmKernelF2, GemmKernelF3));
-                    _nhwcWeight.Resize(_gemmCb.At(0).BufferSize(_M*_merge, _N, _K));
-                }
-                else
-                    _nhwcWeight.Resize(Avx512f::Gemm32fNNcbBufferSize(_M*_merge, _N, _K, GemmKernelAny, NHWC_GEMM_COMPATIBLE));
-                _nhwcRun = Avx512f::Gemm32fNNcbRun;
-                _nhwcReorderB = Avx512f::Gemm32fNNcbReorderB;
-            }
-            _biasAndActivation = _N > Avx::F ? Avx512f::ConvolutionBiasAndActivation : Avx::ConvolutionBiasAndActivation;
         }
 
         void SynetConvolution32fGemmNN::ImgToCol(const float * src, float * dst)
@@ -573,6 +587,15 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        bool SynetConvolution32fWinograd::Block6x6Preferable(const ConvParam32f & p)
+        {
+            if (!p.trans || p.dstH < 12 || p.dstW < 12 || p.srcC < 32)
+                return false;
+            size_t cost4x4 = DivHi(p.dstH, 4) * DivHi(p.dstW, 4) * 36;
+            size_t cost6x6 = DivHi(p.dstH, 6) * DivHi(p.dstW, 6) * 64;
+            return cost6x6 < cost4x4;
+        }
+
         SynetConvolution32fWinograd::SynetConvolution32fWinograd(const ConvParam32f & p)
             : Avx2::SynetConvolution32fWinograd(p)
         {
@@ -617,7 +640,14 @@ namespace Simd
             }
             else if (p.kernelY == 3 && p.kernelX == 3)
             {
-                if (_blockY == 4 && _blockX == 4)
+                if (_blockY == 4 && _blockX == 4 && Block6x6Preferable(p))
+                {
+                    SetBlock(6, 6);
+                    _setFilter = Avx512f::WinogradKernel3x3Block6x6SetFilter;
+                    _setInput = Avx512f::WinogradKernel3x3Block6x6SetInput;
+                    _setOutput = Avx512f::WinogradKernel3x3Block6x6SetOutput;
+                }
+                else if (_blockY == 4 && _blockX == 4)
                 {
                     _setFilter = Avx512f::WinogradKernel3x3Block4x4SetFilter;
                     _setInput = Avx512f::WinogradKernel3x3Block4x4SetInput;
@@ -2404,20 +2434,23 @@ namespace Simd
             ConvParam32f param(batch, conv, gemm);
             if (!param.Valid())
                 return NULL;
-            else if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
-                return new Avx::SynetConvolution32fDepthwiseDotProduct(param);
-            else if (SynetConvolution32fWinograd::Preferable(param))
-                return new SynetConvolution32fWinograd(param);
-            else if (SynetConvolution32fGemmNT::Preferable(param))
-                return new SynetConvolution32fGemmNT(param);
-            else if (SynetConvolution32fDirectNchw::Preferable(param))
-                return new Avx512f::SynetConvolution32fDirectNchw(param);
-            else if (SynetConvolution32fNhwcDirect::Preferable(param))
-                return new SynetConvolution32fNhwcDirect(param);
-            else if (SynetConvolution32fDirectNhwc::Preferable(param))
-                return new SynetConvolution32fDirectNhwc(param);
-            else
-                return new SynetConvolution32fGemmNN(param);
+            Base::SynetConvolution32fCandidates candidates(param, "Avx512f");
+            if (Avx::SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+                candidates.Add<Avx::SynetConvolution32fDepthwiseDotProduct>("DepthwiseDotProduct");
+            if (SynetConvolution32fWinograd::Preferable(param))
+                candidates.Add<SynetConvolution32fWinograd>("Winograd");
+            if (SynetConvolution32fGemmNT::Preferable(param))
+                candidates.Add<SynetConvolution32fGemmNT>("GemmNT");
+            if (SynetConvolution32fDirectNchw::Preferable(param))
+                candidates.Add<Avx512f::SynetConvolution32fDirectNchw>("DirectNchw");
+            if (SynetConvolution32fNhwcDirect::Preferable(param))
+                candidates.Add<SynetConvolution32fNhwcDirect>("NhwcDirect");
+            if (SynetConvolution32fDirectNhwc::Preferable(param))
+                candidates.Add<SynetConvolution32fDirectNhwc>("DirectNhwc");
+            candidates.Add<SynetConvolution32fGemmNN>("GemmNN");
+            if (SynetConvolution32fSparse::Preferable(param))
+                return new SynetConvolution32fSparse(param, (SynetConvolution32f*)candidates.Select());
+            return candidates.Select();
         }
     }
 #endif//SIMD_AVX512F_ENABLE
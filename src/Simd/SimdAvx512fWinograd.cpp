@@ -2972,6 +2972,319 @@ namespace Simd
                 Base::WinogradKernel3x3Block4x4SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
             }
         }
+
+        //-----------------------------------------------------------------------
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetFilter3(const __m512 * src, size_t srcStep, __m512 * dst, size_t dstStep)
+        {
+            const __m512 mr2_9 = _mm512_set1_ps(-2.0f / 9.0f);
+            const __m512 r1_90 = _mm512_set1_ps(1.0f / 90.0f);
+            const __m512 r1_45 = _mm512_set1_ps(1.0f / 45.0f);
+            const __m512 r2_45 = _mm512_set1_ps(2.0f / 45.0f);
+            const __m512 r32_45 = _mm512_set1_ps(32.0f / 45.0f);
+            const __m512 r16_45 = _mm512_set1_ps(16.0f / 45.0f);
+            const __m512 r8_45 = _mm512_set1_ps(8.0f / 45.0f);
+            __m512 s0 = src[0 * srcStep];
+            __m512 s1 = src[1 * srcStep];
+            __m512 s2 = src[2 * srcStep];
+            dst[0 * dstStep] = s0;
+            __m512 t0 = _mm512_add_ps(s0, s2);
+            dst[1 * dstStep] = _mm512_mul_ps(mr2_9, _mm512_add_ps(t0, s1));
+            dst[2 * dstStep] = _mm512_mul_ps(mr2_9, _mm512_sub_ps(t0, s1));
+            t0 = _mm512_fmadd_ps(r1_90, s0, _mm512_mul_ps(r2_45, s2));
+            __m512 t1 = _mm512_mul_ps(r1_45, s1);
+            dst[3 * dstStep] = _mm512_add_ps(t0, t1);
+            dst[4 * dstStep] = _mm512_sub_ps(t0, t1);
+            t0 = _mm512_fmadd_ps(r32_45, s0, _mm512_mul_ps(r8_45, s2));
+            t1 = _mm512_mul_ps(r16_45, s1);
+            dst[5 * dstStep] = _mm512_add_ps(t0, t1);
+            dst[6 * dstStep] = _mm512_sub_ps(t0, t1);
+            dst[7 * dstStep] = s2;
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetFilter16t(const float * src, float * dst, size_t stride, __mmask16 tail = -1)
+        {
+            __m512 s[9], t[24], d[64];
+            for (size_t i = 0; i < 9; ++i)
+                s[i] = _mm512_maskz_loadu_ps(tail, src + i * stride);
+            for (size_t col = 0; col < 3; ++col)
+                WinogradKernel3x3Block6x6SetFilter3(s + col, 3, t + col, 3);
+            for (size_t row = 0; row < 8; ++row)
+                WinogradKernel3x3Block6x6SetFilter3(t + row * 3, 1, d + row * 8, 1);
+            for (size_t i = 0; i < 64; ++i)
+                _mm512_mask_storeu_ps(dst + i * stride, tail, d[i]);
+        }
+
+        void WinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
+        {
+            if (trans)
+            {
+                size_t size16 = AlignLo(size, 16), i = 0;
+                for (; i < size16; i += 16)
+                    WinogradKernel3x3Block6x6SetFilter16t(src + i, dst + i, size);
+                if (i < size)
+                    WinogradKernel3x3Block6x6SetFilter16t(src + i, dst + i, size, TailMask16(size - i));
+            }
+            else
+            {
+                Base::WinogradKernel3x3Block6x6SetFilter(src, size, dst, trans);
+            }
+        }
+
+        //-----------------------------------------------------------------------
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput8(const __m512 * src, size_t srcStep, __m512 * dst, size_t dstStep)
+        {
+            const __m512 _0_25 = _mm512_set1_ps(0.25f);
+            const __m512 _0_5 = _mm512_set1_ps(0.5f);
+            const __m512 _1_25 = _mm512_set1_ps(1.25f);
+            const __m512 _2 = _mm512_set1_ps(2.0f);
+            const __m512 _2_5 = _mm512_set1_ps(2.5f);
+            const __m512 _4 = _mm512_set1_ps(4.0f);
+            const __m512 _4_25 = _mm512_set1_ps(4.25f);
+            const __m512 _5 = _mm512_set1_ps(5.0f);
+            const __m512 _5_25 = _mm512_set1_ps(5.25f);
+            __m512 s0 = src[0 * srcStep];
+            __m512 s1 = src[1 * srcStep];
+            __m512 s2 = src[2 * srcStep];
+            __m512 s3 = src[3 * srcStep];
+            __m512 s4 = src[4 * srcStep];
+            __m512 s5 = src[5 * srcStep];
+            __m512 s6 = src[6 * srcStep];
+            __m512 s7 = src[7 * srcStep];
+            dst[0 * dstStep] = _mm512_fmadd_ps(_5_25, _mm512_sub_ps(s4, s2), _mm512_sub_ps(s0, s6));
+            __m512 a = _mm512_fnmadd_ps(_4_25, s3, _mm512_add_ps(s1, s5));
+            __m512 b = _mm512_fnmadd_ps(_4_25, s4, _mm512_add_ps(s2, s6));
+            dst[1 * dstStep] = _mm512_add_ps(b, a);
+            dst[2 * dstStep] = _mm512_sub_ps(b, a);
+            a = _mm512_fmadd_ps(_2, s5, _mm512_fnmadd_ps(_2_5, s3, _mm512_mul_ps(_0_5, s1)));
+            b = _mm512_add_ps(s6, _mm512_fnmadd_ps(_1_25, s4, _mm512_mul_ps(_0_25, s2)));
+            dst[3 * dstStep] = _mm512_add_ps(b, a);
+            dst[4 * dstStep] = _mm512_sub_ps(b, a);
+            a = _mm512_fmadd_ps(_0_5, s5, _mm512_fnmadd_ps(_2_5, s3, _mm512_mul_ps(_2, s1)));
+            b = _mm512_add_ps(s6, _mm512_fnmadd_ps(_5, s4, _mm512_mul_ps(_4, s2)));
+            dst[5 * dstStep] = _mm512_add_ps(b, a);
+            dst[6 * dstStep] = _mm512_sub_ps(b, a);
+            dst[7 * dstStep] = _mm512_fmadd_ps(_5_25, _mm512_sub_ps(s3, s5), _mm512_sub_ps(s7, s1));
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput16Store(const __m512 src[64], float * dst, size_t stride, __mmask16 tail = -1)
+        {
+            __m512 t[64], d[8];
+            for (size_t col = 0; col < 8; ++col)
+                WinogradKernel3x3Block6x6SetInput8(src + col, 8, t + col, 8);
+            for (size_t row = 0; row < 8; ++row)
+            {
+                WinogradKernel3x3Block6x6SetInput8(t + row * 8, 1, d, 1);
+                for (size_t col = 0; col < 8; ++col)
+                    _mm512_mask_storeu_ps(dst + (row * 8 + col) * stride, tail, d[col]);
+            }
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput16t(const float * src, size_t srcS, size_t srcC, __m512 dst[64], __mmask16 tail = -1)
+        {
+            for (size_t row = 0; row < 8; ++row)
+                for (size_t col = 0; col < 8; ++col)
+                    dst[row * 8 + col] = _mm512_maskz_loadu_ps(tail, src + row * srcS + col * srcC);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput16t(const float * src, size_t srcW, size_t srcC, float * dst, size_t dstStride)
+        {
+            size_t srcS = srcW * srcC;
+            size_t srcCF = AlignLo(srcC, F);
+            size_t c = 0;
+            for (; c < srcCF; c += F)
+            {
+                __m512 tmp[64];
+                WinogradKernel3x3Block6x6SetInput16t(src + c, srcS, srcC, tmp);
+                WinogradKernel3x3Block6x6SetInput16Store(tmp, dst + c, dstStride);
+            }
+            if (c < srcC)
+            {
+                __mmask16 tail = TailMask16(srcC - c);
+                __m512 tmp[64];
+                WinogradKernel3x3Block6x6SetInput16t(src + c, srcS, srcC, tmp, tail);
+                WinogradKernel3x3Block6x6SetInput16Store(tmp, dst + c, dstStride, tail);
+            }
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput16t(const float * src, size_t srcS, size_t srcC, size_t rowB, size_t rowE, size_t colB, size_t colE, __m512 * dst, __mmask16 tail = -1)
+        {
+            for (size_t row = 0; row < 8; ++row)
+            {
+                for (size_t col = 0; col < 8; ++col)
+                {
+                    if (row >= rowB && row < rowE && col >= colB && col < colE)
+                        dst[col] = _mm512_maskz_loadu_ps(tail, src + row * srcS + col * srcC);
+                    else
+                        dst[col] = _mm512_setzero_ps();
+                }
+                dst += 8;
+            }
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput16t(const float * src, size_t srcW, size_t srcC, size_t rowB, size_t rowE, size_t colB, size_t colE, float * dst, size_t dstStride)
+        {
+            size_t srcS = srcW * srcC;
+            size_t srcCF = AlignLo(srcC, F);
+            size_t c = 0;
+            for (; c < srcCF; c += F)
+            {
+                __m512 tmp[64];
+                WinogradKernel3x3Block6x6SetInput16t(src + c, srcS, srcC, rowB, rowE, colB, colE, tmp);
+                WinogradKernel3x3Block6x6SetInput16Store(tmp, dst + c, dstStride);
+            }
+            if (c < srcC)
+            {
+                __mmask16 tail = TailMask16(srcC - c);
+                __m512 tmp[64];
+                WinogradKernel3x3Block6x6SetInput16t(src + c, srcS, srcC, rowB, rowE, colB, colE, tmp, tail);
+                WinogradKernel3x3Block6x6SetInput16Store(tmp, dst + c, dstStride, tail);
+            }
+        }
+
+        void WinogradKernel3x3Block6x6SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
+            size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
+        {
+            if (trans)
+            {
+                assert(padY + padH <= 2 && padX + padW <= 2);
+                size_t dstH = srcHeight - 2 + padY + padH;
+                size_t dstW = srcWidth - 2 + padX + padW;
+                size_t dstH6 = dstH / 6 * 6;
+                size_t dstW6 = dstW / 6 * 6;
+                size_t noseW = Simd::Min<size_t>(8, srcWidth + padX);
+                size_t noseH = Simd::Min<size_t>(8, srcHeight + padY);
+                size_t startY = padY ? 6 : 0;
+                size_t startX = padX ? 6 : 0;
+                if (padH && dstH == dstH6)
+                    dstH6 -= 6;
+                if (padY)
+                    src -= srcWidth * srcChannels;
+                if (padW && dstW == dstW6)
+                    dstW6 -= 6;
+                if (padX)
+                    src -= srcChannels;
+                size_t tailW = dstW - dstW6 + (padW ? 1 : 2);
+                size_t tailH = dstH - dstH6 + (padH ? 1 : 2);
+                size_t row = 0, col = 0;
+                if (padY)
+                {
+                    if (padX)
+                        WinogradKernel3x3Block6x6SetInput16t(src, srcWidth, srcChannels, 1, noseH, 1, noseW, dst, dstStride), dst += srcChannels;
+                    for (col = startX; col < dstW6; col += 6)
+                        WinogradKernel3x3Block6x6SetInput16t(src + col * srcChannels, srcWidth, srcChannels, 1, noseH, 0, 8, dst, dstStride), dst += srcChannels;
+                    if (col < dstW)
+                        WinogradKernel3x3Block6x6SetInput16t(src + col * srcChannels, srcWidth, srcChannels, 1, noseH, 0, tailW, dst, dstStride), dst += srcChannels;
+                }
+                for (row = startY; row < dstH6; row += 6)
+                {
+                    if (padX)
+                        WinogradKernel3x3Block6x6SetInput16t(src + row * srcWidth * srcChannels, srcWidth, srcChannels, 0, 8, 1, noseW, dst, dstStride), dst += srcChannels;
+                    for (col = startX; col < dstW6; col += 6)
+                        WinogradKernel3x3Block6x6SetInput16t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, dst, dstStride), dst += srcChannels;
+                    if (col < dstW)
+                        WinogradKernel3x3Block6x6SetInput16t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, 0, 8, 0, tailW, dst, dstStride), dst += srcChannels;
+                }
+                if (row < dstH)
+                {
+                    if (padX)
+                        WinogradKernel3x3Block6x6SetInput16t(src + row * srcWidth * srcChannels, srcWidth, srcChannels, 0, tailH, 1, noseW, dst, dstStride), dst += srcChannels;
+                    for (col = startX; col < dstW6; col += 6)
+                        WinogradKernel3x3Block6x6SetInput16t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, 0, tailH, 0, 8, dst, dstStride), dst += srcChannels;
+                    if (col < dstW)
+                        WinogradKernel3x3Block6x6SetInput16t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, 0, tailH, 0, tailW, dst, dstStride), dst += srcChannels;
+                }
+            }
+            else
+            {
+                Base::WinogradKernel3x3Block6x6SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+            }
+        }
+
+        //-----------------------------------------------------------------------
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutput8(const __m512 * src, size_t srcStep, __m512 * dst, size_t dstStep)
+        {
+            const __m512 _0_5 = _mm512_set1_ps(0.5f);
+            const __m512 _0_25 = _mm512_set1_ps(0.25f);
+            const __m512 _0_125 = _mm512_set1_ps(0.125f);
+            const __m512 _0_0625 = _mm512_set1_ps(0.0625f);
+            const __m512 _0_03125 = _mm512_set1_ps(0.03125f);
+            const __m512 _2 = _mm512_set1_ps(2.0f);
+            const __m512 _4 = _mm512_set1_ps(4.0f);
+            const __m512 _8 = _mm512_set1_ps(8.0f);
+            const __m512 _16 = _mm512_set1_ps(16.0f);
+            const __m512 _32 = _mm512_set1_ps(32.0f);
+            __m512 a1 = _mm512_add_ps(src[1 * srcStep], src[2 * srcStep]);
+            __m512 b1 = _mm512_sub_ps(src[1 * srcStep], src[2 * srcStep]);
+            __m512 a2 = _mm512_add_ps(src[3 * srcStep], src[4 * srcStep]);
+            __m512 b2 = _mm512_sub_ps(src[3 * srcStep], src[4 * srcStep]);
+            __m512 a3 = _mm512_add_ps(src[5 * srcStep], src[6 * srcStep]);
+            __m512 b3 = _mm512_sub_ps(src[5 * srcStep], src[6 * srcStep]);
+            dst[0 * dstStep] = _mm512_add_ps(_mm512_add_ps(src[0 * srcStep], a1), _mm512_add_ps(a2, a3));
+            dst[1 * dstStep] = _mm512_fmadd_ps(_0_5, b3, _mm512_fmadd_ps(_2, b2, b1));
+            dst[2 * dstStep] = _mm512_fmadd_ps(_0_25, a3, _mm512_fmadd_ps(_4, a2, a1));
+            dst[3 * dstStep] = _mm512_fmadd_ps(_0_125, b3, _mm512_fmadd_ps(_8, b2, b1));
+            dst[4 * dstStep] = _mm512_fmadd_ps(_0_0625, a3, _mm512_fmadd_ps(_16, a2, a1));
+            dst[5 * dstStep] = _mm512_add_ps(_mm512_fmadd_ps(_0_03125, b3, _mm512_fmadd_ps(_32, b2, b1)), src[7 * srcStep]);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutputLoad64(const float * src, size_t stride, __m512 dst[36], __mmask16 tail = -1)
+        {
+            __m512 s[64], t[48];
+            for (size_t i = 0; i < 64; ++i)
+                s[i] = _mm512_maskz_loadu_ps(tail, src + i * stride);
+            for (size_t col = 0; col < 8; ++col)
+                WinogradKernel3x3Block6x6SetOutput8(s + col, 8, t + col, 8);
+            for (size_t row = 0; row < 6; ++row)
+                WinogradKernel3x3Block6x6SetOutput8(t + row * 8, 1, dst + row * 6, 1);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutputStore36(const __m512 src[36], float * dst, size_t dstS, size_t dstC, size_t rowE, size_t colE, __mmask16 tail = -1)
+        {
+            for (size_t row = 0; row < rowE; ++row)
+                for (size_t col = 0; col < colE; ++col)
+                    _mm512_mask_storeu_ps(dst + row * dstS + col * dstC, tail, src[row * 6 + col]);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutputT(const float * src, size_t srcStride, float * dst, size_t dstW, size_t dstC, size_t rowE, size_t colE)
+        {
+            size_t dstS = dstW * dstC, dstCF = AlignLo(dstC, F), d = 0;
+            for (; d < dstCF; d += F)
+            {
+                __m512 tmp[36];
+                WinogradKernel3x3Block6x6SetOutputLoad64(src + d, srcStride, tmp);
+                WinogradKernel3x3Block6x6SetOutputStore36(tmp, dst + d, dstS, dstC, rowE, colE);
+            }
+            if (d < dstC)
+            {
+                __mmask16 tail = TailMask16(dstC - d);
+                __m512 tmp[36];
+                WinogradKernel3x3Block6x6SetOutputLoad64(src + d, srcStride, tmp, tail);
+                WinogradKernel3x3Block6x6SetOutputStore36(tmp, dst + d, dstS, dstC, rowE, colE, tail);
+            }
+        }
+
+        void WinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
+        {
+            if (trans)
+            {
+                for (size_t row = 0; row < dstHeight; row += 6)
+                {
+                    size_t rowE = Simd::Min<size_t>(6, dstHeight - row);
+                    for (size_t col = 0; col < dstWidth; col += 6)
+                    {
+                        size_t colE = Simd::Min<size_t>(6, dstWidth - col);
+                        WinogradKernel3x3Block6x6SetOutputT(src, srcStride, dst + (row * dstWidth + col) * dstChannels, dstWidth, dstChannels, rowE, colE), src += dstChannels;
+                    }
+                }
+            }
+            else
+            {
+                Base::WinogradKernel3x3Block6x6SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+            }
+        }
     }
 #endif// SIMD_AVX512F_ENABLE
 }
@@ -0,0 +1,122 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBFloat16_h__
+#define __SimdBFloat16_h__
+
+#include "Simd/SimdConst.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        union Bf16Bits
+        {
+            float f32;
+            uint32_t u32;
+        };
+
+        SIMD_INLINE uint16_t Float32ToBFloat16(float value)
+        {
+            Bf16Bits bits;
+            bits.f32 = value;
+            if ((bits.u32 & 0x7FFFFFFF) > 0x7F800000)
+                return uint16_t((bits.u32 >> 16) | 0x0040);
+            return uint16_t((bits.u32 + 0x7FFF + ((bits.u32 >> 16) & 1)) >> 16);
+        }
+
+        SIMD_INLINE float BFloat16ToFloat32(uint16_t value)
+        {
+            Bf16Bits bits;
+            bits.u32 = uint32_t(value) << 16;
+            return bits.f32;
+        }
+
+        SIMD_INLINE float RoundToBFloat16(float value)
+        {
+            return BFloat16ToFloat32(Float32ToBFloat16(value));
+        }
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K32_BF16_ROUND = SIMD_MM256_SET1_EPI32(0x00007FFF);
+        const __m256i K32_BF16_ODD = SIMD_MM256_SET1_EPI32(0xFFFF0000);
+        const __m256i K32_BF16_ABS = SIMD_MM256_SET1_EPI32(0x7FFFFFFF);
+        const __m256i K32_BF16_INF = SIMD_MM256_SET1_EPI32(0x7F800000);
+        const __m256i K32_BF16_QNAN = SIMD_MM256_SET1_EPI32(0x00000040);
+
+        SIMD_INLINE __m256i Float32ToBFloat16(__m256 value)
+        {
+            __m256i bits = _mm256_castps_si256(value);
+            __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), K32_00000001);
+            __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(bits, K32_BF16_ROUND), lsb), 16);
+            __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(bits, K32_BF16_ABS), K32_BF16_INF);
+            __m256i quiet = _mm256_or_si256(_mm256_srli_epi32(bits, 16), K32_BF16_QNAN);
+            return _mm256_blendv_epi8(rounded, quiet, nan);
+        }
+
+        SIMD_INLINE __m256 BFloat16ToFloat32(__m256i value)
+        {
+            return _mm256_castsi256_ps(_mm256_slli_epi32(value, 16));
+        }
+
+        SIMD_INLINE __m256 BFloat16EvenToFloat32(__m256i pairs)
+        {
+            return _mm256_castsi256_ps(_mm256_slli_epi32(pairs, 16));
+        }
+
+        SIMD_INLINE __m256 BFloat16OddToFloat32(__m256i pairs)
+        {
+            return _mm256_castsi256_ps(_mm256_and_si256(pairs, K32_BF16_ODD));
+        }
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K32_BF16_ROUND = SIMD_MM512_SET1_EPI32(0x00007FFF);
+        const __m512i K32_BF16_ABS = SIMD_MM512_SET1_EPI32(0x7FFFFFFF);
+        const __m512i K32_BF16_INF = SIMD_MM512_SET1_EPI32(0x7F800000);
+        const __m512i K32_BF16_QNAN = SIMD_MM512_SET1_EPI32(0x00000040);
+
+        SIMD_INLINE __m512i Float32ToBFloat16(__m512 value)
+        {
+            __m512i bits = _mm512_castps_si512(value);
+            __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), K32_00000001);
+            __m512i rounded = _mm512_srli_epi32(_mm512_add_epi32(_mm512_add_epi32(bits, K32_BF16_ROUND), lsb), 16);
+            __mmask16 nan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(bits, K32_BF16_ABS), K32_BF16_INF);
+            return _mm512_mask_or_epi32(rounded, nan, _mm512_srli_epi32(bits, 16), K32_BF16_QNAN);
+        }
+
+        SIMD_INLINE __m512 BFloat16ToFloat32(__m512i value)
+        {
+            return _mm512_castsi512_ps(_mm512_slli_epi32(value, 16));
+        }
+    }
+#endif
+}
+
+#endif//__SimdBFloat16_h__
@@ -0,0 +1,145 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<class T, SimdPixelFormatType format> SIMD_INLINE void PixelToYuv420(const uint8_t * src0, size_t srcStride, 
+            uint8_t * y0, size_t yStride, uint8_t * u, uint8_t * v)
+        {
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            const size_t bi = format == SimdPixelFormatRgb24 ? 2 : 0, gi = 1, ri = 2 - bi;
+            const uint8_t * src1 = src0 + srcStride;
+            uint8_t * y1 = y0 + yStride;
+
+            y0[0] = BgrToY<T>(src0[bi], src0[gi], src0[ri]);
+            y0[1] = BgrToY<T>(src0[size + bi], src0[size + gi], src0[size + ri]);
+            y1[0] = BgrToY<T>(src1[bi], src1[gi], src1[ri]);
+            y1[1] = BgrToY<T>(src1[size + bi], src1[size + gi], src1[size + ri]);
+
+            int blue = Average(src0[bi], src0[size + bi], src1[bi], src1[size + bi]);
+            int green = Average(src0[gi], src0[size + gi], src1[gi], src1[size + gi]);
+            int red = Average(src0[ri], src0[size + ri], src1[ri], src1[size + ri]);
+
+            u[0] = BgrToU<T>(blue, green, red);
+            v[0] = BgrToV<T>(blue, green, red);
+        }
+
+        template<class T, SimdPixelFormatType format> void PixelToYuv420(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, size_t uvStep)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colUV = 0, colY = 0, colSrc = 0; colY < width; colY += 2, colUV += uvStep, colSrc += 2 * size)
+                    PixelToYuv420<T, format>(src + colSrc, srcStride, y + colY, yStride, u + colUV, v + colUV);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                src += 2 * srcStride;
+            }
+        }
+
+        template<SimdPixelFormatType format> void PixelToYuv420(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, size_t uvStep, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: PixelToYuv420<Bt601, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride, uvStep); break;
+            case SimdYuvBt709: PixelToYuv420<Bt709, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride, uvStep); break;
+            case SimdYuvBt2020: PixelToYuv420<Bt2020, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride, uvStep); break;
+            case SimdYuvBt601Full: PixelToYuv420<Bt601Full, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride, uvStep); break;
+            case SimdYuvBt709Full: PixelToYuv420<Bt709Full, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride, uvStep); break;
+            case SimdYuvBt2020Full: PixelToYuv420<Bt2020Full, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride, uvStep); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420<SimdPixelFormatBgr24>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, 1, yuvType);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420<SimdPixelFormatBgra32>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, 1, yuvType);
+        }
+
+        void RgbToYuv420pV2(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420<SimdPixelFormatRgb24>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride, 1, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420<SimdPixelFormatBgr24>(bgr, width, height, bgrStride, y, yStride, uv + 0, uvStride, uv + 1, uvStride, 2, yuvType);
+        }
+
+        void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420<SimdPixelFormatBgra32>(bgra, width, height, bgraStride, y, yStride, uv + 0, uvStride, uv + 1, uvStride, 2, yuvType);
+        }
+
+        void RgbToNv12(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420<SimdPixelFormatRgb24>(rgb, width, height, rgbStride, y, yStride, uv + 0, uvStride, uv + 1, uvStride, 2, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        void BgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420<SimdPixelFormatBgr24>(bgr, width, height, bgrStride, y, yStride, vu + 1, vuStride, vu + 0, vuStride, 2, yuvType);
+        }
+
+        void BgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420<SimdPixelFormatBgra32>(bgra, width, height, bgraStride, y, yStride, vu + 1, vuStride, vu + 0, vuStride, 2, yuvType);
+        }
+
+        void RgbToNv21(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420<SimdPixelFormatRgb24>(rgb, width, height, rgbStride, y, yStride, vu + 1, vuStride, vu + 0, vuStride, 2, yuvType);
+        }
+    }
+}
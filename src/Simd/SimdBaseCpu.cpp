@@ -62,15 +62,15 @@ namespace Simd
     namespace Base
     {
 #if defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
-        bool CheckBit(Cpuid::Level level, Cpuid::Register index, Cpuid::Bit bit)
+        bool CheckBit(Cpuid::Level level, Cpuid::Register index, Cpuid::Bit bit, unsigned int subLevel)
         {
             unsigned int registers[4] = { 0, 0, 0, 0 };
 #if defined(_MSC_VER)
-            __cpuid((int*)registers, level);
+            __cpuidex((int*)registers, level, subLevel);
 #elif (defined __GNUC__)
             if (__get_cpuid_max(0, NULL) < level)
                 return false;
-            __cpuid_count(level, 0, 
+            __cpuid_count(level, subLevel, 
                 registers[Cpuid::Eax], 
                 registers[Cpuid::Ebx], 
                 registers[Cpuid::Ecx], 
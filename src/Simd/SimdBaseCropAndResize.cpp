@@ -0,0 +1,321 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdCropAndResize.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct CropResizeIndex
+        {
+            int32_t i0, i1, ia;
+            float fa;
+        };
+
+        SIMD_INLINE CropResizeIndex CropResizeCoord(float pos, size_t size)
+        {
+            CropResizeIndex index;
+            pos = Simd::RestrictRange(pos, 0.0f, float(size - 1));
+            index.i0 = (int32_t)::floor(pos);
+            index.i1 = Simd::Min(index.i0 + 1, (int32_t)size - 1);
+            index.fa = pos - index.i0;
+            index.ia = Round(index.fa * CROP_RESIZE_RANGE);
+            return index;
+        }
+
+        SIMD_INLINE void CropResizePixel(const uint8_t * src, size_t srcStride, size_t cn,
+            const CropResizeIndex & y, const CropResizeIndex & x, uint8_t * dst)
+        {
+            const uint8_t * s0 = src + y.i0 * srcStride, * s1 = src + y.i1 * srcStride;
+            size_t x0 = x.i0 * cn, x1 = x.i1 * cn;
+            int fx1 = x.ia, fx0 = CROP_RESIZE_RANGE - fx1;
+            int fy1 = y.ia, fy0 = CROP_RESIZE_RANGE - fy1;
+            for (size_t c = 0; c < cn; ++c)
+            {
+                int r0 = s0[x0 + c] * fy0 + s1[x0 + c] * fy1;
+                int r1 = s0[x1 + c] * fy0 + s1[x1 + c] * fy1;
+                dst[c] = (uint8_t)((r0 * fx0 + r1 * fx1 + CROP_RESIZE_ROUND) >> (2 * CROP_RESIZE_SHIFT));
+            }
+        }
+
+        SIMD_INLINE void CropResizePixel(const uint8_t * src, size_t srcStride, size_t cn,
+            const CropResizeIndex & y, const CropResizeIndex & x, float * dst)
+        {
+            const float * s0 = (const float*)(src + y.i0 * srcStride), * s1 = (const float*)(src + y.i1 * srcStride);
+            size_t x0 = x.i0 * cn, x1 = x.i1 * cn;
+            float fx1 = x.fa, fx0 = 1.0f - fx1;
+            float fy1 = y.fa, fy0 = 1.0f - fy1;
+            for (size_t c = 0; c < cn; ++c)
+            {
+                float r0 = s0[x0 + c] * fy0 + s1[x0 + c] * fy1;
+                float r1 = s0[x1 + c] * fy0 + s1[x1 + c] * fy1;
+                dst[c] = r0 * fx0 + r1 * fx1;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        static void CropResizeRowV(const uint8_t * src0, const uint8_t * src1, size_t size, int32_t alpha, uint16_t * dst)
+        {
+            int32_t alpha0 = CROP_RESIZE_RANGE - alpha;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = uint16_t(src0[i] * alpha0 + src1[i] * alpha);
+        }
+
+        static void CropResizeRowH(const uint16_t * src, const int32_t * index0, const int32_t * index1, const int32_t * alpha, size_t size, uint8_t * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = uint8_t((src[index0[i]] * (CROP_RESIZE_RANGE - alpha[i]) + src[index1[i]] * alpha[i] + CROP_RESIZE_ROUND) >> (2 * CROP_RESIZE_SHIFT));
+        }
+
+        static void CropResizeRowV(const float * src0, const float * src1, size_t size, float alpha, float * dst)
+        {
+            float alpha0 = 1.0f - alpha;
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = src0[i] * alpha0 + src1[i] * alpha;
+        }
+
+        static void CropResizeRowH(const float * src, const int32_t * index0, const int32_t * index1, const float * alpha, size_t size, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = src[index0[i]] * (1.0f - alpha[i]) + src[index1[i]] * alpha[i];
+        }
+
+        template<class T> struct CropResizeType;
+
+        template<> struct CropResizeType<uint8_t>
+        {
+            typedef uint16_t Buffer;
+            typedef int32_t Alpha;
+            typedef CropResizeRowV8uPtr RowV;
+            typedef CropResizeRowH8uPtr RowH;
+            static SIMD_INLINE Alpha Get(const CropResizeIndex & index) { return index.ia; }
+        };
+
+        template<> struct CropResizeType<float>
+        {
+            typedef float Buffer;
+            typedef float Alpha;
+            typedef CropResizeRowV32fPtr RowV;
+            typedef CropResizeRowH32fPtr RowH;
+            static SIMD_INLINE Alpha Get(const CropResizeIndex & index) { return index.fa; }
+        };
+
+        template<class T> void CropAndResizeBilinear(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels,
+            const SimdResizeRoi * rois, size_t count, size_t dstWidth, size_t dstHeight, typename CropResizeType<T>::RowV rowV, typename CropResizeType<T>::RowH rowH)
+        {
+            typedef typename CropResizeType<T>::Buffer B;
+            typedef typename CropResizeType<T>::Alpha A;
+            size_t dstSize = dstWidth * channels, bufSize = 0;
+            std::vector<int32_t> ib(count), is(count), ix0(count * dstSize), ix1(count * dstSize);
+            std::vector<A> ax(count * dstSize);
+            std::vector<CropResizeIndex> iy(count * dstHeight);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const SimdResizeRoi & roi = rois[i];
+                if (roi.affine)
+                    continue;
+                float scaleX = (roi.right - roi.left) / dstWidth;
+                float scaleY = (roi.bottom - roi.top) / dstHeight;
+                int32_t lo = int32_t(srcWidth), hi = 0;
+                for (size_t dx = 0; dx < dstWidth; ++dx)
+                {
+                    CropResizeIndex x = CropResizeCoord(roi.left + (dx + 0.5f) * scaleX - 0.5f, srcWidth);
+                    lo = Simd::Min(lo, x.i0);
+                    hi = Simd::Max(hi, x.i1);
+                    for (size_t c = 0, o = i * dstSize + dx * channels; c < channels; ++c, ++o)
+                    {
+                        ix0[o] = int32_t(x.i0 * channels + c);
+                        ix1[o] = int32_t(x.i1 * channels + c);
+                        ax[o] = CropResizeType<T>::Get(x);
+                    }
+                }
+                ib[i] = int32_t(lo * channels);
+                is[i] = int32_t((hi - lo + 1) * channels);
+                for (size_t o = i * dstSize, e = o + dstSize; o < e; ++o)
+                    ix0[o] -= ib[i], ix1[o] -= ib[i];
+                bufSize = Simd::Max(bufSize, size_t(is[i]));
+                for (size_t dy = 0; dy < dstHeight; ++dy)
+                    iy[i * dstHeight + dy] = CropResizeCoord(roi.top + (dy + 0.5f) * scaleY - 0.5f, srcHeight);
+            }
+            size_t threads = Base::GetThreadNumber(), bufStride = bufSize + 1;
+            std::vector<B> buf(threads * bufStride);
+            Simd::Parallel(0, count * dstHeight, [&](size_t thread, size_t begin, size_t end)
+            {
+                B * pBuf = buf.data() + thread * bufStride;
+                for (size_t row = begin; row < end; ++row)
+                {
+                    size_t i = row / dstHeight, dy = row % dstHeight;
+                    const SimdResizeRoi & roi = rois[i];
+                    T * dst = (T*)(roi.dst + dy * roi.dstStride);
+                    if (roi.affine)
+                    {
+                        const float * m = roi.affine;
+                        for (size_t dx = 0; dx < dstWidth; ++dx, dst += channels)
+                        {
+                            CropResizeIndex x = CropResizeCoord(m[0] * dx + m[1] * dy + m[2], srcWidth);
+                            CropResizeIndex y = CropResizeCoord(m[3] * dx + m[4] * dy + m[5], srcHeight);
+                            CropResizePixel(src, srcStride, channels, y, x, dst);
+                        }
+                    }
+                    else
+                    {
+                        const CropResizeIndex & y = iy[i * dstHeight + dy];
+                        const T * src0 = (const T*)(src + y.i0 * srcStride) + ib[i];
+                        const T * src1 = (const T*)(src + y.i1 * srcStride) + ib[i];
+                        rowV(src0, src1, is[i], CropResizeType<T>::Get(y), pBuf);
+                        size_t o = i * dstSize;
+                        rowH(pBuf, ix0.data() + o, ix1.data() + o, ax.data() + o, dstSize, dst);
+                    }
+                }
+            }, threads);
+        }
+
+        void CropAndResizeBilinear(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, SimdResizeChannelType type,
+            const SimdResizeRoi * rois, size_t count, size_t dstWidth, size_t dstHeight, CropResizeRowV8uPtr rowV8u, CropResizeRowH8uPtr rowH8u,
+            CropResizeRowV32fPtr rowV32f, CropResizeRowH32fPtr rowH32f)
+        {
+            if (type == SimdResizeChannelFloat)
+                CropAndResizeBilinear<float>(src, srcWidth, srcHeight, srcStride, channels, rois, count, dstWidth, dstHeight, rowV32f, rowH32f);
+            else
+                CropAndResizeBilinear<uint8_t>(src, srcWidth, srcHeight, srcStride, channels, rois, count, dstWidth, dstHeight, rowV8u, rowH8u);
+        }
+
+        //---------------------------------------------------------------------
+
+        struct CropResizeTaps
+        {
+            std::vector<int32_t> index, offset;
+            std::vector<float> alpha;
+
+            void Init(float start, float scale, size_t dstSize)
+            {
+                index.resize(dstSize);
+                offset.resize(dstSize + 1);
+                alpha.clear();
+                for (size_t d = 0; d < dstSize; ++d)
+                {
+                    float lo = start + d * scale, hi = lo + scale;
+                    int32_t first = (int32_t)::floor(lo), last = Simd::Max(first, (int32_t)::ceil(hi) - 1);
+                    index[d] = first;
+                    offset[d] = int32_t(alpha.size());
+                    for (int32_t s = first; s <= last; ++s)
+                        alpha.push_back((Simd::Min(hi, float(s + 1)) - Simd::Max(lo, float(s))) / scale);
+                }
+                offset[dstSize] = int32_t(alpha.size());
+            }
+        };
+
+        SIMD_INLINE void CropResizeAreaStore(float value, uint8_t * dst)
+        {
+            *dst = (uint8_t)RestrictRange(Round(value), 0, 255);
+        }
+
+        SIMD_INLINE void CropResizeAreaStore(float value, float * dst)
+        {
+            *dst = value;
+        }
+
+        template<class T> void CropAndResizeArea(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels,
+            const SimdResizeRoi * rois, size_t count, size_t dstWidth, size_t dstHeight)
+        {
+            size_t bufSize = 0;
+            std::vector<CropResizeTaps> tx(count), ty(count);
+            std::vector<int32_t> lo(count), size(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const SimdResizeRoi & roi = rois[i];
+                tx[i].Init(roi.left, (roi.right - roi.left) / dstWidth, dstWidth);
+                ty[i].Init(roi.top, (roi.bottom - roi.top) / dstHeight, dstHeight);
+                int32_t last = tx[i].index[dstWidth - 1] + tx[i].offset[dstWidth] - tx[i].offset[dstWidth - 1] - 1;
+                lo[i] = RestrictRange(tx[i].index[0], 0, int32_t(srcWidth) - 1);
+                size[i] = (RestrictRange(last, 0, int32_t(srcWidth) - 1) - lo[i] + 1) * int32_t(channels);
+                bufSize = Simd::Max(bufSize, size_t(size[i]));
+            }
+            size_t threads = Base::GetThreadNumber();
+            std::vector<float> buf(threads * bufSize);
+            Simd::Parallel(0, count * dstHeight, [&](size_t thread, size_t begin, size_t end)
+            {
+                float * pBuf = buf.data() + thread * bufSize;
+                for (size_t row = begin; row < end; ++row)
+                {
+                    size_t i = row / dstHeight, dy = row % dstHeight;
+                    const SimdResizeRoi & roi = rois[i];
+                    const CropResizeTaps & x = tx[i], & y = ty[i];
+                    for (int32_t e = 0; e < size[i]; ++e)
+                        pBuf[e] = 0.0f;
+                    for (int32_t k = y.offset[dy], sy = y.index[dy]; k < y.offset[dy + 1]; ++k, ++sy)
+                    {
+                        const T * ps = (const T*)(src + RestrictRange(sy, 0, int32_t(srcHeight) - 1) * srcStride) + lo[i] * channels;
+                        for (int32_t e = 0; e < size[i]; ++e)
+                            pBuf[e] += ps[e] * y.alpha[k];
+                    }
+                    T * dst = (T*)(roi.dst + dy * roi.dstStride);
+                    for (size_t dx = 0; dx < dstWidth; ++dx, dst += channels)
+                    {
+                        for (size_t c = 0; c < channels; ++c)
+                        {
+                            float sum = 0.0f;
+                            for (int32_t k = x.offset[dx], sx = x.index[dx]; k < x.offset[dx + 1]; ++k, ++sx)
+                                sum += pBuf[(RestrictRange(sx, 0, int32_t(srcWidth) - 1) - lo[i]) * channels + c] * x.alpha[k];
+                            CropResizeAreaStore(sum, dst + c);
+                        }
+                    }
+                }
+            }, threads);
+        }
+
+        //---------------------------------------------------------------------
+
+        void CropAndResize(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, SimdResizeChannelType type,
+            const SimdResizeRoi * rois, size_t count, size_t dstWidth, size_t dstHeight, SimdResizeMethodType method)
+        {
+            if (method == SimdResizeMethodArea)
+            {
+                std::vector<SimdResizeRoi> area, bilinear;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (rois[i].affine || rois[i].right <= rois[i].left || rois[i].bottom <= rois[i].top)
+                        bilinear.push_back(rois[i]);
+                    else
+                        area.push_back(rois[i]);
+                }
+                if (area.size() && type == SimdResizeChannelFloat)
+                    CropAndResizeArea<float>(src, srcWidth, srcHeight, srcStride, channels, area.data(), area.size(), dstWidth, dstHeight);
+                if (area.size() && type == SimdResizeChannelByte)
+                    CropAndResizeArea<uint8_t>(src, srcWidth, srcHeight, srcStride, channels, area.data(), area.size(), dstWidth, dstHeight);
+                if (bilinear.size())
+                    CropAndResizeBilinear(src, srcWidth, srcHeight, srcStride, channels, type, bilinear.data(), bilinear.size(), dstWidth, dstHeight,
+                        CropResizeRowV, CropResizeRowH, CropResizeRowV, CropResizeRowH);
+            }
+            else
+                CropAndResizeBilinear(src, srcWidth, srcHeight, srcStride, channels, type, rois, count, dstWidth, dstHeight,
+                    CropResizeRowV, CropResizeRowH, CropResizeRowV, CropResizeRowH);
+        }
+    }
+}
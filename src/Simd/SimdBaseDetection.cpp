@@ -328,6 +328,183 @@ namespace Simd
             return DetectionLoadStringXml(file.Data(), path);
         }
 
+        namespace Binary
+        {
+            const uint32_t MAGIC = 0x42434453; // "SDCB"
+            const uint32_t VERSION = 1;
+            const size_t ALIGN = 16;
+
+            enum Section
+            {
+                Stages,
+                Classifiers,
+                Nodes,
+                Leaves,
+                Subsets,
+                HaarFeatures,
+                LbpFeatures,
+                SectionSize
+            };
+
+            struct Header
+            {
+                uint32_t magic;
+                uint32_t version;
+                uint32_t size;
+                uint32_t header;
+                int32_t stageType;
+                int32_t featureType;
+                int32_t ncategories;
+                int32_t width;
+                int32_t height;
+                uint8_t isStumpBased;
+                uint8_t hasTilted;
+                uint8_t canInt16;
+                uint8_t reserved;
+                uint32_t offset[SectionSize];
+                uint32_t count[SectionSize];
+                uint32_t elemSize[SectionSize];
+            };
+
+            template<class T> void Describe(Header & header, Section section, const Table<T> & table, size_t & offset)
+            {
+                header.offset[section] = (uint32_t)offset;
+                header.count[section] = (uint32_t)table.size();
+                header.elemSize[section] = (uint32_t)sizeof(T);
+                offset = AlignHi(offset + table.size() * sizeof(T), ALIGN);
+            }
+
+            template<class T> void Write(const Header & header, Section section, const Table<T> & table, uint8_t * dst)
+            {
+                if (table.size())
+                    memcpy(dst + header.offset[section], table.data(), table.size() * sizeof(T));
+            }
+
+            template<class T> void Map(const Header & header, Section section, const uint8_t * src, Table<T> & table)
+            {
+                if (header.elemSize[section] != sizeof(T) || !Aligned(header.offset[section], ALIGN) ||
+                    uint64_t(header.offset[section]) + uint64_t(header.count[section]) * sizeof(T) > header.size)
+                    SIMD_EX("Invalid section " << section << " of binary cascade!");
+                table.Map((const T*)(src + header.offset[section]), header.count[section]);
+            }
+
+            void Validate(const Data & data)
+            {
+                for (size_t i = 0; i < data.stages.size(); ++i)
+                {
+                    const Data::Stage & stage = data.stages[i];
+                    if (stage.first < 0 || stage.ntrees < 0 || size_t(stage.first) + size_t(stage.ntrees) > data.classifiers.size())
+                        SIMD_EX("Invalid trees of stage " << i << " of binary cascade!");
+                }
+                size_t nodes = 0;
+                for (size_t i = 0; i < data.classifiers.size(); ++i)
+                {
+                    int nodeCount = data.classifiers[i].nodeCount;
+                    if (nodeCount < 1 || size_t(nodeCount) > data.nodes.size() - nodes)
+                        SIMD_EX("Invalid nodes of tree " << i << " of binary cascade!");
+                    nodes += nodeCount;
+                }
+                // Detectors address the node and the pair of leaves of a stump by its tree index.
+                if (nodes != data.nodes.size() || data.leaves.size() < 2 * data.classifiers.size())
+                    SIMD_EX("Invalid nodes or leaves count of binary cascade!");
+                size_t features = data.featureType == SimdDetectionInfoFeatureHaar ? data.haarFeatures.size() : data.lbpFeatures.size();
+                for (size_t i = 0; i < data.nodes.size(); ++i)
+                {
+                    if (data.nodes[i].featureIdx < 0 || size_t(data.nodes[i].featureIdx) >= features)
+                        SIMD_EX("Invalid feature of node " << i << " of binary cascade!");
+                }
+                if (data.featureType == SimdDetectionInfoFeatureLbp)
+                {
+                    // LBP code has 256 values, so each node needs a subset of 8 words.
+                    if (data.ncategories <= 224 || data.ncategories > 256 || data.subsets.size() < data.nodes.size() * 8)
+                        SIMD_EX("Invalid subsets of binary cascade!");
+                }
+            }
+        }
+
+        size_t DetectionSaveBinary(const void * _data, uint8_t * dst, size_t size)
+        {
+            const Data & data = *(Data*)_data;
+
+            Binary::Header header;
+            memset(&header, 0, sizeof(header));
+            header.magic = Binary::MAGIC;
+            header.version = Binary::VERSION;
+            header.header = (uint32_t)sizeof(header);
+            header.stageType = data.stageType;
+            header.featureType = data.featureType;
+            header.ncategories = data.ncategories;
+            header.width = (int32_t)data.origWinSize.x;
+            header.height = (int32_t)data.origWinSize.y;
+            header.isStumpBased = data.isStumpBased ? 1 : 0;
+            header.hasTilted = data.hasTilted ? 1 : 0;
+            header.canInt16 = data.canInt16 ? 1 : 0;
+
+            size_t offset = AlignHi(sizeof(header), Binary::ALIGN);
+            Binary::Describe(header, Binary::Stages, data.stages, offset);
+            Binary::Describe(header, Binary::Classifiers, data.classifiers, offset);
+            Binary::Describe(header, Binary::Nodes, data.nodes, offset);
+            Binary::Describe(header, Binary::Leaves, data.leaves, offset);
+            Binary::Describe(header, Binary::Subsets, data.subsets, offset);
+            Binary::Describe(header, Binary::HaarFeatures, data.haarFeatures, offset);
+            Binary::Describe(header, Binary::LbpFeatures, data.lbpFeatures, offset);
+            header.size = (uint32_t)offset;
+
+            if (dst == NULL || size < offset)
+                return offset;
+
+            memset(dst, 0, offset);
+            memcpy(dst, &header, sizeof(header));
+            Binary::Write(header, Binary::Stages, data.stages, dst);
+            Binary::Write(header, Binary::Classifiers, data.classifiers, dst);
+            Binary::Write(header, Binary::Nodes, data.nodes, dst);
+            Binary::Write(header, Binary::Leaves, data.leaves, dst);
+            Binary::Write(header, Binary::Subsets, data.subsets, dst);
+            Binary::Write(header, Binary::HaarFeatures, data.haarFeatures, dst);
+            Binary::Write(header, Binary::LbpFeatures, data.lbpFeatures, dst);
+            return offset;
+        }
+
+        void * DetectionLoadBinary(const uint8_t * src, size_t size)
+        {
+            Data * data = NULL;
+            try
+            {
+                if (src == NULL || size < sizeof(Binary::Header) || !Aligned(src, sizeof(int)))
+                    SIMD_EX("Invalid binary cascade buffer!");
+                const Binary::Header & header = *(const Binary::Header*)src;
+                if (header.magic != Binary::MAGIC || header.version != Binary::VERSION ||
+                    header.header != sizeof(Binary::Header) || header.size > size)
+                    SIMD_EX("Invalid or incompatible binary cascade header!");
+                if (header.featureType != SimdDetectionInfoFeatureHaar && header.featureType != SimdDetectionInfoFeatureLbp)
+                    SIMD_EX("Invalid binary cascade feature type!");
+
+                data = new Data();
+                data->stageType = header.stageType;
+                data->featureType = (SimdDetectionInfoFlags)header.featureType;
+                data->ncategories = header.ncategories;
+                data->origWinSize = Size(header.width, header.height);
+                data->isStumpBased = header.isStumpBased != 0;
+                data->hasTilted = header.hasTilted != 0;
+                data->canInt16 = header.canInt16 != 0;
+
+                Binary::Map(header, Binary::Stages, src, data->stages);
+                Binary::Map(header, Binary::Classifiers, src, data->classifiers);
+                Binary::Map(header, Binary::Nodes, src, data->nodes);
+                Binary::Map(header, Binary::Leaves, src, data->leaves);
+                Binary::Map(header, Binary::Subsets, src, data->subsets);
+                Binary::Map(header, Binary::HaarFeatures, src, data->haarFeatures);
+                Binary::Map(header, Binary::LbpFeatures, src, data->lbpFeatures);
+                Binary::Validate(*data);
+            }
+            catch (...)
+            {
+                delete data;
+                data = NULL;
+            }
+            return data;
+        }
+
         void DetectionInfo(const void * _data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
         {
             Data * data = (Data*)_data;
@@ -0,0 +1,217 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdDistances.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+
+#include <algorithm>
+#include <cfloat>
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE void Push(std::vector<std::pair<float, size_t> > & heap, size_t top, float distance, size_t index)
+        {
+            std::pair<float, size_t> candidate(distance, index);
+            if (heap.size() < top)
+            {
+                heap.push_back(candidate);
+                std::push_heap(heap.begin(), heap.end());
+            }
+            else if (candidate < heap.front())
+            {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = candidate;
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+
+        Distances::Distances(const DistancesParam & param, const void * const * B, const float * bScales, DotsPtr dots, size_t microM, size_t microN)
+            : _param(param)
+            , _dots(dots)
+            , _B(B, B + param.N)
+        {
+            size_t rowSize = _param.K * _param.ElemSize();
+            _blockN = Simd::Min(AlignHiAny(_param.N, microN), Simd::Max(microN, AlignLoAny(Base::AlgCacheL2() / 2 / rowSize, microN)));
+            _blockM = Simd::Max(microM, AlignLoAny(Simd::Min(Base::AlgCacheL1() / 2 / rowSize, Base::AlgCacheL2() / 2 / sizeof(float) / _blockN), microM));
+            if (bScales)
+            {
+                _bScales.Resize(_param.N);
+                memcpy(_bScales.data, bScales, _param.N * sizeof(float));
+            }
+            _bNorms.Resize(_param.N);
+            Simd::Parallel(0, _param.N, [&](size_t thread, size_t begin, size_t end)
+            {
+                Norms(end - begin, _B.data() + begin, bScales ? bScales + begin : NULL, _bNorms.data + begin);
+            }, Base::GetThreadNumber(), _blockN);
+        }
+
+        void Distances::Norms(size_t M, const void * const * A, const float * scales, float * norms) const
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                float squares;
+                _dots(1, 1, _param.K, A + i, A + i, &squares, 1);
+                if (_param.distance == SimdDistanceCosine)
+                    norms[i] = squares > 0.0f ? 1.0f / ::sqrt(squares) : 0.0f;
+                else
+                    norms[i] = squares * (scales ? scales[i] * scales[i] : 1.0f);
+            }
+        }
+
+        void Distances::TopK(size_t M, const void * const * A, const float * aScales, size_t top, float * distances, size_t * indices) const
+        {
+            if (M == 0 || top == 0)
+                return;
+            Array32f aNorms(M);
+            Norms(M, A, aScales, aNorms.data);
+
+            size_t threads = Simd::Max<size_t>(1, Simd::Min(Base::GetThreadNumber(), DivHi(_param.N, _blockN)));
+            std::vector<Candidates> candidates(threads * M);
+            size_t bufferSize = Simd::Min(M, _blockM) * _blockN;
+            Array32f buffer(threads * bufferSize);
+            Simd::Parallel(0, _param.N, [&](size_t thread, size_t begin, size_t end)
+            {
+                Search(M, A, aScales, aNorms.data, top, begin, end, buffer.data + thread * bufferSize, candidates.data() + thread * M);
+            }, threads, _blockN);
+
+            for (size_t i = 0; i < M; ++i)
+            {
+                Candidates & all = candidates[i];
+                for (size_t t = 1; t < threads; ++t)
+                    all.insert(all.end(), candidates[t * M + i].begin(), candidates[t * M + i].end());
+                size_t count = Simd::Min(top, all.size());
+                std::partial_sort(all.begin(), all.begin() + count, all.end());
+                for (size_t k = 0; k < top; ++k)
+                {
+                    distances[i * top + k] = k < count ? all[k].first : FLT_MAX;
+                    indices[i * top + k] = k < count ? all[k].second : size_t(-1);
+                }
+            }
+        }
+
+        void Distances::Search(size_t M, const void * const * A, const float * aScales, const float * aNorms, size_t top,
+            size_t begin, size_t end, float * buffer, Candidates * candidates) const
+        {
+            bool cosine = _param.distance == SimdDistanceCosine;
+            for (size_t j = begin; j < end; j += _blockN)
+            {
+                size_t dN = Simd::Min(end, j + _blockN) - j;
+                const float * bNorms = _bNorms.data + j;
+                const float * bScales = _bScales.data ? _bScales.data + j : NULL;
+                for (size_t i = 0; i < M; i += _blockM)
+                {
+                    size_t dM = Simd::Min(M, i + _blockM) - i;
+                    _dots(dM, dN, _param.K, A + i, _B.data() + j, buffer, dN);
+                    for (size_t m = 0; m < dM; ++m)
+                    {
+                        const float * dots = buffer + m * dN;
+                        Candidates & heap = candidates[i + m];
+                        float aNorm = aNorms[i + m];
+                        if (cosine)
+                        {
+                            for (size_t n = 0; n < dN; ++n)
+                                Push(heap, top, 1.0f - dots[n] * aNorm * bNorms[n], j + n);
+                        }
+                        else
+                        {
+                            float aScale = aScales ? -2.0f * aScales[i + m] : -2.0f;
+                            for (size_t n = 0; n < dN; ++n)
+                            {
+                                float scale = bScales ? aScale * bScales[n] : aScale;
+                                Push(heap, top, Simd::Max(aNorm + bNorms[n] + dots[n] * scale, 0.0f), j + n);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        template<class T> void Convert(const T * src, size_t size, float * dst);
+
+        template<> SIMD_INLINE void Convert<float>(const float * src, size_t size, float * dst)
+        {
+            memcpy(dst, src, size * sizeof(float));
+        }
+
+        template<> SIMD_INLINE void Convert<uint16_t>(const uint16_t * src, size_t size, float * dst)
+        {
+            Float16ToFloat32(src, size, dst);
+        }
+
+        template<class T> void Dots(size_t M, size_t N, size_t K, const void * const * A, const void * const * B, float * dots, size_t stride)
+        {
+            Array32f a(M * K), b(K);
+            for (size_t i = 0; i < M; ++i)
+                Convert((const T*)A[i], K, a.data + i * K);
+            for (size_t j = 0; j < N; ++j)
+            {
+                Convert((const T*)B[j], K, b.data);
+                for (size_t i = 0; i < M; ++i)
+                {
+                    const float * pa = a.data + i * K;
+                    float sum = 0;
+                    for (size_t k = 0; k < K; ++k)
+                        sum += pa[k] * b[k];
+                    dots[i * stride + j] = sum;
+                }
+            }
+        }
+
+        template<> void Dots<int8_t>(size_t M, size_t N, size_t K, const void * const * A, const void * const * B, float * dots, size_t stride)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                const int8_t * a = (const int8_t*)A[i];
+                for (size_t j = 0; j < N; ++j)
+                {
+                    const int8_t * b = (const int8_t*)B[j];
+                    int32_t sum = 0;
+                    for (size_t k = 0; k < K; ++k)
+                        sum += int32_t(a[k]) * int32_t(b[k]);
+                    dots[i * stride + j] = float(sum);
+                }
+            }
+        }
+
+        void * DistancesInit(size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance, const void * const * B, const float * bScales)
+        {
+            DistancesParam param(N, K, type, distance);
+            if (!param.Valid() || B == NULL)
+                return NULL;
+            switch (type)
+            {
+            case SimdTensorData32f: return new Distances(param, B, bScales, Dots<float>, 1, 1);
+            case SimdTensorData16f: return new Distances(param, B, bScales, Dots<uint16_t>, 1, 1);
+            case SimdTensorData8i: return new Distances(param, B, bScales, Dots<int8_t>, 1, 1);
+            default:
+                return NULL;
+            }
+        }
+    }
+}
@@ -35,12 +35,17 @@ namespace Simd
     {
     }
 
+    size_t BlurParam::Half() const
+    {
+        return (int)::floor(::sqrt(::log(1000.0f)) * radius);
+    }
+
     namespace Base
     {
         GaussianBlur::GaussianBlur(const BlurParam& param)
             : _param(param)
         {
-            _half = (int)::floor(::sqrt(::log(1000.0f)) * _param.radius);
+            _half = _param.Half();
             _kernel = 2 * _half + 1;
             _weight.Resize(2 * _kernel);
             _weight[_half] = 1.0f;
@@ -87,14 +92,43 @@ namespace Simd
             }
         }
 
+        SIMD_INLINE void SumRows(const float* rows, size_t stride, size_t size, const float* weight, size_t kernel, size_t first, uint8_t* dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+            {
+                float sum = 0;
+                for (size_t k = 0, r = first; k < kernel; ++k, r = r + 1 < kernel ? r + 1 : 0)
+                    sum += weight[k] * rows[i + r * stride];
+                dst[i] = RestrictRange(Round(sum));
+            }
+        }
+
         void GaussianBlur::Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride)
         {
-            if (_param.height == 0 || _param.width == 0)
+            Run(src, srcStride, _param.height, dst, dstStride);
+        }
+
+        void GaussianBlur::Run(const uint8_t* src, size_t srcStride, size_t height, uint8_t* dst, size_t dstStride)
+        {
+            if (height == 0 || _param.width == 0)
                 return;
             PadRow(src, _half, _param.channels, _size, _buf.data + _start);
-            BlurRow(_buf.data + _start, _size, _param.channels, _weight.data, _kernel, _rows.data + _half * _stride);
-            for (size_t row = 0; row < _half; ++row)
-                memcpy(_rows.data + row * _stride, _rows.data + _half * _stride, _size * sizeof(float));
+            BlurRow(_buf.data + _start, _size, _param.channels, _weight.data, _kernel, _rows.data);
+            for (size_t row = 1; row <= _half; ++row)
+                memcpy(_rows.data + row * _stride, _rows.data, _size * sizeof(float));
+            for (size_t row = 1; row < _half; ++row)
+            {
+                PadRow(src + Simd::Min(row, height - 1) * srcStride, _half, _param.channels, _size, _buf.data + _start);
+                BlurRow(_buf.data + _start, _size, _param.channels, _weight.data, _kernel, _rows.data + (_half + row) * _stride);
+            }
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t next = Simd::Min(row + _half, height - 1);
+                PadRow(src + next * srcStride, _half, _param.channels, _size, _buf.data + _start);
+                BlurRow(_buf.data + _start, _size, _param.channels, _weight.data, _kernel, _rows.data + (row + _kernel - 1) % _kernel * _stride);
+                SumRows(_rows.data, _stride, _size, _weight.data, _kernel, row % _kernel, dst);
+                dst += dstStride;
+            }
         }
 
         //---------------------------------------------------------------------
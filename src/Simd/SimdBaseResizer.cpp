@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdMath.h"
 #include "Simd/SimdResizer.h"
 
 namespace Simd
@@ -373,6 +374,230 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SIMD_INLINE float FilterBicubic(float x)
+        {
+            const float a = -0.5f;
+            x = ::fabs(x);
+            if (x < 1.0f)
+                return ((a + 2.0f) * x - (a + 3.0f)) * x * x + 1.0f;
+            if (x < 2.0f)
+                return (((x - 5.0f) * x + 8.0f) * x - 4.0f) * a;
+            return 0.0f;
+        }
+
+        SIMD_INLINE float FilterLanczos3(float x)
+        {
+            x = ::fabs(x);
+            if (x < 0.000001f)
+                return 1.0f;
+            if (x < 3.0f)
+            {
+                float px = float(M_PI) * x;
+                return 3.0f * ::sin(px) * ::sin(px / 3.0f) / (px * px);
+            }
+            return 0.0f;
+        }
+
+        SIMD_INLINE float FilterRadius(SimdResizeMethodType method)
+        {
+            return method == SimdResizeMethodBicubic ? 2.0f : 3.0f;
+        }
+
+        size_t FilterTaps(SimdResizeMethodType method, size_t srcSize, size_t dstSize)
+        {
+            float support = FilterRadius(method) * Max((float)srcSize / dstSize, 1.0f);
+            return Simd::Min<size_t>((size_t)::ceil(support) * 2 + 1, srcSize);
+        }
+
+        void EstimateFilterParams(SimdResizeMethodType method, size_t srcSize, size_t dstSize, size_t taps, int32_t * index, float * alpha)
+        {
+            float scale = (float)srcSize / dstSize;
+            float fscale = Max(scale, 1.0f);
+            float support = FilterRadius(method) * fscale;
+            for (size_t i = 0; i < dstSize; ++i, alpha += taps)
+            {
+                float center = (i + 0.5f) * scale;
+                ptrdiff_t beg = Simd::Max<ptrdiff_t>((ptrdiff_t)::floor(center - support + 0.5f), 0);
+                ptrdiff_t end = Simd::Min<ptrdiff_t>((ptrdiff_t)::floor(center + support + 0.5f), srcSize);
+                ptrdiff_t start = Simd::Min<ptrdiff_t>(beg, srcSize - taps);
+                for (size_t k = 0; k < taps; ++k)
+                    alpha[k] = 0.0f;
+                float sum = 0.0f;
+                for (ptrdiff_t j = beg; j < end; ++j)
+                {
+                    float x = (j + 0.5f - center) / fscale;
+                    float w = method == SimdResizeMethodBicubic ? FilterBicubic(x) : FilterLanczos3(x);
+                    assert(j - start < (ptrdiff_t)taps);
+                    alpha[j - start] = w;
+                    sum += w;
+                }
+                for (size_t k = 0; k < taps; ++k)
+                    alpha[k] /= sum;
+                index[i] = (int32_t)start;
+            }
+        }
+
+        static void FilterAlphaToInt(const float * src, size_t taps, int32_t * dst)
+        {
+            int32_t sum = 0;
+            size_t max = 0;
+            for (size_t k = 0; k < taps; ++k)
+            {
+                dst[k] = Round(src[k] * FILTER_RANGE);
+                sum += dst[k];
+                if (dst[k] > dst[max])
+                    max = k;
+            }
+            dst[max] += FILTER_RANGE - sum;
+        }
+
+        ResizerByteFilter::ResizerByteFilter(const ResParam & param)
+            : Resizer(param)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn;
+            Array32f alpha;
+
+            _ky = FilterTaps(_param.method, _param.srcH, _param.dstH);
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH * _ky);
+            alpha.Resize(_param.dstH * _ky);
+            EstimateFilterParams(_param.method, _param.srcH, _param.dstH, _ky, _iy.data, alpha.data);
+            for (size_t dy = 0; dy < _param.dstH; ++dy)
+                FilterAlphaToInt(alpha.data + dy * _ky, _ky, _ay.data + dy * _ky);
+
+            _kx = FilterTaps(_param.method, _param.srcW, _param.dstW);
+            Array32i ix(_param.dstW), ax(_kx);
+            alpha.Resize(_param.dstW * _kx);
+            EstimateFilterParams(_param.method, _param.srcW, _param.dstW, _kx, ix.data, alpha.data);
+            _ix.Resize(rs, false, _param.align);
+            _ax.Resize(rs * _kx, false, _param.align);
+            for (size_t dx = 0; dx < _param.dstW; ++dx)
+            {
+                FilterAlphaToInt(alpha.data + dx * _kx, _kx, ax.data);
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    size_t offset = dx * cn + c;
+                    _ix[offset] = (int32_t)(ix[dx] * cn + c);
+                    for (size_t k = 0; k < _kx; ++k)
+                        _ax[k * rs + offset] = ax[k];
+                }
+            }
+            _bx.Resize(_param.srcW * cn, false, _param.align);
+        }
+
+        void ResizerByteFilter::RunV(const uint8_t * src, size_t srcStride, size_t dy, int32_t * dst)
+        {
+            size_t size = _param.srcW * _param.channels;
+            const int32_t * ay = _ay.data + dy * _ky;
+            for (size_t x = 0; x < size; ++x)
+                dst[x] = src[x] * ay[0];
+            for (size_t k = 1; k < _ky; ++k)
+            {
+                const uint8_t * s = src + k * srcStride;
+                for (size_t x = 0; x < size; ++x)
+                    dst[x] += s[x] * ay[k];
+            }
+            for (size_t x = 0; x < size; ++x)
+                dst[x] = (dst[x] + FILTER_V_ROUND) >> FILTER_V_SHIFT;
+        }
+
+        void ResizerByteFilter::RunH(const int32_t * src, uint8_t * dst)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn;
+            for (size_t dx = 0; dx < rs; ++dx)
+            {
+                const int32_t * s = src + _ix[dx];
+                const int32_t * a = _ax.data + dx;
+                int32_t sum = 0;
+                for (size_t k = 0; k < _kx; ++k, s += cn, a += rs)
+                    sum += s[0] * a[0];
+                dst[dx] = (uint8_t)RestrictRange((sum + FILTER_H_ROUND) >> FILTER_H_SHIFT);
+            }
+        }
+
+        void ResizerByteFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t dy = 0; dy < _param.dstH; dy++, dst += dstStride)
+            {
+                RunV(src + _iy[dy] * srcStride, srcStride, dy, _bx.data);
+                RunH(_bx.data, dst);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        ResizerFloatFilter::ResizerFloatFilter(const ResParam & param)
+            : Resizer(param)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn;
+
+            _ky = FilterTaps(_param.method, _param.srcH, _param.dstH);
+            _iy.Resize(_param.dstH);
+            _ay.Resize(_param.dstH * _ky);
+            EstimateFilterParams(_param.method, _param.srcH, _param.dstH, _ky, _iy.data, _ay.data);
+
+            _kx = FilterTaps(_param.method, _param.srcW, _param.dstW);
+            Array32i ix(_param.dstW);
+            Array32f ax(_param.dstW * _kx);
+            EstimateFilterParams(_param.method, _param.srcW, _param.dstW, _kx, ix.data, ax.data);
+            _ix.Resize(rs, false, _param.align);
+            _ax.Resize(rs * _kx, false, _param.align);
+            for (size_t dx = 0; dx < _param.dstW; ++dx)
+            {
+                for (size_t c = 0; c < cn; ++c)
+                {
+                    size_t offset = dx * cn + c;
+                    _ix[offset] = (int32_t)(ix[dx] * cn + c);
+                    for (size_t k = 0; k < _kx; ++k)
+                        _ax[k * rs + offset] = ax[dx * _kx + k];
+                }
+            }
+            _bx.Resize(_param.srcW * cn, false, _param.align);
+        }
+
+        void ResizerFloatFilter::RunV(const float * src, size_t srcStride, size_t dy, float * dst)
+        {
+            size_t size = _param.srcW * _param.channels;
+            const float * ay = _ay.data + dy * _ky;
+            for (size_t x = 0; x < size; ++x)
+                dst[x] = src[x] * ay[0];
+            for (size_t k = 1; k < _ky; ++k)
+            {
+                const float * s = src + k * srcStride;
+                for (size_t x = 0; x < size; ++x)
+                    dst[x] += s[x] * ay[k];
+            }
+        }
+
+        void ResizerFloatFilter::RunH(const float * src, float * dst)
+        {
+            size_t cn = _param.channels, rs = _param.dstW * cn;
+            for (size_t dx = 0; dx < rs; ++dx)
+            {
+                const float * s = src + _ix[dx];
+                const float * a = _ax.data + dx;
+                float sum = 0.0f;
+                for (size_t k = 0; k < _kx; ++k, s += cn, a += rs)
+                    sum += s[0] * a[0];
+                dst[dx] = sum;
+            }
+        }
+
+        void ResizerFloatFilter::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            const float * s = (const float*)src;
+            float * d = (float*)dst;
+            srcStride /= sizeof(float);
+            dstStride /= sizeof(float);
+            for (size_t dy = 0; dy < _param.dstH; dy++, d += dstStride)
+            {
+                RunV(s + _iy[dy] * srcStride, srcStride, dy, _bx.data);
+                RunH(_bx.data, d);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method)
         {
             ResParam param(srcX, srcY, dstX, dstY, channels, type, method, sizeof(void*));
@@ -382,6 +607,10 @@ namespace Simd
                 return new ResizerByteArea(param);
             else if (param.IsFloatBilinear())
                 return new ResizerFloatBilinear(param);
+            else if (param.IsByteFilter())
+                return new ResizerByteFilter(param);
+            else if (param.IsFloatFilter())
+                return new ResizerFloatFilter(param);
             else
                 return NULL;
         }
@@ -0,0 +1,136 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStripFilter.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        StripFilter::StripFilter(const StripFilterParam & param, FilterPtr filter)
+            : _param(param)
+            , _filter(filter)
+        {
+            switch (_param.type)
+            {
+            case SimdStripFilterGaussianBlur: _half = BlurParam(_param.width, _param.height, _param.channels, &_param.radius, _param.align).Half(); break;
+            case SimdStripFilterMedianSquare5x5: _half = 2; break;
+            default: _half = 1;
+            }
+            _srcSize = _param.width * _param.channels;
+            _srcStride = AlignHi(_srcSize, _param.align);
+            _dstSize = _param.DstSize();
+            _dstStride = AlignHi(_dstSize, _param.align);
+            Reset();
+        }
+
+        void StripFilter::Reset()
+        {
+            _first = 0;
+            _received = 0;
+            _emitted = 0;
+        }
+
+        size_t StripFilter::Run(const uint8_t * src, size_t srcStride, size_t rows, uint8_t * dst, size_t dstStride)
+        {
+            assert(_received + rows <= _param.height);
+
+            size_t kept = _received - _first;
+            if ((kept + rows) * _srcStride > _src.size)
+            {
+                Array8u buffer((kept + rows) * _srcStride);
+                if (kept)
+                    memcpy(buffer.data, _src.data, kept * _srcStride);
+                _src.Swap(buffer);
+            }
+            for (size_t row = 0; row < rows; ++row)
+                memcpy(_src.data + (kept + row) * _srcStride, src + row * srcStride, _srcSize);
+            _received += rows;
+
+            size_t ready = _received == _param.height ? _param.height : Simd::Max(_received, _half) - _half;
+            if (ready <= _emitted)
+                return 0;
+
+            size_t end = Simd::Min(ready + _half, _received);
+            if ((end - _first) * _dstStride > _dst.size)
+                _dst.Resize((end - _first) * _dstStride);
+            Filter(_src.data, _srcStride, end - _first, _dst.data, _dstStride);
+            for (size_t row = _emitted; row < ready; ++row)
+                memcpy(dst + (row - _emitted) * dstStride, _dst.data + (row - _first) * _dstStride, _dstSize);
+
+            size_t emitted = ready - _emitted;
+            if (ready == _param.height)
+                Reset();
+            else
+            {
+                size_t first = Simd::Max(ready, _half) - _half;
+                memmove(_src.data, _src.data + (first - _first) * _srcStride, (_received - first) * _srcStride);
+                _first = first;
+                _emitted = ready;
+            }
+            return emitted;
+        }
+
+        void StripFilter::Filter(const uint8_t * src, size_t srcStride, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            _filter(src, srcStride, _param.width, height, _param.channels, dst, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        StripFilterGaussianBlur::StripFilterGaussianBlur(const StripFilterParam & param)
+            : StripFilter(param, NULL)
+            , _blur(BlurParam(param.width, param.height, param.channels, &param.radius, param.align))
+        {
+        }
+
+        void StripFilterGaussianBlur::Filter(const uint8_t * src, size_t srcStride, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            _blur.Run(src, srcStride, height, dst, dstStride);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * StripFilterInit(size_t width, size_t height, size_t channels, SimdStripFilterType type, const float * radius)
+        {
+            StripFilterParam param(width, height, channels, type, radius, sizeof(void*));
+            if (!param.Valid())
+                return NULL;
+            switch (type)
+            {
+            case SimdStripFilterGaussianBlur3x3: return new StripFilter(param, GaussianBlur3x3);
+            case SimdStripFilterGaussianBlur: return new StripFilterGaussianBlur(param);
+            case SimdStripFilterMedianSquare3x3: return new StripFilter(param, MedianFilterSquare3x3);
+            case SimdStripFilterMedianSquare5x5: return new StripFilter(param, MedianFilterSquare5x5);
+            case SimdStripFilterSobelDx: return new StripFilter(param, StripFilterGray<SobelDx>);
+            case SimdStripFilterSobelDxAbs: return new StripFilter(param, StripFilterGray<SobelDxAbs>);
+            case SimdStripFilterSobelDy: return new StripFilter(param, StripFilterGray<SobelDy>);
+            case SimdStripFilterSobelDyAbs: return new StripFilter(param, StripFilterGray<SobelDyAbs>);
+            case SimdStripFilterLaplace: return new StripFilter(param, StripFilterGray<Laplace>);
+            case SimdStripFilterLaplaceAbs: return new StripFilter(param, StripFilterGray<LaplaceAbs>);
+            default: return NULL;
+            }
+        }
+    }
+}
@@ -0,0 +1,268 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution16b.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdBFloat16.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    SynetConvolution16b::SynetConvolution16b(const ConvParam16b & p)
+        : _param(p)
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+        , _perf(NULL)
+#endif
+    {
+        _src16b = p.srcT == SimdTensorData16b;
+        _dst16b = p.dstT == SimdTensorData16b;
+        _elemS = _src16b ? 2 : 4;
+        _elemD = _dst16b ? 2 : 4;
+        _sizeS = p.srcC * p.srcH * p.srcW;
+        _sizeD = p.dstC * p.dstH * p.dstW;
+    }
+
+    size_t SynetConvolution16b::ExternalBufferSize() const
+    {
+        return SIMD_ALIGN;
+    }
+
+    size_t SynetConvolution16b::InternalBufferSize() const
+    {
+        return _buffer.size + (_bias.size + _params.size) * sizeof(float);
+    }
+
+    void SynetConvolution16b::SetParams(const float * weight, const float * bias, const float * params)
+    {
+        const ConvParam16b & p = _param;
+        _bias.Resize(p.dstC, true);
+        if (bias)
+            memcpy(_bias.data, bias, p.dstC * sizeof(float));
+        size_t count = 0;
+        switch (p.activation)
+        {
+        case SimdConvolutionActivationIdentity:
+        case SimdConvolutionActivationRelu:
+            count = 0;
+            break;
+        case SimdConvolutionActivationLeakyRelu:
+        case SimdConvolutionActivationElu:
+        case SimdConvolutionActivationMish:
+            count = 1;
+            break;
+        case SimdConvolutionActivationRestrictRange:
+        case SimdConvolutionActivationHswish:
+            count = 2;
+            break;
+        case SimdConvolutionActivationPrelu:
+            count = p.dstC;
+            break;
+        default:
+            assert(0);
+        }
+        _params.Resize(Simd::Max<size_t>(count, 2), true);
+        if (params)
+            memcpy(_params.data, params, count * sizeof(float));
+    }
+
+    uint8_t * SynetConvolution16b::Buffer(uint8_t * buffer)
+    {
+        if (buffer)
+            return buffer;
+        _buffer.Resize(ExternalBufferSize());
+        return _buffer.data;
+    }
+
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+    Base::PerformanceMeasurer * SynetConvolution16b::Perf(const char* func)
+    {
+        if (_perf == NULL)
+            _perf = Simd::Base::PerformanceMeasurerStorage::s_storage.Get(func, Param().Info() + " " + Desc(), Param().Flop());
+        return _perf;
+    }
+#endif
+
+    //-------------------------------------------------------------------------
+
+    namespace Base
+    {
+        static void Gemm16b(const uint16_t * src, size_t M, size_t K, size_t srcStride, const uint16_t * weight, size_t D, float * dst, size_t dstStride)
+        {
+            assert(K % 2 == 0);
+            const size_t F = SynetConvolution16bNhwcGemm::F;
+            float sum[F];
+            for (size_t i = 0; i < M; ++i)
+            {
+                const uint16_t * s = src + i * srcStride;
+                for (size_t d = 0; d < D; d += F)
+                {
+                    const uint16_t * w = weight + d * K;
+                    for (size_t f = 0; f < F; ++f)
+                        sum[f] = 0.0f;
+                    for (size_t k = 0; k < K; k += 2, w += 2 * F)
+                    {
+                        float s0 = BFloat16ToFloat32(s[k + 0]);
+                        float s1 = BFloat16ToFloat32(s[k + 1]);
+                        for (size_t f = 0; f < F; ++f)
+                            sum[f] += s0 * BFloat16ToFloat32(w[2 * f + 0]) + s1 * BFloat16ToFloat32(w[2 * f + 1]);
+                    }
+                    for (size_t f = 0, n = Simd::Min(F, D - d); f < n; ++f)
+                        dst[d + f] = sum[f];
+                }
+                dst += dstStride;
+            }
+        }
+
+        SynetConvolution16bNhwcGemm::SynetConvolution16bNhwcGemm(const ConvParam16b & p)
+            : SynetConvolution16b(p)
+        {
+            _K = p.kernelY * p.kernelX * p.srcC / p.group;
+            _ldK = AlignHi(_K, 2);
+            _D = p.dstC / p.group;
+            _DF = AlignHi(_D, F);
+            _M = p.dstH * p.dstW;
+            _direct = p.Is1x1() && p.group == 1 && p.srcC % 2 == 0;
+            _gemm = Gemm16b;
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+            _toBFloat16 = Base::Float32ToBFloat16;
+        }
+
+        size_t SynetConvolution16bNhwcGemm::ExternalBufferSize() const
+        {
+            size_t size = SynetConvolution16b::ExternalBufferSize();
+            if (!_src16b)
+                size += AlignHi(_sizeS * sizeof(uint16_t), SIMD_ALIGN);
+            if (!_direct)
+                size += AlignHi(_M * _ldK * sizeof(uint16_t), SIMD_ALIGN);
+            if (_dst16b)
+                size += AlignHi(_sizeD * sizeof(float), SIMD_ALIGN);
+            return size;
+        }
+
+        size_t SynetConvolution16bNhwcGemm::InternalBufferSize() const
+        {
+            return SynetConvolution16b::InternalBufferSize() + _weight.RawSize();
+        }
+
+        void SynetConvolution16bNhwcGemm::SetParams(const float * weight, const float * bias, const float * params)
+        {
+            SynetConvolution16b::SetParams(weight, bias, params);
+            const ConvParam16b & p = _param;
+            _weight.Resize(p.group * _DF * _ldK, true);
+            uint16_t * dst = _weight.data;
+            for (size_t g = 0; g < p.group; ++g)
+            {
+                for (size_t d = 0; d < _DF; d += F)
+                {
+                    for (size_t k = 0; k < _ldK; k += 2)
+                    {
+                        for (size_t f = 0; f < F; ++f)
+                        {
+                            for (size_t i = 0; i < 2; ++i)
+                            {
+                                if (d + f < _D && k + i < _K)
+                                    *dst = Float32ToBFloat16(weight[(k + i) * p.dstC + g * _D + d + f]);
+                                dst++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        void SynetConvolution16bNhwcGemm::ImgToRow(const uint8_t * src, size_t group, uint16_t * dst) const
+        {
+            const ConvParam16b & p = _param;
+            const uint16_t * src16b = (const uint16_t *)src + group * p.srcC / p.group;
+            size_t C = p.srcC / p.group;
+            for (size_t dy = 0; dy < p.dstH; ++dy)
+            {
+                for (size_t dx = 0; dx < p.dstW; ++dx)
+                {
+                    uint16_t * row = dst;
+                    for (size_t ky = 0; ky < p.kernelY; ky++)
+                    {
+                        size_t sy = dy * p.strideY + ky * p.dilationY - p.padY;
+                        for (size_t kx = 0; kx < p.kernelX; kx++)
+                        {
+                            size_t sx = dx * p.strideX + kx * p.dilationX - p.padX;
+                            if (sy < p.srcH && sx < p.srcW)
+                                memcpy(row, src16b + (sy * p.srcW + sx) * p.srcC, C * sizeof(uint16_t));
+                            else
+                                memset(row, 0, C * sizeof(uint16_t));
+                            row += C;
+                        }
+                    }
+                    if (_ldK > _K)
+                        *row = 0;
+                    dst += _ldK;
+                }
+            }
+        }
+
+        void SynetConvolution16bNhwcGemm::Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst)
+        {
+            const ConvParam16b & p = _param;
+            buf = Buffer(buf);
+            uint16_t * bufS = _src16b ? NULL : Allocate<uint16_t>(buf, _sizeS);
+            uint16_t * bufR = _direct ? NULL : Allocate<uint16_t>(buf, _M * _ldK);
+            float * bufD = _dst16b ? Allocate<float>(buf, _sizeD) : NULL;
+            for (size_t b = 0; b < p.batch; ++b)
+            {
+                const uint16_t * src16b = (const uint16_t*)src;
+                if (!_src16b)
+                {
+                    _toBFloat16((const float*)src, _sizeS, bufS);
+                    src16b = bufS;
+                }
+                float * dst32f = _dst16b ? bufD : (float*)dst;
+                for (size_t g = 0; g < p.group; ++g)
+                {
+                    const uint16_t * rows = src16b;
+                    if (!_direct)
+                    {
+                        ImgToRow((const uint8_t*)src16b, g, bufR);
+                        rows = bufR;
+                    }
+                    _gemm(rows, _M, _ldK, _direct ? p.srcC : _ldK, _weight.data + g * _DF * _ldK, _D, dst32f + g * _D, p.dstC);
+                }
+                _biasAndActivation(_bias.data, p.dstC, _M, p.activation, _params.data, SimdTrue, dst32f);
+                if (_dst16b)
+                    _toBFloat16(dst32f, _sizeD, (uint16_t*)dst);
+                src += _sizeS * _elemS;
+                dst += _sizeD * _elemD;
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters * conv)
+        {
+            ConvParam16b param(batch, conv);
+            if (!param.Valid())
+                return NULL;
+            return new SynetConvolution16bNhwcGemm(param);
+        }
+    }
+}
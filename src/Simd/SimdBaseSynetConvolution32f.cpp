@@ -27,6 +27,11 @@
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
 
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <cfloat>
+
 namespace Simd
 {
 #if defined(SIMD_PERFORMANCE_STATISTIC)
@@ -246,6 +251,14 @@ namespace Simd
         SynetConvolution32fGemmNN::SynetConvolution32fGemmNN(const ConvParam32f & p)
             : SynetConvolution32f(p)
         {
+            SetSize();
+            _gemm.Init(InitGemmFuncs(Base::Gemm32fNN, "Base", p.gemm, "Ext"));
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+        }
+
+        void SynetConvolution32fGemmNN::SetSize()
+        {
+            const ConvParam32f & p = _param;
             if (p.IsDilation(1) && p.IsStride(1) && p.IsPad(0))
             {
                 _skipConv = p.IsKernel(1) || (p.srcH == p.kernelY && p.srcW == p.kernelX);
@@ -287,8 +300,16 @@ namespace Simd
                     if (_batch%merge == 0 && _M*merge*_K*sizeof(float) <= Base::AlgCacheL2())
                         _merge = merge;
             }
-            _gemm.Init(InitGemmFuncs(Base::Gemm32fNN, "Base", p.gemm, "Ext"));
-            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+        }
+
+        bool SynetConvolution32fGemmNN::Reshape(size_t srcH, size_t srcW)
+        {
+            if (_nhwcWeight.data && _gemmCb.Size() == 0)
+                return false;
+            if (!ReshapeParam(srcH, srcW))
+                return false;
+            SetSize();
+            return true;
         }
 
         size_t SynetConvolution32fGemmNN::ExternalBufferSize() const
@@ -783,6 +804,25 @@ namespace Simd
                 *internal = SimdTrue;
         }
         
+        bool SynetConvolution32fWinograd::Reshape(size_t srcH, size_t srcW)
+        {
+            ConvParam32f p = _param;
+            if (!p.Reshape(srcH, srcW) || !Preferable(p))
+                return false;
+            if (_blockY == 6 && (p.dstH < 12 || p.dstW < 12))
+                return false;
+            if (_blockY == 4 && (p.srcH < 8 || p.srcW < 8))
+                return false;
+            if (_blockY == 3 && (p.srcH < 6 || p.srcW < 6 || p.dstH % 3 != 0 || p.dstW % 3 != 0))
+                return false;
+            if (_nhwcWeight.data && _gemmCb.Size() == 0)
+                return false;
+            if (!ReshapeParam(srcH, srcW))
+                return false;
+            SetBlock(_blockY, _blockX);
+            return true;
+        }
+
         void SynetConvolution32fWinograd::Forward(const float * src, float * buf, float * dst)
         {
             const ConvParam32f & p = _param;
@@ -873,7 +913,7 @@ namespace Simd
                         if (_batch % merge == 0 && _M * merge <= 128)
                             _merge = merge;
                 }
-                if (_merge == 1 && _blockY == 4)
+                if (_merge == 1 && (_blockY == 4 || _blockY == 6))
                 {
                     size_t cacheL2 = Base::AlgCacheL2() / sizeof(float);
                     size_t cacheL3 = Base::AlgCacheL3() / sizeof(float);
@@ -1225,6 +1265,17 @@ namespace Simd
             }
         }
 
+        bool SynetConvolution32fDirectNhwc::Reshape(size_t srcH, size_t srcW)
+        {
+            if (!ReshapeParam(srcH, srcW))
+                return false;
+            const ConvParam32f & p = _param;
+            _sizeS = p.srcC*p.srcH*p.srcW;
+            _sizeD = p.dstC*p.dstH*p.dstW;
+            _convolutionBiasActivation = SetConvolutionBiasActivation();
+            return true;
+        }
+
         bool SynetConvolution32fDirectNhwc::Preferable(const ConvParam32f & p)
         {
             if (p.trans == 0)
@@ -1461,6 +1512,34 @@ namespace Simd
             }
         }
 
+        bool SynetConvolution32fNhwcDirect::Reshape(size_t srcH, size_t srcW)
+        {
+            if (!ReshapeParam(srcH, srcW))
+                return false;
+            const ConvParam32f& p = _param;
+            _sizeS = p.srcC * p.srcH * p.srcW;
+            _sizeD = p.dstC * p.dstH * p.dstW;
+#ifdef SIMD_SYNET_CONVOLUTION_NHWC_DIRECT_OLD
+            if (_old.enable)
+            {
+                if (_old.convolution)
+                    SetMacroH(_old.alg);
+            }
+            else
+#endif
+            if (_run.Size())
+            {
+                RunFuncs funcs;
+                for (size_t i = 0; i < _run.Size(); ++i)
+                {
+                    funcs.push_back(_run.At(i));
+                    SetMacroH(funcs.back().alg);
+                }
+                _run.Init(funcs);
+            }
+            return true;
+        }
+
         void SynetConvolution32fNhwcDirect::Forward(const float* src, const ConvParam32f& p, const AlgParam& a, const float* weight, const float* bias, const float* params, float* dst)
         {
             for (size_t dc = 0; dc < p.dstC; dc += a.macroD)
@@ -1496,12 +1575,7 @@ namespace Simd
             alg.F = F;
             alg.microD = F*N;
             alg.macroC = Simd::Min(Base::AlgCacheL1() / sizeof(float) / p.kernelY / p.kernelX / alg.microD, p.srcC);
-            for (size_t macroH = p.dstH; macroH >= 1; macroH--)
-            {
-                alg.macroH = macroH;
-                if (alg.macroC * p.srcW * (alg.macroH * p.strideY + p.kernelY * p.dilationY - 1) * sizeof(float) <= Base::AlgCacheL2())
-                    break;
-            }
+            SetMacroH(alg);
             alg.macroD = Simd::Min(AlignLoAny(Base::AlgCacheL3() / sizeof(float) / p.kernelY / p.kernelX / alg.macroC, alg.microD), AlignHiAny(p.dstC, alg.microD));
             alg.stepW = p.kernelY * p.kernelX * p.srcC * alg.F;
             _rWeight.Resize(DivHi(p.dstC, alg.F)*alg.stepW);
@@ -1512,6 +1586,17 @@ namespace Simd
                 _rParams.Resize(2, true);
         }
 
+        void SynetConvolution32fNhwcDirect::SetMacroH(AlgParam& alg)
+        {
+            const ConvParam32f& p = _param;
+            for (size_t macroH = p.dstH; macroH >= 1; macroH--)
+            {
+                alg.macroH = macroH;
+                if (alg.macroC * p.srcW * (alg.macroH * p.strideY + p.kernelY * p.dilationY - 1) * sizeof(float) <= Base::AlgCacheL2())
+                    break;
+            }
+        }
+
         void SynetConvolution32fNhwcDirect::ReorderWeight(const float* src, float* dst)
         {
             const ConvParam32f& p = _param;
@@ -1547,12 +1632,7 @@ namespace Simd
             a.F = F;
             a.microD = a.F*2;
             a.macroC = Simd::Min(Base::AlgCacheL1() / sizeof(float) / p.kernelY / p.kernelX / a.microD, p.srcC);
-            for (size_t macroH = p.dstH; macroH >= 1; macroH--)
-            {
-                a.macroH = macroH;
-                if (a.macroC * p.srcW * (a.macroH * p.strideY + p.kernelY * p.dilationY - 1) * sizeof(float) <= Base::AlgCacheL2())
-                    break;
-            }
+            SetMacroH(a);
             a.macroD = Simd::Min(AlignLoAny(Base::AlgCacheL3() / sizeof(float) / p.kernelY / p.kernelX / a.macroC, a.microD), AlignHiAny(p.dstC, a.microD));
             _old.weight.Resize(AlignHiAny(p.dstC, a.microD) * p.kernelY * p.kernelX * p.srcC);
             _rBias.Resize(AlignHiAny(p.dstC, a.microD), true);
@@ -1604,6 +1684,156 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        struct SynetTuningData
+        {
+            std::mutex mutex;
+            SimdSynetTuningType type;
+            std::map<String, String> winners;
+
+            SynetTuningData()
+                : type(SimdSynetTuningNone)
+            {
+            }
+        };
+
+        static SynetTuningData & GlobalSynetTuning()
+        {
+            static SynetTuningData data;
+            return data;
+        }
+
+        SimdSynetTuningType SynetTuning()
+        {
+            SynetTuningData & data = GlobalSynetTuning();
+            std::lock_guard<std::mutex> lock(data.mutex);
+            return data.type;
+        }
+
+        void SetSynetTuning(SimdSynetTuningType tuning)
+        {
+            SynetTuningData & data = GlobalSynetTuning();
+            std::lock_guard<std::mutex> lock(data.mutex);
+            data.type = tuning;
+        }
+
+        bool SynetTuningLoad(const char * path)
+        {
+            std::ifstream ifs(path);
+            if (!ifs.is_open())
+                return false;
+            SynetTuningData & data = GlobalSynetTuning();
+            std::lock_guard<std::mutex> lock(data.mutex);
+            String line;
+            while (std::getline(ifs, line))
+            {
+                if (line.empty() || line[0] == '#')
+                    continue;
+                std::stringstream ss(line);
+                String key, name;
+                ss >> key >> name;
+                if (key.empty() || name.empty())
+                    continue;
+                data.winners[key] = name;
+            }
+            return true;
+        }
+
+        bool SynetTuningSave(const char * path)
+        {
+            std::ofstream ofs(path);
+            if (!ofs.is_open())
+                return false;
+            SynetTuningData & data = GlobalSynetTuning();
+            std::lock_guard<std::mutex> lock(data.mutex);
+            ofs << "# Simd Library synet tuning: <key> <algorithm>" << std::endl;
+            for (std::map<String, String>::const_iterator it = data.winners.begin(); it != data.winners.end(); ++it)
+                ofs << it->first << " " << it->second << std::endl;
+            return !ofs.fail();
+        }
+
+        static String SynetConvolution32fTuningKey(const ConvParam32f & p, const String & ext)
+        {
+            std::stringstream ss;
+            ss << "Convolution32f:" << ext << ":";
+            ss << p.batch << "x" << p.srcC << "x" << p.srcH << "x" << p.srcW;
+            ss << "-" << p.dstC << "x" << p.kernelY << "x" << p.kernelX;
+            ss << "-" << p.dilationY << "x" << p.dilationX << "-" << p.strideY << "x" << p.strideX;
+            ss << "-" << p.padY << "x" << p.padX << "x" << p.padH << "x" << p.padW;
+            ss << "-" << p.group << "-" << p.trans << "-" << (int)p.activation;
+            return ss.str();
+        }
+
+        static double SynetConvolution32fBenchmark(SynetConvolution32f * conv)
+        {
+            const size_t RUN_COUNT = 3;
+            const ConvParam32f & p = conv->Param();
+            Array32f src(p.SizeS()), weight(p.SizeW()), bias(p.dstC), params(Simd::Max<size_t>(p.dstC, 2));
+            Array32f dst(p.SizeD()), buf(conv->ExternalBufferSize());
+            for (size_t i = 0; i < src.size; ++i)
+                src[i] = float(int(i % 17) - 8) * 0.125f;
+            for (size_t i = 0; i < weight.size; ++i)
+                weight[i] = float(int(i % 13) - 6) * 0.015625f;
+            for (size_t i = 0; i < bias.size; ++i)
+                bias[i] = 0.0f;
+            for (size_t i = 0; i < params.size; ++i)
+                params[i] = 0.1f;
+            if (p.activation == SimdConvolutionActivationHswish)
+                params[0] = 3.0f, params[1] = 1.0f / 6.0f;
+            else if (p.activation == SimdConvolutionActivationMish)
+                params[0] = 20.0f;
+            else
+                params[0] = 0.0f, params[1] = 6.0f;
+            conv->SetParams(weight.data, NULL, bias.data, params.data);
+            conv->Forward(src.data, buf.data, dst.data);
+            double best = DBL_MAX;
+            for (size_t r = 0; r < RUN_COUNT; ++r)
+            {
+                double start = Time();
+                conv->Forward(src.data, buf.data, dst.data);
+                best = Simd::Min(best, Time() - start);
+            }
+            return best;
+        }
+
+        void * SynetConvolution32fCandidates::Select() const
+        {
+            assert(_candidates.size());
+            SynetTuningData & data = GlobalSynetTuning();
+            SimdSynetTuningType type = SynetTuning();
+            if (type == SimdSynetTuningNone || _candidates.size() == 1)
+                return _candidates[0].create(_param);
+            String key = SynetConvolution32fTuningKey(_param, _ext);
+            {
+                std::lock_guard<std::mutex> lock(data.mutex);
+                std::map<String, String>::const_iterator it = data.winners.find(key);
+                if (it != data.winners.end())
+                {
+                    for (size_t i = 0; i < _candidates.size(); ++i)
+                        if (_candidates[i].name == it->second)
+                            return _candidates[i].create(_param);
+                }
+            }
+            if (type == SimdSynetTuningCached)
+                return _candidates[0].create(_param);
+            size_t best = 0;
+            double time = DBL_MAX;
+            for (size_t i = 0; i < _candidates.size(); ++i)
+            {
+                SynetConvolution32f * conv = _candidates[i].create(_param);
+                double current = SynetConvolution32fBenchmark(conv);
+                delete conv;
+                if (current < time)
+                    time = current, best = i;
+            }
+            {
+                std::lock_guard<std::mutex> lock(data.mutex);
+                data.winners[key] = _candidates[best].name;
+            }
+            return _candidates[best].create(_param);
+        }
+
+        //---------------------------------------------------------------------
+
 //#define SIMD_BASE_ONLY_GEMM_NN
 
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
@@ -1611,22 +1841,27 @@ namespace Simd
             ConvParam32f param(batch, conv, gemm);
             if (!param.Valid())
                 return NULL;
+            SynetConvolution32fCandidates candidates(param, "Base");
 #if !defined(SIMD_BASE_ONLY_GEMM_NN)
-            else if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
-                return new SynetConvolution32fDepthwiseDotProduct(param);
-            else if(SynetConvolution32fWinograd::Preferable(param))
-                return new SynetConvolution32fWinograd(param);
-            else if (SynetConvolution32fGemmNT::Preferable(param))
-                return new SynetConvolution32fGemmNT(param);
-            else if (SynetConvolution32fDirectNchw::Preferable(param))
-                return new SynetConvolution32fDirectNchw(param);
-            else if (SynetConvolution32fNhwcDirect::Preferable(param))
-                return new SynetConvolution32fNhwcDirect(param);
-            else if (SynetConvolution32fDirectNhwc::Preferable(param))
-                return new SynetConvolution32fDirectNhwc(param);
+            if (SynetConvolution32fDepthwiseDotProduct::Preferable(param))
+                candidates.Add<SynetConvolution32fDepthwiseDotProduct>("DepthwiseDotProduct");
+            if (SynetConvolution32fWinograd::Preferable(param))
+                candidates.Add<SynetConvolution32fWinograd>("Winograd");
+            if (SynetConvolution32fGemmNT::Preferable(param))
+                candidates.Add<SynetConvolution32fGemmNT>("GemmNT");
+            if (SynetConvolution32fDirectNchw::Preferable(param))
+                candidates.Add<SynetConvolution32fDirectNchw>("DirectNchw");
+            if (SynetConvolution32fNhwcDirect::Preferable(param))
+                candidates.Add<SynetConvolution32fNhwcDirect>("NhwcDirect");
+            if (SynetConvolution32fDirectNhwc::Preferable(param))
+                candidates.Add<SynetConvolution32fDirectNhwc>("DirectNhwc");
 #endif
-            else
-                return new SynetConvolution32fGemmNN(param);
+            candidates.Add<SynetConvolution32fGemmNN>("GemmNN");
+#if !defined(SIMD_BASE_ONLY_GEMM_NN)
+            if (SynetConvolution32fSparse::Preferable(param))
+                return new SynetConvolution32fSparse(param, (SynetConvolution32f*)candidates.Select());
+#endif
+            return candidates.Select();
         }
     }
 }
@@ -0,0 +1,230 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const float SYNET_CONVOLUTION32F_SPARSE_THRESHOLD = 0.70f;
+
+        static void SparseGemm(size_t M, size_t N, const int32_t * rows, const int32_t * cols, const float * values, const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; ++j)
+                    dst[j] = 0.0f;
+                for (int32_t k = rows[i], end = rows[i + 1]; k < end; ++k)
+                {
+                    const float * s = src + cols[k] * srcStride;
+                    float w = values[k];
+                    for (size_t j = 0; j < N; ++j)
+                        dst[j] += w * s[j];
+                }
+                dst += dstStride;
+            }
+        }
+
+        static void Transpose(const float * src, size_t srcStride, size_t rows, size_t cols, float * dst, size_t dstStride)
+        {
+            for (size_t r = 0; r < rows; ++r)
+                for (size_t c = 0; c < cols; ++c)
+                    dst[c * dstStride + r] = src[r * srcStride + c];
+        }
+
+        SynetConvolution32fSparse::SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense)
+            : SynetConvolution32f(p)
+            , _dense(dense)
+            , _sparse(false)
+            , _sparsity(0.0f)
+        {
+            _F = 1;
+            _sizeS = p.srcC * p.srcH * p.srcW;
+            _sizeD = p.dstC * p.dstH * p.dstW;
+            _sparseGemm = SparseGemm;
+            _transpose = Transpose;
+            _biasAndActivation = Base::ConvolutionBiasAndActivation;
+        }
+
+        SynetConvolution32fSparse::~SynetConvolution32fSparse()
+        {
+            delete _dense;
+        }
+
+        String SynetConvolution32fSparse::Desc() const
+        {
+            if (_sparse)
+                return Ext() + "::Sparse-" + ToStr(int(_sparsity * 100.0f));
+            else
+                return _dense->Desc();
+        }
+
+        size_t SynetConvolution32fSparse::ExternalBufferSize() const
+        {
+            const ConvParam32f & p = _param;
+            size_t size = p.trans ? (p.srcC + p.dstC) * TileSize() : 1;
+            return _dense ? Simd::Max(size, _dense->ExternalBufferSize()) : size;
+        }
+
+        size_t SynetConvolution32fSparse::InternalBufferSize() const
+        {
+            size_t size = _buffer.size + _values.size;
+            size += (_rows.size + _cols.size) * sizeof(int32_t) / sizeof(float);
+            for (size_t t = 0; t < _threadBuffers.size(); ++t)
+                size += _threadBuffers[t].size;
+            return _dense ? size + _dense->InternalBufferSize() : size;
+        }
+
+        void SynetConvolution32fSparse::SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params)
+        {
+            const ConvParam32f & p = _param;
+            size_t C = p.srcC, D = p.dstC, nonZero = 0;
+            for (size_t i = 0, n = C * D; i < n; ++i)
+                if (weight[i] != 0.0f)
+                    nonZero++;
+            _sparsity = 1.0f - float(nonZero) / float(C * D);
+            _sparse = _dense == NULL || _sparsity >= SYNET_CONVOLUTION32F_SPARSE_THRESHOLD ||
+                ((_dense->Param().srcH != p.srcH || _dense->Param().srcW != p.srcW) && !_dense->Reshape(p.srcH, p.srcW));
+            if (_sparse)
+            {
+                delete _dense;
+                _dense = NULL;
+                Simd::SynetConvolution32f::SetParams(weight, internal, bias, params);
+                _rows.Resize(D + 1);
+                _cols.Resize(nonZero);
+                _values.Resize(nonZero);
+                for (size_t d = 0, k = 0; d < D; ++d)
+                {
+                    _rows[d] = (int32_t)k;
+                    for (size_t c = 0; c < C; ++c)
+                    {
+                        float w = p.trans ? weight[c * D + d] : weight[d * C + c];
+                        if (w != 0.0f)
+                        {
+                            _cols[k] = (int32_t)c;
+                            _values[k] = w;
+                            k++;
+                        }
+                    }
+                }
+                _rows[D] = (int32_t)nonZero;
+                if (internal)
+                    *internal = SimdTrue;
+            }
+            else
+            {
+                _rows.Resize(0);
+                _cols.Resize(0);
+                _values.Resize(0);
+                _dense->SetParams(weight, internal, bias, params);
+            }
+        }
+
+        void SynetConvolution32fSparse::Forward(const float * src, float * buf, float * dst)
+        {
+            if (!_sparse)
+            {
+                _dense->Forward(src, buf, dst);
+                return;
+            }
+            const ConvParam32f & p = _param;
+            size_t N = p.dstH * p.dstW, tile = TileSize(), threads = Base::GetThreadNumber();
+            const int32_t * rows = _rows.data, * cols = _cols.data;
+            const float * values = _values.data;
+            if (p.trans)
+            {
+                buf = Buffer(buf);
+                if (threads > 1)
+                    tile = Simd::Min(tile, AlignHi(DivHi(N * p.batch, threads * SIMD_PARALLEL_BLOCKS_PER_THREAD), _F));
+                size_t tiles = DivHi(N, tile);
+                if (_threadBuffers.size() < threads)
+                    _threadBuffers.resize(threads);
+                Simd::Parallel(0, p.batch * tiles, [&](size_t thread, size_t begin, size_t end)
+                {
+                    float * bufS = buf;
+                    if (thread)
+                    {
+                        _threadBuffers[thread].Resize((p.srcC + p.dstC) * tile);
+                        bufS = _threadBuffers[thread].data;
+                    }
+                    float * bufD = bufS + p.srcC * tile;
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        size_t b = i / tiles, n = i % tiles * tile, T = Simd::Min(tile, N - n);
+                        _transpose(src + b * _sizeS + n * p.srcC, p.srcC, T, p.srcC, bufS, T);
+                        _sparseGemm(p.dstC, T, rows, cols, values, bufS, T, bufD, T);
+                        _biasAndActivation(_bias, p.dstC, T, p.activation, _params, SimdFalse, bufD);
+                        _transpose(bufD, T, p.dstC, T, dst + b * _sizeD + n * p.dstC, p.dstC);
+                    }
+                }, threads);
+            }
+            else
+            {
+                Simd::Parallel(0, p.dstC, [&](size_t thread, size_t begin, size_t end)
+                {
+                    size_t count = end - begin;
+                    const float * bias = _bias ? _bias + begin : NULL;
+                    const float * params = p.activation == ::SimdConvolutionActivationPrelu ? _params + begin : _params;
+                    for (size_t b = 0; b < p.batch; ++b)
+                    {
+                        const float * s = src + b * _sizeS;
+                        float * d = dst + b * _sizeD + begin * N;
+                        for (size_t n = 0; n < N; n += tile)
+                            _sparseGemm(count, Simd::Min(tile, N - n), rows + begin, cols, values, s + n, N, d + n, N);
+                        _biasAndActivation(bias, count, N, p.activation, params, SimdFalse, d);
+                    }
+                }, threads);
+            }
+        }
+
+        bool SynetConvolution32fSparse::Reshape(size_t srcH, size_t srcW)
+        {
+            if (!_sparse && !_dense->Reshape(srcH, srcW))
+                return false;
+            if (!ReshapeParam(srcH, srcW))
+                return false;
+            const ConvParam32f & p = _param;
+            _sizeS = p.srcC * p.srcH * p.srcW;
+            _sizeD = p.dstC * p.dstH * p.dstW;
+            return true;
+        }
+
+        bool SynetConvolution32fSparse::Preferable(const ConvParam32f & p)
+        {
+            return p.IsKernel(1) && p.IsDilation(1) && p.IsStride(1) && p.IsPad(0) && p.group == 1 && p.srcC >= 16 && p.dstC >= 16;
+        }
+
+        size_t SynetConvolution32fSparse::TileSize() const
+        {
+            const ConvParam32f & p = _param;
+            size_t N = p.dstH * p.dstW, size = (p.trans ? p.srcC + p.dstC : p.srcC) * sizeof(float);
+            size_t tile = AlignLo(Base::AlgCacheL2() / 2 / size, _F);
+            return Simd::RestrictRange<size_t>(tile, _F, AlignHi(N, _F));
+        }
+    }
+}
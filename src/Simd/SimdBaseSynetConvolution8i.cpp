@@ -28,6 +28,7 @@
 #include "Simd/SimdBase.h"
 #include "Simd/SimdCpu.h"
 #include "Simd/SimdLog.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -246,6 +247,25 @@ namespace Simd
         }
     }
 
+    bool SynetConvolution8i::Reshape(size_t srcH, size_t srcW)
+    {
+        return false;
+    }
+
+    bool SynetConvolution8i::ReshapeParam(size_t srcH, size_t srcW)
+    {
+        ConvParam8i param = _param;
+        if (!param.Reshape(srcH, srcW))
+            return false;
+        _param = param;
+        _sizeS = param.srcC * param.srcH * param.srcW;
+        _sizeD = param.dstC * param.dstH * param.dstW;
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+        _perf = NULL;
+#endif
+        return true;
+    }
+
 #if defined(SIMD_PERFORMANCE_STATISTIC)
     Base::PerformanceMeasurer * SynetConvolution8i::Perf(const char* func)
     {
@@ -259,9 +279,26 @@ namespace Simd
 
     namespace Base
     {
+        static size_t SynetConvolution8iNhwcMerge(const ConvParam8i& p)
+        {
+            size_t sizeS = p.srcC * p.srcH * p.srcW, merge = 1;
+            for (size_t m = 2; m <= p.batch; ++m)
+                if (p.batch % m == 0 && sizeS * m <= Base::AlgCacheL3())
+                    merge = m;
+            return merge;
+        }
+
+        //---------------------------------------------------------------------
+
         SynetConvolution8iGemmNN::SynetConvolution8iGemmNN(const ConvParam8i& p)
             : SynetConvolution8i(p)
         {
+            SetSize();
+        }
+
+        void SynetConvolution8iGemmNN::SetSize()
+        {
+            const ConvParam8i& p = _param;
             if (p.IsDilation(1) && p.IsStride(1) && p.IsPad(0))
             {
                 _skipConv = p.IsKernel(1) || (p.srcH == p.kernelY && p.srcW == p.kernelX);
@@ -304,6 +341,14 @@ namespace Simd
             return size;
         }
 
+        bool SynetConvolution8iGemmNN::Reshape(size_t srcH, size_t srcW)
+        {
+            if (!ReshapeParam(srcH, srcW))
+                return false;
+            SetSize();
+            return true;
+        }
+
         void SynetConvolution8iGemmNN::Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst)
         {
             const ConvParam8i& p = _param;
@@ -380,12 +425,14 @@ namespace Simd
         {
             for (size_t i = 0; i < Term8iSize; ++i)
                 _convolutions[i] = NULL;
+            _merge = SynetConvolution8iNhwcMerge(p);
         }
 
         String SynetConvolution8iNhwcDirect::Desc() const
         {
             const ConvParam8i& p = _param;
-            return Ext() + "::NhwcDirect" + (Overflow(p.compatibility) ? "-o" : (Narrowed(p.compatibility) ? "-n" : "-p"));
+            return Ext() + "::NhwcDirect" + (Overflow(p.compatibility) ? "-o" : (Narrowed(p.compatibility) ? "-n" : "-p")) + 
+                (_merge > 1 ? "*" + ToStr(_merge) : "");
         }
 
         size_t SynetConvolution8iNhwcDirect::InternalBufferSize() const
@@ -399,7 +446,7 @@ namespace Simd
             const ConvParam8i& p = _param;
             size_t size = SynetConvolution8i::ExternalBufferSize();
             if (_alg.macroC < p.srcC)
-                size += AlignHi(_sizeD * sizeof(int32_t), SIMD_ALIGN);
+                size += AlignHi(_sizeD * _merge * sizeof(int32_t), SIMD_ALIGN);
             return size;
         }
 
@@ -411,6 +458,15 @@ namespace Simd
             _alg.upper = Set4(_dstCvt.uMax);
         }
 
+        bool SynetConvolution8iNhwcDirect::Reshape(size_t srcH, size_t srcW)
+        {
+            if (!ReshapeParam(srcH, srcW))
+                return false;
+            _merge = SynetConvolution8iNhwcMerge(_param);
+            SetAlgParam(_alg.F, _alg.microD, Base::AlgCacheL1(), Base::AlgCacheL2(), Base::AlgCacheL3());
+            return true;
+        }
+
         bool SynetConvolution8iNhwcDirect::Preferable(const ConvParam8i& p)
         {
             return false;
@@ -468,66 +524,73 @@ namespace Simd
         void SynetConvolution8iNhwcDirect::Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst)
         {
             const ConvParam8i& p = _param;
-            int32_t* sum = _alg.macroC < p.srcC ? Allocate<int32_t>(buf, _sizeD) : NULL;
-            for (size_t m = 0; m < _merge; ++m)
+            int32_t* sum = _alg.macroC < p.srcC ? Allocate<int32_t>(buf, _sizeD * _merge) : NULL;
+            if (p.Is1x1() && _merge > 1)
             {
-                Forward8u(src, sum, dst);
-                src += _sizeS;
-                dst += _sizeD * (_dst8u ? sizeof(uint8_t) : sizeof(float));
+                ConvParam8i merged = p;
+                merged.srcH = p.srcH * _merge;
+                merged.dstH = p.dstH * _merge;
+                merged.batch = 1;
+                Forward8u(merged, 1, src, sum, dst);
             }
+            else
+                Forward8u(p, _merge, src, sum, dst);
         }
 
-        void SynetConvolution8iNhwcDirect::Forward8u(const uint8_t* src, int32_t* buf, uint8_t* dst)
+        void SynetConvolution8iNhwcDirect::Forward8u(const ConvParam8i& p, size_t batch, const uint8_t* src, int32_t* buf, uint8_t* dst)
         {
-            const ConvParam8i& p = _param;
-            const int8_t* weight = _weight.data;
-            const float* norm = _norm.data;
-            const float* bias = _bias.data;
-            const float* params = _params.data;
-            const float* scale = _dstCvt.scale.data;
-            const float* shift = _dstCvt.shift.data;
-            for (size_t dc = 0; dc < p.dstC; dc += _alg.macroD)
+            size_t sizeS = p.srcC * p.srcH * p.srcW, sizeD = p.dstC * p.dstH * p.dstW;
+            size_t threads = Base::GetThreadNumber(), macroH = _alg.macroH;
+            if (threads > 1)
+                macroH = Simd::Min(macroH, Simd::Max<size_t>(DivHi(p.dstH * batch, threads * SIMD_PARALLEL_BLOCKS_PER_THREAD), 1));
+            size_t blocksH = DivHi(p.dstH, macroH);
+            // images are the inner index: a range of a thread passes all its images through a row block with the same weights.
+            Simd::Parallel(0, batch * blocksH, [&](size_t thread, size_t begin, size_t end)
             {
-                size_t macroD = Simd::Min(p.dstC, dc + _alg.macroD) - dc;
-                for (size_t sc = 0; sc < p.srcC; sc += _alg.macroC)
+                const int8_t* weight = _weight.data;
+                const float* norm = _norm.data;
+                const float* bias = _bias.data;
+                const float* params = _params.data;
+                const float* scale = _dstCvt.scale.data;
+                const float* shift = _dstCvt.shift.data;
+                int32_t* sum = buf;
+                uint8_t* out = dst;
+                for (size_t dc = 0; dc < p.dstC; dc += _alg.macroD)
                 {
-                    size_t macroC = Simd::Min(p.srcC, sc + _alg.macroC) - sc;
-                    for (size_t yBeg = 0; yBeg < p.dstH;)
+                    size_t macroD = Simd::Min(p.dstC, dc + _alg.macroD) - dc;
+                    for (size_t sc = 0; sc < p.srcC; sc += _alg.macroC)
                     {
-                        size_t yEnd = Simd::Min(yBeg + _alg.macroH, p.dstH);
+                        size_t macroC = Simd::Min(p.srcC, sc + _alg.macroC) - sc;
+                        Term8iType term;
                         if (_alg.macroC == p.srcC)
-                        {
-                            if (_alg.size == 1)
-                                _convolutions[Term8iSingle8u](src + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params, scale, shift, buf, dst);
-                            else
-                                _convolutions[Term8iSingle32f](src + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params, scale, shift, buf, dst);
-                        }
+                            term = _alg.size == 1 ? Term8iSingle8u : Term8iSingle32f;
                         else if (sc == 0)
-                            _convolutions[Term8iFirst](src + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params, scale, shift, buf, dst);
+                            term = Term8iFirst;
                         else if (sc + macroC == p.srcC)
+                            term = _alg.size == 1 ? Term8iLast8u : Term8iLast32f;
+                        else
+                            term = Term8iIterim;
+                        ConvolutionPtr convolution = _convolutions[term];
+                        for (size_t i = begin; i < end; ++i)
                         {
-                            if (_alg.size == 1)
-                                _convolutions[Term8iLast8u](src + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params, scale, shift, buf, dst);
-                            else
-                                _convolutions[Term8iLast32f](src + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params, scale, shift, buf, dst);
+                            size_t b = i % batch, yBeg = i / batch * macroH, yEnd = Simd::Min(yBeg + macroH, p.dstH);
+                            convolution(src + b * sizeS + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params,
+                                scale, shift, sum ? sum + b * sizeD : NULL, out + b * sizeD * _alg.size);
                         }
-                        else
-                            _convolutions[Term8iIterim](src + sc, p, _alg, macroD, yBeg, yEnd, macroC, weight, norm, bias, params, scale, shift, buf, dst);
-                        yBeg = yEnd;
+                        weight += DivHi(macroC, 4) * _alg.F * 4;
                     }
-                    weight += DivHi(macroC, 4) * _alg.F * 4;
+                    weight += p.kernelY * p.kernelX * DivHi(p.srcC, 4) * macroD * 4 - DivHi(p.srcC, 4) * _alg.F * 4;
+                    norm += macroD;
+                    bias += macroD;
+                    if (p.activation == ::SimdConvolutionActivationLeakyRelu || p.activation == ::SimdConvolutionActivationPrelu)
+                        params += macroD;
+                    shift += macroD;
+                    scale += macroD;
+                    if (sum)
+                        sum += _alg.macroD;
+                    out += _alg.macroD * _alg.size;
                 }
-                weight += p.kernelY * p.kernelX * DivHi(p.srcC, 4) * macroD * 4 - DivHi(p.srcC, 4) * _alg.F * 4;
-                norm += macroD;
-                bias += macroD;
-                if (p.activation == ::SimdConvolutionActivationLeakyRelu || p.activation == ::SimdConvolutionActivationPrelu)
-                    params += macroD;
-                shift += macroD;
-                scale += macroD;
-                if (buf)
-                    buf += _alg.macroD;
-                dst += _alg.macroD * _alg.size;
-            }
+            }, threads);
         }
 
         //---------------------------------------------------------------------
@@ -536,12 +599,14 @@ namespace Simd
             : SynetConvolution8i(p)
         {
             _convolution = NULL;
+            _merge = SynetConvolution8iNhwcMerge(p);
         }
 
         String SynetConvolution8iNhwcDepthwise::Desc() const
         {
             const ConvParam8i& p = _param;
-            return Ext() + "::NhwcDepthwise" + (Overflow(p.compatibility) ? "-o" : (Narrowed(p.compatibility) ? "-n" : "-p"));
+            return Ext() + "::NhwcDepthwise" + (Overflow(p.compatibility) ? "-o" : (Narrowed(p.compatibility) ? "-n" : "-p")) +
+                (_merge > 1 ? "*" + ToStr(_merge) : "");
         }
 
         void SynetConvolution8iNhwcDepthwise::SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
@@ -552,6 +617,14 @@ namespace Simd
             _alg.size = (_param.dstT == SimdTensorData32f ? 4 : 1);
         }
 
+        bool SynetConvolution8iNhwcDepthwise::Reshape(size_t srcH, size_t srcW)
+        {
+            if (!ReshapeParam(srcH, srcW))
+                return false;
+            _merge = SynetConvolution8iNhwcMerge(_param);
+            return true;
+        }
+
         bool SynetConvolution8iNhwcDepthwise::Preferable(const ConvParam8i& p)
         {
             return false;
@@ -565,14 +638,274 @@ namespace Simd
             const float* params = _params.data;
             const float* scale = _dstCvt.scale.data;
             const float* shift = _dstCvt.shift.data;
-            for (size_t m = 0; m < _merge; ++m)
+            Simd::Parallel(0, _merge, [&](size_t thread, size_t begin, size_t end)
             {
-                _convolution(src, _param, _alg, weight, norm, bias, params, scale, shift, dst);
-                src += _sizeS;
-                dst += _sizeD * _alg.size;
+                for (size_t m = begin; m < end; ++m)
+                    _convolution(src + m * _sizeS, _param, _alg, weight, norm, bias, params, scale, shift, dst + m * _sizeD * _alg.size);
+            }, Base::GetThreadNumber());
+        }
+
+        //---------------------------------------------------------------------
+
+        using WinogradAlgParam = SynetConvolution8iNhwcWinograd::AlgParam;
+
+        // Transformed input is in [-510, 510] and transformed weight is in [-1152, 1152], so int32 GEMM accumulators
+        // (up to 587520 * srcC) can't overflow for srcC <= 3655. Output transform sums up to 9 of them and is done in int64.
+        const size_t WINOGRAD_8I_SRC_C_MAX = 2048;
+
+        static void WinogradKernel3x3Block2x2SetInput8i(const uint8_t* src, const ConvParam8i& p, const WinogradAlgParam& a, size_t tileY, size_t tileE, uint8_t zero, int16_t* dst)
+        {
+            int16_t s[16];
+            for (size_t ty = tileY; ty < tileE; ++ty)
+            {
+                for (size_t tx = 0; tx < a.tileW; ++tx)
+                {
+                    int16_t* pDst = dst + ((ty - tileY) * a.tileW + tx) * a.srcC;
+                    for (size_t c = 0; c < p.srcC; ++c)
+                    {
+                        for (size_t row = 0, i = 0; row < 4; ++row)
+                        {
+                            size_t sy = ty * 2 + row - p.padY;
+                            for (size_t col = 0; col < 4; ++col, ++i)
+                            {
+                                size_t sx = tx * 2 + col - p.padX;
+                                s[i] = (sy < p.srcH && sx < p.srcW) ? src[(sy * p.srcW + sx) * p.srcC + c] : zero;
+                            }
+                        }
+                        int16_t t[16];
+                        for (size_t col = 0; col < 4; ++col)
+                        {
+                            t[0 + col] = s[0 + col] - s[8 + col];
+                            t[4 + col] = s[4 + col] + s[8 + col];
+                            t[8 + col] = s[8 + col] - s[4 + col];
+                            t[12 + col] = s[4 + col] - s[12 + col];
+                        }
+                        for (size_t row = 0; row < 16; row += 4)
+                        {
+                            pDst[(row + 0) * a.strideS + c] = t[row + 0] - t[row + 2];
+                            pDst[(row + 1) * a.strideS + c] = t[row + 1] + t[row + 2];
+                            pDst[(row + 2) * a.strideS + c] = t[row + 2] - t[row + 1];
+                            pDst[(row + 3) * a.strideS + c] = t[row + 1] - t[row + 3];
+                        }
+                    }
+                    for (size_t c = p.srcC; c < a.srcC; ++c)
+                        for (size_t i = 0; i < 16; ++i)
+                            pDst[i * a.strideS + c] = 0;
+                }
+            }
+        }
+
+        static void WinogradGemm8i(size_t M, size_t N, size_t K, const int16_t* src, const int16_t* weight, int32_t* dst)
+        {
+            for (size_t i = 0; i < M; ++i)
+            {
+                for (size_t j = 0; j < N; ++j)
+                    dst[j] = 0;
+                for (size_t k = 0; k < K; k += 2)
+                {
+                    int32_t s0 = src[k + 0], s1 = src[k + 1];
+                    const int16_t* w = weight + k * N;
+                    for (size_t j = 0; j < N; ++j)
+                        dst[j] += s0 * w[2 * j + 0] + s1 * w[2 * j + 1];
+                }
+                src += K;
+                dst += N;
             }
         }
 
+        template<::SimdConvolutionActivationType type> void WinogradKernel3x3Block2x2SetOutput8i(const int32_t* src, const ConvParam8i& p, const WinogradAlgParam& a,
+            size_t tileY, size_t tileE, const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst)
+        {
+            for (size_t ty = tileY; ty < tileE; ++ty)
+            {
+                size_t rows = Simd::Min<size_t>(2, p.dstH - ty * 2);
+                for (size_t tx = 0; tx < a.tileW; ++tx)
+                {
+                    size_t cols = Simd::Min<size_t>(2, p.dstW - tx * 2);
+                    const int32_t* pSrc = src + ((ty - tileY) * a.tileW + tx) * a.dstC;
+                    for (size_t d = 0; d < p.dstC; ++d)
+                    {
+                        int64_t s[16], t[8];
+                        for (size_t i = 0; i < 16; ++i)
+                            s[i] = pSrc[i * a.strideD + d];
+                        for (size_t col = 0; col < 4; ++col)
+                        {
+                            t[0 + col] = s[0 + col] + s[4 + col] + s[8 + col];
+                            t[4 + col] = s[4 + col] - s[8 + col] - s[12 + col];
+                        }
+                        int64_t o[4];
+                        o[0] = t[0] + t[1] + t[2];
+                        o[1] = t[1] - t[2] - t[3];
+                        o[2] = t[4] + t[5] + t[6];
+                        o[3] = t[5] - t[6] - t[7];
+                        for (size_t row = 0; row < rows; ++row)
+                        {
+                            for (size_t col = 0; col < cols; ++col)
+                            {
+                                size_t offset = ((ty * 2 + row) * p.dstW + tx * 2 + col) * p.dstC + d;
+                                float value = Activate<type>(float(o[row * 2 + col]) * norm[d] * 0.25f + bias[d], params, d);
+                                if (a.size == 1)
+                                    dst[offset] = Convert<float, uint8_t, float>(value, scale[d], shift[d], a.lower, a.upper);
+                                else
+                                    ((float*)dst)[offset] = value;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        static SynetConvolution8iNhwcWinograd::SetOutputPtr GetWinogradSetOutput8i(::SimdConvolutionActivationType type)
+        {
+            switch (type)
+            {
+            case SimdConvolutionActivationIdentity: return WinogradKernel3x3Block2x2SetOutput8i<SimdConvolutionActivationIdentity>;
+            case SimdConvolutionActivationRelu: return WinogradKernel3x3Block2x2SetOutput8i<SimdConvolutionActivationRelu>;
+            case SimdConvolutionActivationLeakyRelu: return WinogradKernel3x3Block2x2SetOutput8i<SimdConvolutionActivationLeakyRelu>;
+            case SimdConvolutionActivationRestrictRange: return WinogradKernel3x3Block2x2SetOutput8i<SimdConvolutionActivationRestrictRange>;
+            case SimdConvolutionActivationPrelu: return WinogradKernel3x3Block2x2SetOutput8i<SimdConvolutionActivationPrelu>;
+            case SimdConvolutionActivationElu: return WinogradKernel3x3Block2x2SetOutput8i<SimdConvolutionActivationElu>;
+            case SimdConvolutionActivationHswish: return WinogradKernel3x3Block2x2SetOutput8i<SimdConvolutionActivationHswish>;
+            case SimdConvolutionActivationMish: return WinogradKernel3x3Block2x2SetOutput8i<SimdConvolutionActivationMish>;
+            default:
+                assert(0);
+                return NULL;
+            }
+        }
+
+        SynetConvolution8iNhwcWinograd::SynetConvolution8iNhwcWinograd(const ConvParam8i& p)
+            : SynetConvolution8i(p)
+        {
+            SetAlgParam(1, Base::AlgCacheL2());
+            _setInput = WinogradKernel3x3Block2x2SetInput8i;
+            _gemm = WinogradGemm8i;
+            _setOutput = GetWinogradSetOutput8i(p.activation);
+        }
+
+        String SynetConvolution8iNhwcWinograd::Desc() const
+        {
+            const ConvParam8i& p = _param;
+            return Ext() + "::NhwcWinograd F(2x2,3x3)" + (Narrowed(p.compatibility) ? "-n" : "-p") + (_alg.tileHs < _alg.tileH ? "/" + ToStr(DivHi(_alg.tileH, _alg.tileHs)) : "");
+        }
+
+        size_t SynetConvolution8iNhwcWinograd::InternalBufferSize() const
+        {
+            size_t size = SynetConvolution8i::InternalBufferSize() + _winogradWeight.size * sizeof(int16_t);
+            for (size_t t = 0; t < _threadBuffers.size(); ++t)
+                size += _threadBuffers[t].size;
+            return size;
+        }
+
+        size_t SynetConvolution8iNhwcWinograd::ExternalBufferSize() const
+        {
+            return SynetConvolution8i::ExternalBufferSize() + ThreadBufferSize();
+        }
+
+        size_t SynetConvolution8iNhwcWinograd::ThreadBufferSize() const
+        {
+            return AlignHi(16 * _alg.strideS * sizeof(int16_t), SIMD_ALIGN) + AlignHi(16 * _alg.strideD * sizeof(int32_t), SIMD_ALIGN);
+        }
+
+        void SynetConvolution8iNhwcWinograd::SetParams(const float* weight, const float* bias, const float* params, const float* const* stats)
+        {
+            SynetConvolution8i::SetParams(weight, bias, params, stats);
+            SetWeight();
+            _alg.lower = _dstCvt.uMin;
+            _alg.upper = _dstCvt.uMax;
+        }
+
+        bool SynetConvolution8iNhwcWinograd::Reshape(size_t srcH, size_t srcW)
+        {
+            if (!ReshapeParam(srcH, srcW))
+                return false;
+            SetAlgParam(_alg.F, Base::AlgCacheL2());
+            return true;
+        }
+
+        bool SynetConvolution8iNhwcWinograd::Preferable(const ConvParam8i& p)
+        {
+            return p.trans && p.group == 1 && p.IsKernel(3) && p.IsDilation(1) && p.IsStride(1) && (p.IsPad(0) || p.IsPad(1)) &&
+                !Overflow(p.compatibility) && p.srcC >= 16 && p.srcC <= WINOGRAD_8I_SRC_C_MAX && p.dstC >= 16 && p.dstH >= 4 && p.dstW >= 4;
+        }
+
+        void SynetConvolution8iNhwcWinograd::SetAlgParam(size_t F, size_t L2)
+        {
+            const ConvParam8i& p = _param;
+            _alg.F = F;
+            _alg.tileH = DivHi(p.dstH, 2);
+            _alg.tileW = DivHi(p.dstW, 2);
+            _alg.srcC = AlignHi(p.srcC, 2);
+            _alg.dstC = AlignHi(p.dstC, F);
+            size_t tileSize = 16 * (_alg.srcC * sizeof(int16_t) + _alg.dstC * sizeof(int32_t)) * _alg.tileW;
+            _alg.tileHs = Simd::RestrictRange<size_t>(L2 / 2 / tileSize, 1, _alg.tileH);
+            _alg.strideS = _alg.tileHs * _alg.tileW * _alg.srcC;
+            _alg.strideD = _alg.tileHs * _alg.tileW * _alg.dstC;
+            _alg.size = (p.dstT == SimdTensorData32f ? 4 : 1);
+        }
+
+        void SynetConvolution8iNhwcWinograd::SetWeight()
+        {
+            const ConvParam8i& p = _param;
+            size_t C = p.srcC, D = p.dstC, CA = _alg.srcC, DA = _alg.dstC;
+            _winogradWeight.Resize(16 * CA * DA, true);
+            for (size_t c = 0; c < C; ++c)
+            {
+                for (size_t d = 0; d < D; ++d)
+                {
+                    int32_t g[9], t[12];
+                    for (size_t k = 0; k < 9; ++k)
+                        g[k] = _weight[(k * C + c) * D + d];
+                    for (size_t col = 0; col < 3; ++col)
+                    {
+                        t[0 + col] = 2 * g[0 + col];
+                        t[3 + col] = g[0 + col] + g[3 + col] + g[6 + col];
+                        t[6 + col] = g[0 + col] - g[3 + col] + g[6 + col];
+                        t[9 + col] = 2 * g[6 + col];
+                    }
+                    int16_t* dst = _winogradWeight.data + ((c & ~1) * DA + d * 2 + (c & 1));
+                    size_t stride = CA * DA;
+                    for (size_t row = 0; row < 4; ++row)
+                    {
+                        const int32_t* r = t + row * 3;
+                        dst[(row * 4 + 0) * stride] = int16_t(2 * r[0]);
+                        dst[(row * 4 + 1) * stride] = int16_t(r[0] + r[1] + r[2]);
+                        dst[(row * 4 + 2) * stride] = int16_t(r[0] - r[1] + r[2]);
+                        dst[(row * 4 + 3) * stride] = int16_t(2 * r[2]);
+                    }
+                }
+            }
+        }
+
+        void SynetConvolution8iNhwcWinograd::Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst)
+        {
+            const ConvParam8i& p = _param;
+            const AlgParam& a = _alg;
+            size_t threads = Base::GetThreadNumber(), tileHs = a.tileHs;
+            if (threads > 1)
+                tileHs = Simd::Min(tileHs, DivHi(a.tileH, threads * SIMD_PARALLEL_BLOCKS_PER_THREAD));
+            if (_threadBuffers.size() < threads)
+                _threadBuffers.resize(threads);
+            Simd::Parallel(0, DivHi(a.tileH, tileHs), [&](size_t thread, size_t begin, size_t end)
+            {
+                uint8_t* tmp = buf;
+                if (thread)
+                {
+                    _threadBuffers[thread].Resize(ThreadBufferSize());
+                    tmp = _threadBuffers[thread].data;
+                }
+                int16_t* bufS = Allocate<int16_t>(tmp, 16 * a.strideS);
+                int32_t* bufD = Allocate<int32_t>(tmp, 16 * a.strideD);
+                for (size_t tileY = begin * tileHs, tileB = Simd::Min(end * tileHs, a.tileH); tileY < tileB; tileY += tileHs)
+                {
+                    size_t tileE = Simd::Min(tileY + tileHs, tileB), M = (tileE - tileY) * a.tileW;
+                    _setInput(src, p, a, tileY, tileE, _srcCvt.zero[0], bufS);
+                    for (size_t i = 0; i < 16; ++i)
+                        _gemm(M, a.dstC, a.srcC, bufS + i * a.strideS, _winogradWeight.data + i * a.srcC * a.dstC, bufD + i * a.strideD);
+                    _setOutput(bufD, p, a, tileY, tileE, _norm.data, _bias.data, _params.data, _dstCvt.scale.data, _dstCvt.shift.data, dst);
+                }
+            }, threads);
+        }
+
         //---------------------------------------------------------------------
 
 //#define SIMD_BASE_ONLY_GEMM_NN
@@ -585,6 +918,8 @@ namespace Simd
 #if !defined(SIMD_BASE_ONLY_GEMM_NN)
             else if (SynetConvolution8iNhwcDepthwise::Preferable(param))
                 return new SynetConvolution8iNhwcDepthwise(param);
+            else if (SynetConvolution8iNhwcWinograd::Preferable(param))
+                return new SynetConvolution8iNhwcWinograd(param);
             else if (SynetConvolution8iNhwcDirect::Preferable(param))
                 return new SynetConvolution8iNhwcDirect(param);
 #endif
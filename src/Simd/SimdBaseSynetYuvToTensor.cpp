@@ -0,0 +1,177 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdSynetYuvToTensor.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        static void BlendRows(const float * row0, const float * row1, float alpha, const float * scale, const float * shift, size_t size, float * dst)
+        {
+            for (size_t i = 0; i < size; ++i)
+                dst[i] = (row0[i] + (row1[i] - row0[i]) * alpha) * scale[i] + shift[i];
+        }
+
+        SynetYuvToTensor::SynetYuvToTensor(const YuvToTensorParam & param)
+            : _param(param)
+        {
+            const YuvToTensorParam & p = _param;
+            _ix.Resize(p.dstW);
+            _ax.Resize(p.dstW);
+            EstimateIndexAlpha(p.srcW, p.dstW, 3, _ix.data, _ax.data);
+            _iy.Resize(p.dstH);
+            _ay.Resize(p.dstH);
+            EstimateIndexAlpha(p.srcH, p.dstH, 1, _iy.data, _ay.data);
+            _stepX = p.format == SimdTensorFormatNhwc ? 3 : 1;
+            _stepC = p.format == SimdTensorFormatNhwc ? 1 : p.dstW;
+            _scale.Resize(p.dstW * 3);
+            _shift.Resize(p.dstW * 3);
+            for (size_t x = 0; x < p.dstW; ++x)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    _scale[x * _stepX + c * _stepC] = p.scale[c];
+                    _shift[x * _stepX + c * _stepC] = -p.mean[c] * p.scale[c];
+                }
+            }
+            _rows[0].Resize(p.dstW * 3);
+            _rows[1].Resize(p.dstW * 3);
+            _bgr.Resize(p.srcW * 3 * 2);
+            if (p.layout == SimdYuvLayoutNv12)
+                _uv.Resize(AlignHi(p.srcW / 2, SIMD_ALIGN) * 2);
+            _yuv420pToBgr = Base::Yuv420pToBgr;
+            _deinterleaveUv = Base::DeinterleaveUv;
+            _blendRows = BlendRows;
+        }
+
+        void SynetYuvToTensor::EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t step, int32_t * indices, float * alphas)
+        {
+            float scale = float(srcSize) / float(dstSize);
+            for (size_t i = 0; i < dstSize; ++i)
+            {
+                float alpha = (float(i) + 0.5f) * scale - 0.5f;
+                ptrdiff_t index = (ptrdiff_t)::floor(alpha);
+                alpha -= float(index);
+                if (index < 0)
+                {
+                    index = 0;
+                    alpha = 0.0f;
+                }
+                if (index >= (ptrdiff_t)srcSize - 1)
+                {
+                    index = srcSize - 2;
+                    alpha = 1.0f;
+                }
+                indices[i] = int32_t(index * step);
+                alphas[i] = alpha;
+            }
+        }
+
+        void SynetYuvToTensor::SetRow(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, ptrdiff_t row, float * dst)
+        {
+            const YuvToTensorParam & p = _param;
+            size_t bgrStride = p.srcW * 3;
+            ptrdiff_t pair = row / 2;
+            if (pair != _pairY)
+            {
+                y += pair * 2 * yStride;
+                if (p.layout == SimdYuvLayoutNv12)
+                {
+                    size_t uvStride = _uv.size / 2;
+                    _deinterleaveUv(u + pair * uStride, uStride, p.srcW / 2, 1, _uv.data, uvStride, _uv.data + uvStride, uvStride);
+                    _yuv420pToBgr(y, yStride, _uv.data, uvStride, _uv.data + uvStride, uvStride, p.srcW, 2, _bgr.data, bgrStride);
+                }
+                else
+                    _yuv420pToBgr(y, yStride, u + pair * uStride, uStride, v + pair * vStride, vStride, p.srcW, 2, _bgr.data, bgrStride);
+                _pairY = pair;
+            }
+            const uint8_t * bgr = _bgr.data + (row & 1) * bgrStride;
+            size_t offset[3];
+            for (size_t c = 0; c < 3; ++c)
+                offset[c] = (p.order == SimdPixelFormatRgb24 ? 2 - c : c) * _stepC;
+            for (size_t x = 0; x < p.dstW; ++x)
+            {
+                const uint8_t * s = bgr + _ix[x];
+                float a = _ax[x];
+                float * d = dst + x * _stepX;
+                for (size_t c = 0; c < 3; ++c)
+                    d[offset[c]] = float(s[c]) + float(s[c + 3] - s[c]) * a;
+            }
+        }
+
+        void SynetYuvToTensor::Run(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, float * dst)
+        {
+            const YuvToTensorParam & p = _param;
+            _rowY[0] = -1;
+            _rowY[1] = -1;
+            _pairY = -1;
+            for (size_t dy = 0; dy < p.dstH; ++dy)
+            {
+                ptrdiff_t sy = _iy[dy];
+                if (_rowY[0] != sy)
+                {
+                    if (_rowY[1] == sy)
+                    {
+                        _rows[0].Swap(_rows[1]);
+                        _rowY[0] = sy;
+                        _rowY[1] = -1;
+                    }
+                    else
+                    {
+                        SetRow(y, yStride, u, uStride, v, vStride, sy, _rows[0].data);
+                        _rowY[0] = sy;
+                    }
+                }
+                if (_rowY[1] != sy + 1)
+                {
+                    SetRow(y, yStride, u, uStride, v, vStride, sy + 1, _rows[1].data);
+                    _rowY[1] = sy + 1;
+                }
+                if (p.format == SimdTensorFormatNhwc)
+                    _blendRows(_rows[0].data, _rows[1].data, _ay[dy], _scale.data, _shift.data, p.dstW * 3, dst + dy * p.dstW * 3);
+                else
+                {
+                    for (size_t c = 0; c < 3; ++c)
+                    {
+                        size_t offset = c * p.dstW;
+                        _blendRows(_rows[0].data + offset, _rows[1].data + offset, _ay[dy], _scale.data + offset, 
+                            _shift.data + offset, p.dstW, dst + (c * p.dstH + dy) * p.dstW);
+                    }
+                }
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void * SynetYuvToTensorInit(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH,
+            SimdPixelFormatType order, const float * mean, const float * scale, SimdTensorFormatType format)
+        {
+            YuvToTensorParam param(srcW, srcH, layout, dstW, dstH, order, mean, scale, format);
+            if (!param.Valid())
+                return NULL;
+            return new SynetYuvToTensor(param);
+        }
+    }
+}
@@ -23,8 +23,24 @@
 */
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 #include <thread>
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <sstream>
+
+#if defined(_MSC_VER)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace Simd
 {
@@ -40,6 +56,176 @@ namespace Simd
         void SetThreadNumber(size_t threadNumber)
         {
             g_threadNumber = Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency());
+#ifndef SIMD_FUTURE_DISABLE
+            ThreadPool::Global().Resize(g_threadNumber - 1);
+#endif
+        }
+
+        size_t g_threadThreshold = 1024 * 1024;
+
+        size_t GetThreadThreshold()
+        {
+            return g_threadThreshold;
+        }
+
+        void SetThreadThreshold(size_t pixels)
+        {
+            g_threadThreshold = pixels;
+        }
+
+        struct ThreadAffinity
+        {
+            std::vector<size_t> cpus;
+            bool shared;
+        };
+        typedef std::shared_ptr<const ThreadAffinity> ThreadAffinityPtr;
+
+        ThreadAffinityPtr g_threadAffinity;
+
+        static void AllowedCpus(std::vector<size_t> & cpus)
+        {
+            cpus.clear();
+#if defined(_MSC_VER)
+            for (size_t i = 0, n = ::GetActiveProcessorCount(ALL_PROCESSOR_GROUPS); i < n; ++i)
+                cpus.push_back(i);
+#elif defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (::sched_getaffinity(0, sizeof(set), &set) == 0)
+            {
+                for (size_t i = 0; i < CPU_SETSIZE; ++i)
+                    if (CPU_ISSET(i, &set))
+                        cpus.push_back(i);
+            }
+#endif
+        }
+
+        static bool SetCurrentThreadAffinity(const size_t * cpus, size_t size)
+        {
+#if defined(_MSC_VER)
+            if (size == 0)
+                return false;
+            GROUP_AFFINITY affinity = { 0 };
+            size_t offset = 0, count = 0;
+            for (WORD group = 0, groups = ::GetActiveProcessorGroupCount(); group < groups; ++group, offset += count)
+            {
+                count = ::GetActiveProcessorCount(group);
+                if (cpus[0] >= offset && cpus[0] < offset + count)
+                {
+                    affinity.Group = group;
+                    break;
+                }
+            }
+            for (size_t i = 0; i < size; ++i)
+                if (cpus[i] >= offset && cpus[i] < offset + count && cpus[i] - offset < sizeof(KAFFINITY) * 8)
+                    affinity.Mask |= KAFFINITY(1) << (cpus[i] - offset);
+            return affinity.Mask && ::SetThreadGroupAffinity(::GetCurrentThread(), &affinity, NULL) != 0;
+#elif defined(__linux__)
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (size_t i = 0; i < size; ++i)
+                if (cpus[i] < CPU_SETSIZE)
+                    CPU_SET(cpus[i], &set);
+            return CPU_COUNT(&set) && ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+            return false;
+#endif
+        }
+
+        static void InitWorkThread(size_t thread)
+        {
+            ThreadAffinityPtr affinity = std::atomic_load(&g_threadAffinity);
+            if (!affinity || affinity->cpus.empty())
+                return;
+            if (affinity->shared)
+                SetCurrentThreadAffinity(affinity->cpus.data(), affinity->cpus.size());
+            else
+                SetCurrentThreadAffinity(affinity->cpus.data() + thread % affinity->cpus.size(), 1);
+        }
+
+        static bool SetThreadAffinity(const size_t * cpus, size_t size, bool shared)
+        {
+            std::vector<size_t> allowed;
+            AllowedCpus(allowed);
+            for (size_t i = 0; i < size; ++i)
+                if (std::find(allowed.begin(), allowed.end(), cpus[i]) == allowed.end())
+                    return false;
+#if defined(_MSC_VER) || defined(__linux__)
+            std::shared_ptr<ThreadAffinity> affinity = std::make_shared<ThreadAffinity>();
+            affinity->cpus.assign(cpus, cpus + size);
+            affinity->shared = shared;
+            std::atomic_store(&g_threadAffinity, ThreadAffinityPtr(affinity));
+#ifndef SIMD_FUTURE_DISABLE
+            ThreadPool::Global().SetInit(size ? InitWorkThread : NULL);
+#endif
+            return true;
+#else
+            return size == 0;
+#endif
+        }
+
+        bool SetThreadAffinity(const size_t * cpus, size_t size)
+        {
+            return SetThreadAffinity(cpus, size, false);
+        }
+
+        static bool NumaNodeCpus(size_t node, std::vector<size_t> & cpus)
+        {
+            cpus.clear();
+#if defined(_MSC_VER)
+            GROUP_AFFINITY affinity;
+            if (!::GetNumaNodeProcessorMaskEx((USHORT)node, &affinity))
+                return false;
+            size_t offset = 0;
+            for (WORD group = 0; group < affinity.Group; ++group)
+                offset += ::GetActiveProcessorCount(group);
+            for (size_t i = 0; i < sizeof(affinity.Mask) * 8; ++i)
+                if (affinity.Mask & (KAFFINITY(1) << i))
+                    cpus.push_back(offset + i);
+#elif defined(__linux__)
+            std::stringstream path;
+            path << "/sys/devices/system/node/node" << node << "/cpulist";
+            std::ifstream ifs(path.str().c_str());
+            if (!ifs.is_open())
+                return false;
+            std::string list, range;
+            std::getline(ifs, list);
+            std::stringstream ss(list);
+            while (std::getline(ss, range, ','))
+            {
+                size_t begin = 0, end = 0;
+                char dash = 0;
+                std::stringstream rs(range);
+                if (!(rs >> begin))
+                    continue;
+                if (rs >> dash >> end)
+                {
+                    for (size_t i = begin; i <= end; ++i)
+                        cpus.push_back(i);
+                }
+                else
+                    cpus.push_back(begin);
+            }
+#endif
+            return cpus.size() != 0;
+        }
+
+        bool SetThreadNumaNode(size_t node)
+        {
+            std::vector<size_t> cpus, allowed;
+            if (!NumaNodeCpus(node, cpus))
+                return false;
+            AllowedCpus(allowed);
+            for (size_t i = 0; i < cpus.size();)
+            {
+                if (std::find(allowed.begin(), allowed.end(), cpus[i]) == allowed.end())
+                    cpus.erase(cpus.begin() + i);
+                else
+                    ++i;
+            }
+            if (cpus.empty())
+                return false;
+            return SetThreadAffinity(cpus.data(), cpus.size(), true);
         }
     }
 }
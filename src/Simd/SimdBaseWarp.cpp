@@ -0,0 +1,190 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdWarp.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        WarpByte::WarpByte(const WarpParam & param)
+            : Warp(param)
+        {
+            const float * m = _param.inv;
+            size_t dstW = _param.dstW, dstH = _param.dstH;
+            _ax.Resize(dstW, false, _param.align);
+            _ay.Resize(dstW, false, _param.align);
+            _cx.Resize(dstH, false, _param.align);
+            _cy.Resize(dstH, false, _param.align);
+            for (size_t dx = 0; dx < dstW; ++dx)
+            {
+                _ax[dx] = m[0] * float(dx);
+                _ay[dx] = m[3] * float(dx);
+            }
+            for (size_t dy = 0; dy < dstH; ++dy)
+            {
+                _cx[dy] = m[1] * float(dy) + m[2];
+                _cy[dy] = m[4] * float(dy) + m[5];
+            }
+            if (_param.perspective)
+            {
+                _aw.Resize(dstW, false, _param.align);
+                _cw.Resize(dstH, false, _param.align);
+                for (size_t dx = 0; dx < dstW; ++dx)
+                    _aw[dx] = m[6] * float(dx);
+                for (size_t dy = 0; dy < dstH; ++dy)
+                    _cw[dy] = m[7] * float(dy) + m[8];
+            }
+            _fx.Resize(dstW, false, _param.align);
+            _fy.Resize(dstW, false, _param.align);
+            _in.Resize(dstW, false, _param.align);
+        }
+
+        void WarpByte::Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t dy = 0; dy < _param.dstH; ++dy, dst += dstStride)
+            {
+                EstimateRow(dy);
+                InterpolateRow(src, srcStride, dst);
+            }
+        }
+
+        void WarpByte::EstimateRow(size_t dy)
+        {
+            bool nearest = _param.IsNearest();
+            float cx = _cx[dy], cy = _cy[dy], cw = _param.perspective ? _cw[dy] : 1.0f;
+            float maxX = float(_param.srcW + 1), maxY = float(_param.srcH + 1);
+            float scale = nearest ? 1.0f : float(WARP_RANGE);
+            int shift = nearest ? 0 : WARP_SHIFT;
+            int lastX = int(_param.srcW) - (nearest ? 1 : 2), lastY = int(_param.srcH) - (nearest ? 1 : 2);
+            for (size_t dx = 0; dx < _param.dstW; ++dx)
+            {
+                float sx = _ax[dx] + cx, sy = _ay[dx] + cy;
+                if (_param.perspective)
+                {
+                    float w = _aw[dx] + cw;
+                    if (w > 0.0f)
+                    {
+                        sx = sx / w;
+                        sy = sy / w;
+                    }
+                    else
+                        sx = sy = -2.0f;
+                }
+                sx = Simd::Min(Simd::Max(sx, -2.0f), maxX);
+                sy = Simd::Min(Simd::Max(sy, -2.0f), maxY);
+                int fx = (int)::floor(sx * scale + 0.5f);
+                int fy = (int)::floor(sy * scale + 0.5f);
+                int ix = fx >> shift, iy = fy >> shift;
+                _fx[dx] = fx;
+                _fy[dx] = fy;
+                _in[dx] = ix >= 0 && ix <= lastX && iy >= 0 && iy <= lastY ? 0xFF : 0;
+            }
+        }
+
+        void WarpByte::InterpolateRow(const uint8_t * src, size_t srcStride, uint8_t * dst)
+        {
+            size_t cn = _param.channels;
+            bool nearest = _param.IsNearest(), transparent = _param.Border() == SimdWarpBorderTransparent;
+            for (size_t dx = 0; dx < _param.dstW; ++dx, dst += cn)
+            {
+                if (_in[dx])
+                {
+                    int fx = _fx[dx], fy = _fy[dx];
+                    if (nearest)
+                    {
+                        const uint8_t * s = src + fy * srcStride + fx * cn;
+                        for (size_t c = 0; c < cn; ++c)
+                            dst[c] = s[c];
+                    }
+                    else
+                    {
+                        const uint8_t * s0 = src + (fy >> WARP_SHIFT) * srcStride + (fx >> WARP_SHIFT) * cn, * s1 = s0 + srcStride;
+                        int ax1 = fx & (WARP_RANGE - 1), ax0 = WARP_RANGE - ax1;
+                        int ay1 = fy & (WARP_RANGE - 1), ay0 = WARP_RANGE - ay1;
+                        for (size_t c = 0; c < cn; ++c)
+                            dst[c] = (uint8_t)(((s0[c] * ax0 + s0[c + cn] * ax1) * ay0 + (s1[c] * ax0 + s1[c + cn] * ax1) * ay1 + WARP_ROUND) >> 2 * WARP_SHIFT);
+                    }
+                }
+                else if (!transparent)
+                    InterpolateBorder(src, srcStride, dx, dst);
+            }
+        }
+
+        void WarpByte::InterpolateBorder(const uint8_t * src, size_t srcStride, size_t dx, uint8_t * dst)
+        {
+            size_t cn = _param.channels;
+            bool replicate = _param.Border() == SimdWarpBorderReplicate;
+            int w = (int)_param.srcW, h = (int)_param.srcH;
+            if (_param.IsNearest())
+            {
+                int x = _fx[dx], y = _fy[dx];
+                const uint8_t * s = _param.border;
+                if (replicate)
+                    s = src + RestrictRange(y, 0, h - 1) * srcStride + RestrictRange(x, 0, w - 1) * cn;
+                for (size_t c = 0; c < cn; ++c)
+                    dst[c] = s[c];
+                return;
+            }
+            int fx = _fx[dx], fy = _fy[dx];
+            int x0 = fx >> WARP_SHIFT, y0 = fy >> WARP_SHIFT;
+            int ax1 = fx & (WARP_RANGE - 1), ax0 = WARP_RANGE - ax1;
+            int ay1 = fy & (WARP_RANGE - 1), ay0 = WARP_RANGE - ay1;
+            const uint8_t * s[2][2];
+            for (int j = 0; j < 2; ++j)
+            {
+                for (int i = 0; i < 2; ++i)
+                {
+                    int x = x0 + i, y = y0 + j;
+                    if (x >= 0 && x < w && y >= 0 && y < h)
+                        s[j][i] = src + y * srcStride + x * cn;
+                    else if (replicate)
+                        s[j][i] = src + RestrictRange(y, 0, h - 1) * srcStride + RestrictRange(x, 0, w - 1) * cn;
+                    else
+                        s[j][i] = _param.border;
+                }
+            }
+            for (size_t c = 0; c < cn; ++c)
+                dst[c] = (uint8_t)(((s[0][0][c] * ax0 + s[0][1][c] * ax1) * ay0 + (s[1][0][c] * ax0 + s[1][1][c] * ax1) * ay1 + WARP_ROUND) >> 2 * WARP_SHIFT);
+        }
+
+        //---------------------------------------------------------------------
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, mat, false, flags, border, sizeof(void*));
+            if (!param.valid)
+                return NULL;
+            return new WarpByte(param);
+        }
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border)
+        {
+            WarpParam param(srcW, srcH, dstW, dstH, channels, mat, true, flags, border, sizeof(void*));
+            if (!param.valid)
+                return NULL;
+            return new WarpByte(param);
+        }
+    }
+}
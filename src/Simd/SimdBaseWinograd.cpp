@@ -2388,5 +2388,277 @@ namespace Simd
                 }
             }
         }
+
+        //-----------------------------------------------------------------------
+
+        void WinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
+        {
+            if (trans)
+            {
+                for (size_t i = 0; i < size; i += 1)
+                    Base::WinogradKernel3x3Block6x6SetFilter1t(src + i, dst + i, size);
+            }
+            else
+            {
+                for (size_t i = 0; i < size; i += 1, src += 9, dst += 1)
+                    Base::WinogradKernel3x3Block6x6SetFilter1n(src, dst, size);
+            }
+        }
+
+        //-----------------------------------------------------------------------
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput8(const float * src, size_t srcStep, float * dst, size_t dstStep)
+        {
+            float s0 = src[0 * srcStep];
+            float s1 = src[1 * srcStep];
+            float s2 = src[2 * srcStep];
+            float s3 = src[3 * srcStep];
+            float s4 = src[4 * srcStep];
+            float s5 = src[5 * srcStep];
+            float s6 = src[6 * srcStep];
+            float s7 = src[7 * srcStep];
+            dst[0 * dstStep] = s0 - s6 + 5.25f * (s4 - s2);
+            float a = s1 + s5 - 4.25f * s3;
+            float b = s2 + s6 - 4.25f * s4;
+            dst[1 * dstStep] = b + a;
+            dst[2 * dstStep] = b - a;
+            a = 0.5f * s1 - 2.5f * s3 + 2.0f * s5;
+            b = 0.25f * s2 - 1.25f * s4 + s6;
+            dst[3 * dstStep] = b + a;
+            dst[4 * dstStep] = b - a;
+            a = 2.0f * s1 - 2.5f * s3 + 0.5f * s5;
+            b = 4.0f * s2 - 5.0f * s4 + s6;
+            dst[5 * dstStep] = b + a;
+            dst[6 * dstStep] = b - a;
+            dst[7 * dstStep] = s7 - s1 + 5.25f * (s3 - s5);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput1(const float src[64], float * dst, size_t stride)
+        {
+            float tmp[64];
+            for (size_t col = 0; col < 8; ++col)
+                WinogradKernel3x3Block6x6SetInput8(src + col, 8, tmp + col, 8);
+            for (size_t row = 0; row < 8; ++row)
+                WinogradKernel3x3Block6x6SetInput8(tmp + row * 8, 1, dst + row * 8 * stride, stride);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput1n(const float * src, size_t srcStride, float * dst, size_t dstStride)
+        {
+            float tmp[64];
+            for (size_t row = 0; row < 8; ++row)
+                for (size_t col = 0; col < 8; ++col)
+                    tmp[row * 8 + col] = src[row * srcStride + col];
+            WinogradKernel3x3Block6x6SetInput1(tmp, dst, dstStride);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput1n(const float * src, size_t srcStride, size_t rowB, size_t rowE, size_t colB, size_t colE, float * dst, size_t dstStride)
+        {
+            float tmp[64] = { 0 };
+            for (size_t row = rowB; row < rowE; ++row)
+                for (size_t col = colB; col < colE; ++col)
+                    tmp[row * 8 + col] = src[row * srcStride + col];
+            WinogradKernel3x3Block6x6SetInput1(tmp, dst, dstStride);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput1t(const float * src, size_t srcW, size_t srcC, float * dst, size_t dstStride)
+        {
+            size_t srcS = srcW * srcC;
+            for (size_t c = 0; c < srcC; ++c, src++, dst++)
+            {
+                float tmp[64];
+                for (size_t row = 0; row < 8; ++row)
+                    for (size_t col = 0; col < 8; ++col)
+                        tmp[row * 8 + col] = src[row * srcS + col * srcC];
+                WinogradKernel3x3Block6x6SetInput1(tmp, dst, dstStride);
+            }
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetInput1t(const float * src, size_t srcW, size_t srcC, size_t rowB, size_t rowE, size_t colB, size_t colE, float * dst, size_t dstStride)
+        {
+            size_t srcS = srcW * srcC;
+            for (size_t c = 0; c < srcC; ++c, src++, dst++)
+            {
+                float tmp[64] = { 0 };
+                for (size_t row = rowB; row < rowE; ++row)
+                    for (size_t col = colB; col < colE; ++col)
+                        tmp[row * 8 + col] = src[row * srcS + col * srcC];
+                WinogradKernel3x3Block6x6SetInput1(tmp, dst, dstStride);
+            }
+        }
+
+        void WinogradKernel3x3Block6x6SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
+            size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
+        {
+            assert(padY + padH <= 2 && padX + padW <= 2);
+            size_t dstH = srcHeight - 2 + padY + padH;
+            size_t dstW = srcWidth - 2 + padX + padW;
+            size_t dstH6 = dstH / 6 * 6;
+            size_t dstW6 = dstW / 6 * 6;
+            size_t noseW = Simd::Min<size_t>(8, srcWidth + padX);
+            size_t noseH = Simd::Min<size_t>(8, srcHeight + padY);
+            size_t startY = padY ? 6 : 0;
+            size_t startX = padX ? 6 : 0;
+            if (padH && dstH == dstH6)
+                dstH6 -= 6;
+            if (padY)
+                src -= srcWidth * (trans ? srcChannels : 1);
+            if (padW && dstW == dstW6)
+                dstW6 -= 6;
+            if (padX)
+                src -= 1 * (trans ? srcChannels : 1);
+            size_t tailW = dstW - dstW6 + (padW ? 1 : 2);
+            size_t tailH = dstH - dstH6 + (padH ? 1 : 2);
+            if (trans)
+            {
+                size_t row = 0, col = 0;
+                if (padY)
+                {
+                    if (padX)
+                        WinogradKernel3x3Block6x6SetInput1t(src, srcWidth, srcChannels, 1, noseH, 1, noseW, dst, dstStride), dst += srcChannels;
+                    for (col = startX; col < dstW6; col += 6)
+                        WinogradKernel3x3Block6x6SetInput1t(src + col * srcChannels, srcWidth, srcChannels, 1, noseH, 0, 8, dst, dstStride), dst += srcChannels;
+                    if (col < dstW)
+                        WinogradKernel3x3Block6x6SetInput1t(src + col * srcChannels, srcWidth, srcChannels, 1, noseH, 0, tailW, dst, dstStride), dst += srcChannels;
+                }
+                for (row = startY; row < dstH6; row += 6)
+                {
+                    if (padX)
+                        WinogradKernel3x3Block6x6SetInput1t(src + row * srcWidth * srcChannels, srcWidth, srcChannels, 0, 8, 1, noseW, dst, dstStride), dst += srcChannels;
+                    for (col = startX; col < dstW6; col += 6)
+                        WinogradKernel3x3Block6x6SetInput1t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, dst, dstStride), dst += srcChannels;
+                    if (col < dstW)
+                        WinogradKernel3x3Block6x6SetInput1t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, 0, 8, 0, tailW, dst, dstStride), dst += srcChannels;
+                }
+                if (row < dstH)
+                {
+                    if (padX)
+                        WinogradKernel3x3Block6x6SetInput1t(src + row * srcWidth * srcChannels, srcWidth, srcChannels, 0, tailH, 1, noseW, dst, dstStride), dst += srcChannels;
+                    for (col = startX; col < dstW6; col += 6)
+                        WinogradKernel3x3Block6x6SetInput1t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, 0, tailH, 0, 8, dst, dstStride), dst += srcChannels;
+                    if (col < dstW)
+                        WinogradKernel3x3Block6x6SetInput1t(src + (row * srcWidth + col) * srcChannels, srcWidth, srcChannels, 0, tailH, 0, tailW, dst, dstStride), dst += srcChannels;
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < srcChannels; ++c)
+                {
+                    size_t row = 0, col = 0;
+                    if (padY)
+                    {
+                        if (padX)
+                            WinogradKernel3x3Block6x6SetInput1n(src, srcWidth, 1, noseH, 1, noseW, dst++, dstStride);
+                        for (col = startX; col < dstW6; col += 6)
+                            WinogradKernel3x3Block6x6SetInput1n(src + col, srcWidth, 1, noseH, 0, 8, dst++, dstStride);
+                        if (col < dstW)
+                            WinogradKernel3x3Block6x6SetInput1n(src + col, srcWidth, 1, noseH, 0, tailW, dst++, dstStride);
+                    }
+                    for (row = startY; row < dstH6; row += 6)
+                    {
+                        if (padX)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth, srcWidth, 0, 8, 1, noseW, dst++, dstStride);
+                        for (col = startX; col < dstW6; col += 6)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth + col, srcWidth, dst++, dstStride);
+                        if (col < dstW)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth + col, srcWidth, 0, 8, 0, tailW, dst++, dstStride);
+                    }
+                    if (row < dstH)
+                    {
+                        if (padX)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth, srcWidth, 0, tailH, 1, noseW, dst++, dstStride);
+                        for (col = startX; col < dstW6; col += 6)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth + col, srcWidth, 0, tailH, 0, 8, dst++, dstStride);
+                        if (col < dstW)
+                            WinogradKernel3x3Block6x6SetInput1n(src + row * srcWidth + col, srcWidth, 0, tailH, 0, tailW, dst++, dstStride);
+                    }
+                    src += srcWidth * srcHeight;
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutput8(const float * src, size_t srcStep, float * dst, size_t dstStep)
+        {
+            float s0 = src[0 * srcStep];
+            float a1 = src[1 * srcStep] + src[2 * srcStep];
+            float b1 = src[1 * srcStep] - src[2 * srcStep];
+            float a2 = src[3 * srcStep] + src[4 * srcStep];
+            float b2 = src[3 * srcStep] - src[4 * srcStep];
+            float a3 = src[5 * srcStep] + src[6 * srcStep];
+            float b3 = src[5 * srcStep] - src[6 * srcStep];
+            float s7 = src[7 * srcStep];
+            dst[0 * dstStep] = s0 + a1 + a2 + a3;
+            dst[1 * dstStep] = b1 + 2.0f * b2 + 0.5f * b3;
+            dst[2 * dstStep] = a1 + 4.0f * a2 + 0.25f * a3;
+            dst[3 * dstStep] = b1 + 8.0f * b2 + 0.125f * b3;
+            dst[4 * dstStep] = a1 + 16.0f * a2 + 0.0625f * a3;
+            dst[5 * dstStep] = b1 + 32.0f * b2 + 0.03125f * b3 + s7;
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutput1(const float * src, size_t stride, float dst[36])
+        {
+            float s[64], tmp[48];
+            for (size_t i = 0; i < 64; ++i)
+                s[i] = src[i * stride];
+            for (size_t col = 0; col < 8; ++col)
+                WinogradKernel3x3Block6x6SetOutput8(s + col, 8, tmp + col, 8);
+            for (size_t row = 0; row < 6; ++row)
+                WinogradKernel3x3Block6x6SetOutput8(tmp + row * 8, 1, dst + row * 6, 1);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutput1n(const float * src, size_t srcStride, float * dst, size_t dstStride, size_t rowE, size_t colE)
+        {
+            float tmp[36];
+            WinogradKernel3x3Block6x6SetOutput1(src, srcStride, tmp);
+            for (size_t row = 0; row < rowE; ++row)
+                for (size_t col = 0; col < colE; ++col)
+                    dst[row * dstStride + col] = tmp[row * 6 + col];
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetOutput1t(const float * src, size_t srcStride, float * dst, size_t dstW, size_t dstC, size_t rowE, size_t colE)
+        {
+            size_t dstS = dstW * dstC;
+            for (size_t d = 0; d < dstC; ++d, src++, dst++)
+            {
+                float tmp[36];
+                WinogradKernel3x3Block6x6SetOutput1(src, srcStride, tmp);
+                for (size_t row = 0; row < rowE; ++row)
+                    for (size_t col = 0; col < colE; ++col)
+                        dst[row * dstS + col * dstC] = tmp[row * 6 + col];
+            }
+        }
+
+        void WinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
+        {
+            if (trans)
+            {
+                for (size_t row = 0; row < dstHeight; row += 6)
+                {
+                    size_t rowE = Simd::Min<size_t>(6, dstHeight - row);
+                    for (size_t col = 0; col < dstWidth; col += 6)
+                    {
+                        size_t colE = Simd::Min<size_t>(6, dstWidth - col);
+                        WinogradKernel3x3Block6x6SetOutput1t(src, srcStride, dst + (row * dstWidth + col) * dstChannels, dstWidth, dstChannels, rowE, colE), src += dstChannels;
+                    }
+                }
+            }
+            else
+            {
+                for (size_t c = 0; c < dstChannels; ++c)
+                {
+                    for (size_t row = 0; row < dstHeight; row += 6)
+                    {
+                        size_t rowE = Simd::Min<size_t>(6, dstHeight - row);
+                        for (size_t col = 0; col < dstWidth; col += 6)
+                        {
+                            size_t colE = Simd::Min<size_t>(6, dstWidth - col);
+                            WinogradKernel3x3Block6x6SetOutput1n(src++, srcStride, dst + row * dstWidth + col, dstWidth, rowE, colE);
+                        }
+                    }
+                    dst += dstHeight * dstWidth;
+                }
+            }
+        }
     }
 }
@@ -0,0 +1,140 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<class T, SimdPixelFormatType format> SIMD_INLINE void YuvToPixel(int y, int u, int v, uint8_t alpha, uint8_t * dst)
+        {
+            int blue = YuvToBlue<T>(y, u), green = YuvToGreen<T>(y, u, v), red = YuvToRed<T>(y, v);
+            dst[0] = uint8_t(format == SimdPixelFormatRgb24 ? red : blue);
+            dst[1] = uint8_t(green);
+            dst[2] = uint8_t(format == SimdPixelFormatRgb24 ? blue : red);
+            if (format == SimdPixelFormatBgra32)
+                dst[3] = alpha;
+        }
+
+        template<class T, SimdPixelFormatType format> void Yuv420ToPixel(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, 
+            const uint8_t * v, size_t vStride, size_t uvStep, size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colUV = 0, colY = 0, colDst = 0; colY < width; colY += 2, colUV += uvStep, colDst += 2 * size)
+                {
+                    int u_ = u[colUV], v_ = v[colUV];
+                    YuvToPixel<T, format>(y[colY + 0], u_, v_, alpha, dst + colDst);
+                    YuvToPixel<T, format>(y[colY + 1], u_, v_, alpha, dst + colDst + size);
+                    YuvToPixel<T, format>(y[colY + yStride + 0], u_, v_, alpha, dst + colDst + dstStride);
+                    YuvToPixel<T, format>(y[colY + yStride + 1], u_, v_, alpha, dst + colDst + dstStride + size);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template<SimdPixelFormatType format> void Yuv420ToPixel(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride,
+            const uint8_t * v, size_t vStride, size_t uvStep, size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420ToPixel<Bt601, format>(y, yStride, u, uStride, v, vStride, uvStep, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Yuv420ToPixel<Bt709, format>(y, yStride, u, uStride, v, vStride, uvStep, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Yuv420ToPixel<Bt2020, format>(y, yStride, u, uStride, v, vStride, uvStep, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: Yuv420ToPixel<Bt601Full, format>(y, yStride, u, uStride, v, vStride, uvStep, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: Yuv420ToPixel<Bt709Full, format>(y, yStride, u, uStride, v, vStride, uvStep, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv420ToPixel<Bt2020Full, format>(y, yStride, u, uStride, v, vStride, uvStep, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv420ToPixel<SimdPixelFormatBgr24>(y, yStride, u, uStride, v, vStride, 1, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv420ToPixel<SimdPixelFormatBgra32>(y, yStride, u, uStride, v, vStride, 1, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Yuv420ToPixel<SimdPixelFormatRgb24>(y, yStride, u, uStride, v, vStride, 1, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv420ToPixel<SimdPixelFormatBgr24>(y, yStride, uv + 0, uvStride, uv + 1, uvStride, 2, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv420ToPixel<SimdPixelFormatBgra32>(y, yStride, uv + 0, uvStride, uv + 1, uvStride, 2, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Yuv420ToPixel<SimdPixelFormatRgb24>(y, yStride, uv + 0, uvStride, uv + 1, uvStride, 2, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv420ToPixel<SimdPixelFormatBgr24>(y, yStride, vu + 1, vuStride, vu + 0, vuStride, 2, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv420ToPixel<SimdPixelFormatBgra32>(y, yStride, vu + 1, vuStride, vu + 0, vuStride, 2, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Yuv420ToPixel<SimdPixelFormatRgb24>(y, yStride, vu + 1, vuStride, vu + 0, vuStride, 2, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+    }
+}
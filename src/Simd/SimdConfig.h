@@ -46,6 +46,8 @@
 
 //#define SIMD_AVX512VNNI_DISABLE
 
+//#define SIMD_AVX512BF16_DISABLE
+
 //#define SIMD_VMX_DISABLE
 
 //#define SIMD_VSX_DISABLE
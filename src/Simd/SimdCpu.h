@@ -75,6 +75,10 @@ namespace Simd
             // Ecx:
             AVX512VBMI = 1 << 1,
             AVX512VNNI = 1 << 11,
+
+            // Extended (sub-leaf 1):
+            // Eax:
+            AVX512BF16 = 1 << 5,
         };
     }
 #endif//defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
@@ -92,7 +96,7 @@ namespace Simd
     namespace Base
     {
 #if defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
-        bool CheckBit(Cpuid::Level level, Cpuid::Register index, Cpuid::Bit bit);
+        bool CheckBit(Cpuid::Level level, Cpuid::Register index, Cpuid::Bit bit, unsigned int subLevel = 0);
 #endif
 
 #if defined(__GNUC__) && (defined(SIMD_PPC_ENABLE) || defined(SIMD_PPC64_ENABLE) || defined(SIMD_ARM_ENABLE) || defined(SIMD_ARM64_ENABLE))
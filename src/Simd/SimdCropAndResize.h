@@ -0,0 +1,54 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdCropAndResize_h__
+#define __SimdCropAndResize_h__
+
+#include "Simd/SimdDefs.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        const int CROP_RESIZE_SHIFT = 8;
+        const int CROP_RESIZE_RANGE = 1 << CROP_RESIZE_SHIFT;
+        const int CROP_RESIZE_ROUND = 1 << (2 * CROP_RESIZE_SHIFT - 1);
+
+        /*
+        * Bilinear crop and resize of rectangular regions is separable: at first two source rows are blended into a buffer
+        * (vertical pass), then the buffer is interpolated with precalculated indices and alphas (horizontal pass).
+        * 8-bit vertical pass result is stored in 16-bit buffer (it can't exceed 255 * CROP_RESIZE_RANGE),
+        * so 8-bit result is exactly equal to one of direct 2x2 interpolation.
+        * Buffer of horizontal pass is padded by one element. Indices are given relative to the buffer.
+        */
+        typedef void(*CropResizeRowV8uPtr)(const uint8_t * src0, const uint8_t * src1, size_t size, int32_t alpha, uint16_t * dst);
+        typedef void(*CropResizeRowH8uPtr)(const uint16_t * src, const int32_t * index0, const int32_t * index1, const int32_t * alpha, size_t size, uint8_t * dst);
+        typedef void(*CropResizeRowV32fPtr)(const float * src0, const float * src1, size_t size, float alpha, float * dst);
+        typedef void(*CropResizeRowH32fPtr)(const float * src, const int32_t * index0, const int32_t * index1, const float * alpha, size_t size, float * dst);
+
+        void CropAndResizeBilinear(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, SimdResizeChannelType type,
+            const SimdResizeRoi * rois, size_t count, size_t dstWidth, size_t dstHeight, CropResizeRowV8uPtr rowV8u, CropResizeRowH8uPtr rowH8u,
+            CropResizeRowV32fPtr rowV32f, CropResizeRowH32fPtr rowH32f);
+    }
+}
+#endif//__SimdCropAndResize_h__
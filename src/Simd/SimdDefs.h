@@ -82,6 +82,10 @@
 #define SIMD_AVX512VNNI_DISABLE
 #endif
 
+#if defined(SIMD_AVX512BW_DISABLE) && !defined(SIMD_AVX512BF16_DISABLE)
+#define SIMD_AVX512BF16_DISABLE
+#endif
+
 #if defined(SIMD_VMX_DISABLE) && !defined(SIMD_VSX_DISABLE)
 #define SIMD_VSX_DISABLE
 #endif
@@ -154,6 +158,10 @@
 #define SIMD_AVX512VNNI_ENABLE
 #endif
 
+#if !defined(SIMD_AVX512BF16_DISABLE) && _MSC_VER >= 1927
+#define SIMD_AVX512BF16_ENABLE
+#endif
+
 #if defined(NDEBUG) && _MSC_VER == 1914
 #define SIMD_MASKZ_LOAD_ERROR
 #endif
@@ -262,6 +270,10 @@
 #if !defined(SIMD_AVX512VNNI_DISABLE) && defined(__AVX512VNNI__)
 #define SIMD_AVX512VNNI_ENABLE
 #endif
+
+#if !defined(SIMD_AVX512BF16_DISABLE) && defined(__AVX512BF16__)
+#define SIMD_AVX512BF16_ENABLE
+#endif
 #endif
 
 #endif//defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
@@ -343,7 +355,7 @@
 #endif
 
 #if defined(SIMD_AVX_ENABLE) || defined(SIMD_AVX2_ENABLE) \
-    || defined(SIMD_AVX512F_ENABLE) || defined(SIMD_AVX512BW_ENABLE) || defined(SIMD_AVX512VNNI_ENABLE)
+    || defined(SIMD_AVX512F_ENABLE) || defined(SIMD_AVX512BW_ENABLE) || defined(SIMD_AVX512VNNI_ENABLE) || defined(SIMD_AVX512BF16_ENABLE)
 #include <immintrin.h>
 #endif
 
@@ -361,7 +373,7 @@
 #include <arm_neon.h>
 #endif
 
-#if defined(SIMD_AVX512F_ENABLE) || defined(SIMD_AVX512BW_ENABLE) || defined(SIMD_AVX512VNNI_ENABLE)
+#if defined(SIMD_AVX512F_ENABLE) || defined(SIMD_AVX512BW_ENABLE) || defined(SIMD_AVX512VNNI_ENABLE) || defined(SIMD_AVX512BF16_ENABLE)
 #define SIMD_ALIGN 64
 #elif defined(SIMD_AVX_ENABLE) || defined(SIMD_AVX2_ENABLE)
 #define SIMD_ALIGN 32
@@ -375,7 +387,7 @@
 #define SIMD_ALIGN 4
 #endif
 
-#if (defined(SIMD_AVX512F_ENABLE) || defined(SIMD_AVX512BW_ENABLE) || defined(SIMD_AVX512VNNI_ENABLE))
+#if (defined(SIMD_AVX512F_ENABLE) || defined(SIMD_AVX512BW_ENABLE) || defined(SIMD_AVX512VNNI_ENABLE) || defined(SIMD_AVX512BF16_ENABLE))
 #ifdef SIMD_X64_ENABLE
 #if defined(__GNUC__) || (defined(_MSC_VER) && _MSC_VER >= 1915)
 #define SIMD_ZMM_COUNT 32
@@ -40,6 +40,63 @@ namespace Simd
         typedef Simd::Point<ptrdiff_t> Size;
         typedef Simd::Rectangle<ptrdiff_t> Rect;
 
+        template<class T> class Table
+        {
+        public:
+            Table()
+                : _data(NULL)
+                , _size(0)
+            {
+            }
+
+            Table(const Table & table)
+                : _owner(table._owner)
+            {
+                Bind(table._owner.empty() ? table._data : _owner.data(), table._size);
+            }
+
+            Table & operator = (const Table & table)
+            {
+                _owner = table._owner;
+                Bind(table._owner.empty() ? table._data : _owner.data(), table._size);
+                return *this;
+            }
+
+            void reserve(size_t size)
+            {
+                _owner.reserve(size);
+                Bind(_owner.data(), _owner.size());
+            }
+
+            void push_back(const T & value)
+            {
+                _owner.push_back(value);
+                Bind(_owner.data(), _owner.size());
+            }
+
+            void Map(const T * data, size_t size)
+            {
+                _owner.clear();
+                Bind(data, size);
+            }
+
+            size_t size() const { return _size; }
+            bool empty() const { return _size == 0; }
+            const T * data() const { return _data; }
+            const T & operator [] (size_t index) const { return _data[index]; }
+
+        private:
+            void Bind(const T * data, size_t size)
+            {
+                _data = data;
+                _size = size;
+            }
+
+            std::vector<T> _owner;
+            const T * _data;
+            size_t _size;
+        };
+
         struct Data : public Deletable
         {
             struct DTreeNode
@@ -96,14 +153,14 @@ namespace Simd
             int ncategories;
             Size origWinSize;
 
-            std::vector<Stage> stages;
-            std::vector<DTree> classifiers;
-            std::vector<DTreeNode> nodes;
-            std::vector<float> leaves;
-            std::vector<int> subsets;
+            Table<Stage> stages;
+            Table<DTree> classifiers;
+            Table<DTreeNode> nodes;
+            Table<float> leaves;
+            Table<int> subsets;
 
-            std::vector<HaarFeature> haarFeatures;
-            std::vector<LbpFeature> lbpFeatures;
+            Table<HaarFeature> haarFeatures;
+            Table<LbpFeature> lbpFeatures;
 
             virtual ~Data() {}
         };
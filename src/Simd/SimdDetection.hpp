@@ -31,6 +31,10 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
 
 #include <limits.h>
 
@@ -263,6 +267,31 @@ namespace Simd
             return handle != NULL;
         }
 
+        /*!
+            Loads classifier cascade from buffer in compact binary format (See ::SimdDetectionSaveBinary).
+            You can call this function more than once if you want to use several object detectors at the same time.
+
+            \note The buffer is used in place (it can be a memory-mapped file) and must stay valid while this structure exists.
+
+            \param [in] binary - a pointer to buffer with binary cascade.
+            \param [in] size - a size of the buffer.
+            \param [in] tag - an user defined tag. This tag will be inserted in output Object structure.
+            \return a result of this operation.
+        */
+        bool LoadBinary(const uint8_t * binary, size_t size, Tag tag = UNDEFINED_OBJECT_TAG)
+        {
+            Handle handle = ::SimdDetectionLoadBinary(binary, size);
+            if (handle)
+            {
+                Data data;
+                data.handle = handle;
+                data.tag = tag;
+                ::SimdDetectionInfo(handle, (size_t*)&data.size.x, (size_t*)&data.size.y, &data.flags);
+                _data.push_back(data);
+            }
+            return handle != NULL;
+        }
+
         /*!
             Prepares Detection structure to work with image of given size.
 
@@ -274,6 +303,8 @@ namespace Simd
             \param [in] roi - a 8-bit image mask which defines Region Of Interest. User can restricts detection region with using this mask.
                               The mask affects to the center of detected object.
             \param [in] threadNumber - a number of work threads. It useful for multi core CPU. Use value -1 to auto choose of thread number.
+                                      If it is greater than 1 then the image pyramid is built concurrently with detection in a separate thread,
+                                      which is created once and is reused by following calls of Detect().
             \return a result of this operation.
         */
         bool Init(const Size & imageSize, double scaleFactor = 1.1, const Size & sizeMin = Size(0, 0),
@@ -295,6 +326,7 @@ namespace Simd
             \param [in] groupSizeMin - a minimal weight (number of elementary detections) of detected image.
             \param [in] sizeDifferenceMax - a parameter to group elementary detections.
             \param [in] motionMask - an using of motion detection flag. Useful for dynamical restriction of detection region to addition to ROI.
+                                     In this case image pyramid and integral images are updated only inside of motion regions (plus detector window).
             \param [in] motionRegions - a set of rectangles (motion regions) to restrict detection region to addition to ROI.
                                         The regions affect to the center of detected object.
             \return a result of this operation.
@@ -307,21 +339,59 @@ namespace Simd
             if (_levels.empty() || src.Size() != _imageSize)
                 return false;
 
-            FillLevels(src);
+            View gray = src;
+            if (src.format != View::Gray8)
+            {
+                gray.Recreate(src.Size(), View::Gray8);
+                Convert(src, gray);
+            }
+            std::vector<Rect> rects(_levels.size());
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                rects[i] = _levels[i]->rect;
+                if (motionMask)
+                    FillMotionMask(motionRegions, *_levels[i], rects[i]);
+            }
+
+            bool concurrent = false;
+            Joiner joiner(_builder);
+            if (motionMask)
+                FillLevels(gray, rects);
+            else
+            {
+                FillLevel(0, gray);
+
+                if (_threadNumber > 1 && _levels.size() > 1)
+                {
+                    if (!_builder)
+                        _builder.reset(new Builder());
+                    _builder->Start([&]()
+                    {
+                        for (size_t i = 1; i < _levels.size(); ++i)
+                        {
+                            FillLevel(i, gray);
+                            _builder->Signal(i);
+                        }
+                    });
+                    concurrent = true;
+                }
+                else
+                {
+                    for (size_t i = 1; i < _levels.size(); ++i)
+                        FillLevel(i, gray);
+                }
+            }
 
             typedef std::map<Tag, Objects> Candidates;
             Candidates candidates;
 
             for (size_t i = 0; i < _levels.size(); ++i)
             {
+                if (concurrent)
+                    _builder->Wait(i);
                 Level & level = *_levels[i];
-                View mask = level.roi;
-                Rect rect = level.rect;
-                if (motionMask)
-                {
-                    FillMotionMask(motionRegions, level, rect);
-                    mask = level.mask;
-                }
+                View mask = motionMask ? level.mask : level.roi;
+                Rect rect = rects[i];
                 if (rect.Empty())
                     continue;
                 for (size_t j = 0; j < level.hids.size(); ++j)
@@ -335,6 +405,8 @@ namespace Simd
                 }
             }
 
+            joiner.Join();
+
             objects.clear();
             for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
                 GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
@@ -419,11 +491,111 @@ namespace Simd
         typedef std::unique_ptr<Level> LevelPtr;
         typedef std::vector<LevelPtr> LevelPtrs;
 
+        class Builder
+        {
+        public:
+            Builder()
+                : _busy(false)
+                , _stop(false)
+                , _ready(0)
+                , _thread(&Builder::Loop, this)
+            {
+            }
+
+            ~Builder()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _stop = true;
+                }
+                _start.notify_one();
+                _thread.join();
+            }
+
+            void Start(const std::function<void()> & task)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _task = task;
+                _ready = 0;
+                _busy = true;
+                _start.notify_one();
+            }
+
+            void Signal(size_t level)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _ready = level;
+                _progress.notify_all();
+            }
+
+            void Wait(size_t level)
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _progress.wait(lock, [&] { return !_busy || _ready >= level; });
+            }
+
+            void Join()
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _progress.wait(lock, [this] { return !_busy; });
+            }
+
+        private:
+            std::mutex _mutex;
+            std::condition_variable _start, _progress;
+            std::function<void()> _task;
+            bool _busy, _stop;
+            size_t _ready;
+            std::thread _thread;
+
+            void Loop()
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                for (;;)
+                {
+                    _start.wait(lock, [this] { return _stop || _busy; });
+                    if (_stop)
+                        return;
+                    std::function<void()> task;
+                    task.swap(_task);
+                    lock.unlock();
+                    task();
+                    lock.lock();
+                    _busy = false;
+                    _progress.notify_all();
+                }
+            }
+        };
+        typedef std::unique_ptr<Builder> BuilderPtr;
+
+        struct Joiner
+        {
+            Joiner(const BuilderPtr & builder)
+                : _builder(builder)
+            {
+            }
+
+            ~Joiner()
+            {
+                Join();
+            }
+
+            void Join()
+            {
+                if (_builder)
+                    _builder->Join();
+            }
+
+        private:
+            const BuilderPtr & _builder;
+        };
+
         std::vector<Data> _data;
         Size _imageSize;
         bool _needNormalization;
         ptrdiff_t _threadNumber;
         LevelPtrs _levels;
+        BuilderPtr _builder;
 
         bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
         {
@@ -513,38 +685,110 @@ namespace Simd
             return !_levels.empty();
         }
 
-        void FillLevels(View src)
+        void FillLevel(size_t index, const View & gray)
         {
-            View gray;
-            if (src.format != View::Gray8)
+            Level & level = *_levels[index];
+            if (index == 0)
             {
-                gray.Recreate(src.Size(), View::Gray8);
-                Convert(src, gray);
-                src = gray;
+                Simd::ResizeBilinear(gray, level.src);
+                if (_needNormalization)
+                    Simd::NormalizeHistogram(level.src, level.src);
             }
+            else
+                Simd::ResizeBilinear(_levels[0]->src, level.src);
+            EstimateIntegral(level, Rect(level.src.Size()));
+        }
+
+        void FillLevels(const View & gray, const std::vector<Rect> & rects)
+        {
+            std::vector<Rect> regions(_levels.size());
+            for (size_t i = 0; i < _levels.size(); ++i)
+                regions[i] = DetectionRegion(*_levels[i], rects[i]);
+
+            Level & base = *_levels[0];
+            Rect region = regions[0];
+            for (size_t i = 1; i < _levels.size(); ++i)
+                if (!regions[i].Empty())
+                    region |= SourceRegion(_levels[i]->src.Size(), regions[i], base.src.Size());
+            if (region.Empty())
+                return;
 
-            Simd::ResizeBilinear(src, _levels[0]->src);
             if (_needNormalization)
-                Simd::NormalizeHistogram(_levels[0]->src, _levels[0]->src);
-            EstimateIntegral(*_levels[0]);
+            {
+                Simd::ResizeBilinear(gray, base.src);
+                Simd::NormalizeHistogram(base.src, base.src);
+            }
+            else
+                ResizeRegion(gray, base.src, region);
+            if (!regions[0].Empty())
+                EstimateIntegral(base, regions[0]);
+
             for (size_t i = 1; i < _levels.size(); ++i)
             {
-                Simd::ResizeBilinear(_levels[0]->src, _levels[i]->src);
-                EstimateIntegral(*_levels[i]);
+                if (regions[i].Empty())
+                    continue;
+                Level & level = *_levels[i];
+                ResizeRegion(base.src, level.src, regions[i]);
+                EstimateIntegral(level, regions[i]);
+            }
+        }
+
+        Rect DetectionRegion(const Level & level, const Rect & rect) const
+        {
+            if (rect.Empty())
+                return Rect();
+            Size size(0, 0);
+            for (size_t i = 0; i < level.hids.size(); ++i)
+            {
+                size.x = std::max(size.x, level.hids[i].data->size.x);
+                size.y = std::max(size.y, level.hids[i].data->size.y);
             }
+            Rect region(rect.left - size.x / 2, rect.top - size.y / 2,
+                rect.right + size.x - size.x / 2, rect.bottom + size.y - size.y / 2);
+            return region.Intersection(Rect(level.src.Size()));
+        }
+
+        static Rect SourceRegion(const Size & dstSize, const Rect & dstRect, const Size & srcSize)
+        {
+            double kx = double(srcSize.x) / dstSize.x, ky = double(srcSize.y) / dstSize.y;
+            Rect srcRect(Round(dstRect.left * kx) - 1, Round(dstRect.top * ky) - 1,
+                Round(dstRect.right * kx) + 1, Round(dstRect.bottom * ky) + 1);
+            return srcRect.Intersection(Rect(srcSize));
         }
 
-        void EstimateIntegral(Level & level)
+        void ResizeRegion(const View & src, View & dst, const Rect & dstRect)
         {
+            if (src.Size() == dst.Size())
+            {
+                Simd::Copy(src.Region(dstRect), dst.Region(dstRect).Ref());
+                return;
+            }
+            double kx = double(src.width) / dst.width, ky = double(src.height) / dst.height;
+            Rect srcRect(Round(dstRect.left * kx), Round(dstRect.top * ky), Round(dstRect.right * kx), Round(dstRect.bottom * ky));
+            srcRect &= Rect(src.Size());
+            if (srcRect.Empty())
+                return;
+            Simd::ResizeBilinear(src.Region(srcRect), dst.Region(dstRect).Ref());
+        }
+
+        void EstimateIntegral(Level & level, const Rect & region)
+        {
+            View src = level.src.Region(region);
+            Rect rect(region.left, region.top, region.right + 1, region.bottom + 1);
+            View sum = level.sum.Region(rect);
             if (level.needSqsum)
             {
+                View sqsum = level.sqsum.Region(rect);
                 if (level.needTilted)
-                    Simd::Integral(level.src, level.sum, level.sqsum, level.tilted);
+                {
+                    View tilted = level.tilted.Region(rect);
+                    Simd::Integral(src, sum, sqsum, tilted);
+                }
                 else
-                    Simd::Integral(level.src, level.sum, level.sqsum);
+                    Simd::Integral(src, sum, sqsum);
             }
             else
-                Simd::Integral(level.src, level.sum);
+                Simd::Integral(src, sum);
         }
 
         void FillMotionMask(const Rects & rects, Level & level, Rect & rect) const
@@ -0,0 +1,102 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdDistances_h__
+#define __SimdDistances_h__
+
+#include "Simd/SimdArray.h"
+
+#include <vector>
+
+namespace Simd
+{
+    struct DistancesParam
+    {
+        size_t N, K;
+        SimdTensorDataType type;
+        SimdDistanceType distance;
+
+        DistancesParam(size_t n, size_t k, SimdTensorDataType t, SimdDistanceType d)
+            : N(n)
+            , K(k)
+            , type(t)
+            , distance(d)
+        {
+        }
+
+        bool Valid() const
+        {
+            return N > 0 && K > 0 && (type == SimdTensorData32f || type == SimdTensorData16f || type == SimdTensorData8i) &&
+                (distance == SimdDistanceCosine || distance == SimdDistanceSquaredL2);
+        }
+
+        size_t ElemSize() const
+        {
+            return type == SimdTensorData32f ? 4 : (type == SimdTensorData16f ? 2 : 1);
+        }
+    };
+
+    namespace Base
+    {
+        class Distances : public Deletable
+        {
+        public:
+            typedef void(*DotsPtr)(size_t M, size_t N, size_t K, const void * const * A, const void * const * B, float * dots, size_t stride);
+
+            Distances(const DistancesParam & param, const void * const * B, const float * bScales, DotsPtr dots, size_t microM, size_t microN);
+
+            void TopK(size_t M, const void * const * A, const float * aScales, size_t top, float * distances, size_t * indices) const;
+
+        protected:
+            typedef std::pair<float, size_t> Candidate;
+            typedef std::vector<Candidate> Candidates;
+
+            void Norms(size_t M, const void * const * A, const float * scales, float * norms) const;
+            void Search(size_t M, const void * const * A, const float * aScales, const float * aNorms, size_t top,
+                size_t begin, size_t end, float * buffer, Candidates * candidates) const;
+
+            DistancesParam _param;
+            DotsPtr _dots;
+            std::vector<const void *> _B;
+            Array32f _bScales, _bNorms;
+            size_t _blockM, _blockN;
+        };
+
+        void * DistancesInit(size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance, const void * const * B, const float * bScales);
+    }
+
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        void * DistancesInit(size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance, const void * const * B, const float * bScales);
+    }
+#endif //SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        void * DistancesInit(size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance, const void * const * B, const float * bScales);
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
+#endif//__SimdDistances_h__
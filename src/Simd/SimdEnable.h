@@ -127,6 +127,15 @@ namespace Simd
     }
 #endif
 
+#ifdef SIMD_AVX512BF16_ENABLE
+    namespace Avx512bf16
+    {
+        bool GetEnable();
+
+        const bool Enable = GetEnable();
+    }
+#endif
+
 #ifdef SIMD_VMX_ENABLE
     namespace Vmx
     {
@@ -223,6 +232,12 @@ namespace Simd
 #define SIMD_AVX512VNNI_FUNC(func)
 #endif
 
+#ifdef SIMD_AVX512BF16_ENABLE
+#define SIMD_AVX512BF16_FUNC(func) Simd::Avx512bf16::Enable ? Simd::Avx512bf16::func : 
+#else
+#define SIMD_AVX512BF16_FUNC(func)
+#endif
+
 #ifdef SIMD_VMX_ENABLE
 #define SIMD_VMX_FUNC(func) Simd::Vmx::Enable ? Simd::Vmx::func : 
 #else
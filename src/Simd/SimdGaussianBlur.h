@@ -38,6 +38,8 @@ namespace Simd
         size_t align;
 
         BlurParam(size_t w, size_t h, size_t c, const float* r, size_t a);
+
+        size_t Half() const;
     };
 
     namespace Base
@@ -49,6 +51,10 @@ namespace Simd
 
             virtual void Run(const uint8_t* src, size_t srcStride, uint8_t* dst, size_t dstStride);
 
+            void Run(const uint8_t* src, size_t srcStride, size_t height, uint8_t* dst, size_t dstStride);
+
+            size_t Half() const { return _half; }
+
         protected:
             BlurParam _param;
             size_t _half, _kernel, _edge, _start, _size, _stride;
@@ -25,8 +25,14 @@
 #define __SimdImageMatcher_hpp__
 
 #include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
+#include <thread>
+#include <atomic>
+#include <fstream>
+#include <cstring>
+#include <type_traits>
 
 namespace Simd
 {
@@ -58,12 +64,25 @@ namespace Simd
             }
         }
         \endverbatim
+
+        Added hashes can be saved with using of method Save() (and later extended with Append()) in flat binary format.
+        The saved data can be loaded with using of method Load() in place (for example from read-only memory mapped file), without recalculation of hashes.
     */
     template <class Tag, template<class> class Allocator>
     struct ImageMatcher
     {
         typedef Simd::View<Allocator> View; /*!< An image type definition. */
 
+        /*!
+            Creates a new ImageMatcher.
+
+            \param [in] threadNumber - a maximal number of threads used by Find() for large sets of images. By default it is equal to number of hardware threads.
+        */
+        ImageMatcher(size_t threadNumber = std::thread::hardware_concurrency())
+            : _threadNumber(std::max<size_t>(threadNumber, 1))
+        {
+        }
+
         /*!
             \short The Hash structure is used for fast image matching.
 
@@ -87,6 +106,7 @@ namespace Simd
             uint8_t * main;
             uint8_t * fast;
             mutable bool skip;
+            std::vector<std::pair<size_t, size_t> > ids; // (matcher uid, index of stored copy) for every Add().
 
             friend struct ImageMatcher;
         };
@@ -97,18 +117,35 @@ namespace Simd
         */
         struct Result
         {
-            const Hash * hash; /*!< A hash to found similar image. */
+            const Hash * hash; /*!< \deprecated It is always NULL: ImageMatcher copies added hashes into its own storage and doesn't keep them. Use tag to identify found image. */
             const double difference; /*!< A mean squared difference between current and found similar image. */
+            const Tag tag; /*!< A tag of found similar image. */
 
             /*!
                 Creates a new Result structure.
 
+                \deprecated ImageMatcher doesn't use it, Result::hash of found images is always NULL.
+
                 \param [in] h - a pointer to hash of found similar image.
                 \param [in] d - A mean squared difference.
             */
             Result(const Hash * h, double d)
                 : hash(h)
                 , difference(d)
+                , tag(h->tag)
+            {
+            }
+
+            /*!
+                Creates a new Result structure for image which has no Hash (it was loaded with using of ImageMatcher::Load()).
+
+                \param [in] t - a tag of found similar image.
+                \param [in] d - A mean squared difference.
+            */
+            Result(const Tag & t, double d)
+                : hash(NULL)
+                , difference(d)
+                , tag(t)
             {
             }
         };
@@ -157,16 +194,7 @@ namespace Simd
         */
         bool Init(double threshold = 0.05, HashType type = Hash16x16, size_t number = 0, bool normalized = false)
         {
-            static const size_t sizes[] = { 16, 32, 64 };
-            size_t size = sizes[type];
-
-            if (number >= 10000 && threshold < 0.10)
-                _matcher.reset(new Matcher_3D(threshold, size, number, normalized));
-            else if (number > 1000 && !normalized)
-                _matcher.reset(new Matcher_1D(threshold, size, number));
-            else
-                _matcher.reset(new Matcher_0D(threshold, size, number));
-            return (bool)_matcher;
+            return Init(threshold, type, number, normalized, number);
         }
 
         /*!
@@ -225,10 +253,20 @@ namespace Simd
         bool Find(const HashPtr & hash, Results & results)
         {
             results.clear();
-            _matcher->Find(hash, results);
+            _matcher->Find(hash, results, _threadNumber);
             return results.size() != 0;
         }
 
+        /*!
+            Sets maximal number of threads used by Find().
+
+            \param [in] threadNumber - a maximal number of threads.
+        */
+        void SetThreadNumber(size_t threadNumber)
+        {
+            _threadNumber = std::max<size_t>(threadNumber, 1);
+        }
+
         /*!
             Adds given image to ImageMatcher.
 
@@ -240,28 +278,230 @@ namespace Simd
         }
 
         /*!
-            Skips searching of the image in ImageMatcher.
+            Skips searching of the image in ImageMatcher. Copies of the image earlier added to other ImageMatchers are still found there.
 
             \param [in] hash - a smart pointer to hash of the image.
         */
         void Skip(const HashPtr & hash)
         {
             hash->skip = true;
+            if (_matcher)
+                _matcher->Skip(*hash);
+        }
+
+        /*!
+            Saves ImageMatcher (parameters of initialization, all added hashes and their tags) to output stream in flat binary format.
+            The saved data can be loaded in place (for example from read-only memory mapped file) with using of method Load().
+
+            \note Tag has to be a trivially copyable type. Hashes marked by Skip() are not saved.
+
+            \param [out] os - an output stream opened in binary mode.
+            \return the result of the operation.
+        */
+        bool Save(std::ostream & os) const
+        {
+            static_assert(std::is_trivially_copyable<Tag>::value, "ImageMatcher::Save requires trivially copyable Tag!");
+            if (!_matcher)
+                return false;
+            os.write((const char*)&_header, sizeof(_header));
+            return _matcher->Write(os, true) && os.good();
+        }
+
+        /*!
+            Saves ImageMatcher to file in flat binary format.
+
+            \param [in] path - a path to output file.
+            \return the result of the operation.
+        */
+        bool Save(const std::string & path) const
+        {
+            std::ofstream ofs(path.c_str(), std::ofstream::binary);
+            if (ofs.is_open())
+            {
+                bool result = Save(ofs);
+                ofs.close();
+                return result;
+            }
+            return false;
+        }
+
+        /*!
+            Appends hashes which were added to ImageMatcher after last call of Save(), Append() or Load() to the end of data saved earlier for this ImageMatcher.
+            The appended data is loaded by Load() together with the earlier saved data.
+
+            \note Append() fails if ImageMatcher was neither saved nor loaded after its initialization.
+
+            \param [out] os - an output stream positioned at the end of the earlier saved data.
+            \return the result of the operation.
+        */
+        bool Append(std::ostream & os)
+        {
+            static_assert(std::is_trivially_copyable<Tag>::value, "ImageMatcher::Append requires trivially copyable Tag!");
+            if (!_matcher || !_matcher->Persistent())
+                return false;
+            return _matcher->Write(os, false) && os.good();
+        }
+
+        /*!
+            Appends new hashes to the end of file saved earlier for this ImageMatcher.
+
+            \param [in] path - a path to the file.
+            \return the result of the operation.
+        */
+        bool Append(const std::string & path)
+        {
+            std::ofstream ofs(path.c_str(), std::ofstream::binary | std::ofstream::app);
+            if (ofs.is_open())
+            {
+                bool result = Append(ofs);
+                ofs.close();
+                return result;
+            }
+            return false;
+        }
+
+        /*!
+            Loads ImageMatcher from external buffer in place. The hashes are not copied, so the buffer (for example read-only memory mapped file)
+            has to be valid until ImageMatcher is reinitialized or destroyed. Hashes added after loading are stored in ImageMatcher itself.
+
+            \param [in] data - a pointer to the buffer with data saved by Save() (and possibly Append()).
+            \param [in] size - a size of the buffer.
+            \return the result of the operation.
+        */
+        bool Load(const uint8_t * data, size_t size)
+        {
+            static_assert(std::is_trivially_copyable<Tag>::value, "ImageMatcher::Load requires trivially copyable Tag!");
+            BinaryHeader header;
+            if (data == NULL || size < sizeof(header))
+                return false;
+            memcpy(&header, data, sizeof(header));
+            if (header.magic != BINARY_MAGIC || header.version != BINARY_VERSION || header.type > Hash64x64 || header.tagSize != sizeof(Tag))
+                return false;
+            if (!(header.threshold >= 0.0 && header.threshold <= 1.0) || header.number > (uint64_t)size_t(-1))
+                return false;
+            size_t hashSize = Square(HashSize((HashType)header.type)) + Square(FAST_SIZE) + sizeof(Tag);
+            size_t stored = (size - sizeof(header)) / hashSize;
+            if (!Init(header.threshold, (HashType)header.type, (size_t)header.number, header.normalized != 0, std::min((size_t)header.number, stored)))
+                return false;
+            if (!_matcher->Map(data + sizeof(header), size - sizeof(header)))
+            {
+                _matcher.reset();
+                return false;
+            }
+            Buffer().swap(_buffer);
+            return true;
+        }
+
+        /*!
+            Loads ImageMatcher from input stream. The data is copied into internal buffer.
+
+            \param [in] is - an input stream opened in binary mode.
+            \return the result of the operation.
+        */
+        bool Load(std::istream & is)
+        {
+            Buffer buffer((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+            if (!Load(buffer.data(), buffer.size()))
+                return false;
+            _buffer.swap(buffer);
+            return true;
+        }
+
+        /*!
+            Loads ImageMatcher from file. The data is copied into internal buffer.
+
+            \param [in] path - a path to input file.
+            \return the result of the operation.
+        */
+        bool Load(const std::string & path)
+        {
+            std::ifstream ifs(path.c_str(), std::ifstream::binary);
+            if (ifs.is_open())
+            {
+                bool result = Load(ifs);
+                ifs.close();
+                return result;
+            }
+            return false;
         }
 
     private:
+        typedef std::vector<uint8_t, Allocator<uint8_t> > Buffer;
+
+        static const uint32_t BINARY_MAGIC = 0x484D4953;
+        static const uint32_t BINARY_VERSION = 1;
+        static const size_t BINARY_ALIGN = 16;
+
+        struct BinaryHeader
+        {
+            uint32_t magic, version, type, normalized;
+            double threshold;
+            uint64_t number, tagSize, reserved;
+        };
+
+        struct BinaryChunk
+        {
+            uint64_t size, count, buckets, reserved;
+        };
+
+        struct BinaryBucket
+        {
+            uint64_t index, begin;
+        };
+
+        static size_t BinaryAlign(size_t size)
+        {
+            return (size + BINARY_ALIGN - 1) & ~(BINARY_ALIGN - 1);
+        }
+
+        static const size_t FAST_SIZE = 4;
+
+        static size_t HashSize(HashType type)
+        {
+            static const size_t sizes[] = { 16, 32, 64 };
+            return sizes[type];
+        }
+
+        bool Init(double threshold, HashType type, size_t number, bool normalized, size_t reserve)
+        {
+            size_t size = HashSize(type);
+
+            if (number >= 10000 && threshold < 0.10)
+                _matcher.reset(new Matcher_3D(threshold, size, reserve, normalized));
+            else if (number > 1000 && !normalized)
+                _matcher.reset(new Matcher_1D(threshold, size, reserve));
+            else
+                _matcher.reset(new Matcher_0D(threshold, size, reserve));
+
+            memset(&_header, 0, sizeof(_header));
+            _header.magic = BINARY_MAGIC;
+            _header.version = BINARY_VERSION;
+            _header.type = (uint32_t)type;
+            _header.normalized = normalized ? 1 : 0;
+            _header.threshold = threshold;
+            _header.number = number;
+            _header.tagSize = sizeof(Tag);
+            return (bool)_matcher;
+        }
+
+        BinaryHeader _header;
+        Buffer _buffer;
+
         struct Matcher
         {
             const size_t fast;
             const size_t main;
 
             Matcher(double threshold, size_t size)
-                : fast(4)
+                : fast(FAST_SIZE)
                 , main(size)
                 , _fastSize(fast*fast)
                 , _mainSize(size*size)
                 , _size(0)
+                , _persisted(0)
+                , _persistent(false)
                 , _threshold(threshold)
+                , _uid(Uid())
             {
                 _fastMax = uint64_t(Square(threshold*UINT8_MAX)*_fastSize);
                 _mainMax = uint64_t(Square(threshold*UINT8_MAX)*_mainSize);
@@ -269,47 +509,303 @@ namespace Simd
 
             size_t Size() const { return _size; }
 
+            bool Persistent() const { return _persistent; }
+
             virtual ~Matcher() {}
             virtual void Add(const HashPtr & hash) = 0;
-            virtual void Find(const HashPtr & hash, Results & results) = 0;
+
+            void Skip(const Hash & hash)
+            {
+                for (size_t i = 0; i < hash.ids.size(); ++i)
+                    if (hash.ids[i].first == _uid)
+                        _skip[hash.ids[i].second] = 1;
+            }
+
+            void Find(const HashPtr & hash, Results & results, size_t threadNumber) const
+            {
+                if (hash->skip)
+                    return;
+
+                Indices indices;
+                Select(hash, indices);
+
+                size_t total = 0, maxCount = 0;
+                for (size_t i = 0; i < indices.size(); ++i)
+                {
+                    const Set & set = _sets[indices[i]];
+                    for (size_t s = 0; s < set.spans.size(); ++s)
+                    {
+                        total += set.spans[s].count;
+                        maxCount = std::max(maxCount, set.spans[s].count);
+                    }
+                    total += set.ids.size();
+                    maxCount = std::max(maxCount, set.ids.size());
+                }
+
+#ifndef SIMD_FUTURE_DISABLE
+                size_t threads = std::min(threadNumber, total / PARALLEL_MIN);
+                if (threads > 1)
+                {
+                    FindParallel(hash, indices, total, maxCount, threads, results);
+                    return;
+                }
+#endif
+                Sums sums(maxCount);
+                for (size_t i = 0; i < indices.size(); ++i)
+                    FindIn(indices[i], hash, sums.data(), results);
+            }
+
+            bool Write(std::ostream & os, bool all) const
+            {
+                size_t begin = all ? 0 : _persisted;
+                BinaryChunk chunk = { 0, 0, 0, 0 };
+                std::vector<BinaryBucket> buckets;
+                for (size_t i = 0; i < _sets.size(); ++i)
+                {
+                    size_t count = Count(_sets[i], all, begin);
+                    if (count)
+                    {
+                        BinaryBucket bucket = { i, chunk.count };
+                        buckets.push_back(bucket);
+                        chunk.count += count;
+                    }
+                }
+                if (chunk.count == 0)
+                    return Persisted();
+
+                chunk.buckets = buckets.size();
+                size_t sizes[3] = { _fastSize, _mainSize, sizeof(Tag) };
+                chunk.size = sizeof(chunk) + BinaryAlign(buckets.size() * sizeof(BinaryBucket));
+                for (size_t part = 0; part < 3; ++part)
+                    chunk.size += BinaryAlign(chunk.count*sizes[part]);
+
+                const char zero[BINARY_ALIGN] = { 0 };
+                os.write((const char*)&chunk, sizeof(chunk));
+                os.write((const char*)buckets.data(), buckets.size() * sizeof(BinaryBucket));
+                for (size_t part = 0; part < 3; ++part)
+                {
+                    for (size_t i = 0; i < buckets.size(); ++i)
+                        Write(os, _sets[buckets[i].index], all, begin, part);
+                    size_t size = chunk.count*sizes[part];
+                    os.write(zero, BinaryAlign(size) - size);
+                }
+                return os.good() && Persisted();
+            }
+
+            bool Map(const uint8_t * data, size_t size)
+            {
+                for (size_t offset = 0; offset < size;)
+                {
+                    BinaryChunk chunk;
+                    if (size - offset < sizeof(chunk))
+                        return false;
+                    memcpy(&chunk, data + offset, sizeof(chunk));
+                    if (chunk.count > size || chunk.buckets > chunk.count || chunk.size > size - offset)
+                        return false;
+
+                    size_t fast = sizeof(chunk) + BinaryAlign((size_t)chunk.buckets * sizeof(BinaryBucket));
+                    size_t main = fast + BinaryAlign((size_t)chunk.count*_fastSize);
+                    size_t tags = main + BinaryAlign((size_t)chunk.count*_mainSize);
+                    if (chunk.size != tags + BinaryAlign((size_t)chunk.count*sizeof(Tag)))
+                        return false;
+
+                    const uint8_t * base = data + offset;
+                    for (size_t i = 0; i < chunk.buckets; ++i)
+                    {
+                        BinaryBucket bucket, next = { 0, chunk.count };
+                        memcpy(&bucket, base + sizeof(chunk) + i * sizeof(bucket), sizeof(bucket));
+                        if (i + 1 < chunk.buckets)
+                            memcpy(&next, base + sizeof(chunk) + (i + 1) * sizeof(bucket), sizeof(next));
+                        uint64_t end = next.begin;
+                        if (bucket.index >= _sets.size() || bucket.begin >= end || end > chunk.count)
+                            return false;
+                        Span span;
+                        span.fast = base + fast + bucket.begin*_fastSize;
+                        span.main = base + main + bucket.begin*_mainSize;
+                        span.tags = base + tags + bucket.begin*sizeof(Tag);
+                        span.count = size_t(end - bucket.begin);
+                        _sets[bucket.index].spans.push_back(span);
+                        _size += span.count;
+                    }
+                    offset += chunk.size;
+                }
+                return Persisted();
+            }
 
         protected:
-            typedef std::vector<HashPtr> Set;
+            typedef std::vector<size_t> Indices;
+            typedef std::vector<uint64_t> Sums;
+
+            struct Span
+            {
+                const uint8_t * fast;
+                const uint8_t * main;
+                const uint8_t * tags;
+                size_t count;
+            };
+
+            struct Set
+            {
+                Buffer fast, main;
+                std::vector<Tag> tags;
+                Indices ids;
+                std::vector<Span> spans;
+            };
             typedef std::vector<Set> Sets;
             Sets _sets;
+            std::vector<uint8_t> _skip;
             size_t _fastSize, _mainSize, _size;
+            mutable size_t _persisted;
+            mutable bool _persistent;
             uint64_t _mainMax, _fastMax;
             double _threshold;
+            size_t _uid;
+
+            static size_t Uid()
+            {
+                static std::atomic<size_t> uid(0);
+                return ++uid;
+            }
+
+            static const size_t PARALLEL_MIN = 0x10000;
+
+            virtual void Select(const HashPtr & hash, Indices & indices) const = 0;
+
+            bool Persisted() const
+            {
+                _persisted = _skip.size();
+                _persistent = true;
+                return true;
+            }
 
             void AddIn(size_t index, const HashPtr & hash)
             {
-                _sets[index].push_back(hash);
+                Set & set = _sets[index];
+                set.fast.insert(set.fast.end(), hash->fast, hash->fast + _fastSize);
+                set.main.insert(set.main.end(), hash->main, hash->main + _mainSize);
+                set.tags.push_back(hash->tag);
+                set.ids.push_back(_skip.size());
+                hash->ids.push_back(std::make_pair(_uid, _skip.size()));
+                _skip.push_back(hash->skip ? 1 : 0);
                 _size++;
             }
 
-            void FindIn(size_t index, const HashPtr & hash, Results & results)
+#ifndef SIMD_FUTURE_DISABLE
+            struct Piece
+            {
+                size_t set, span, begin, end; // span == RUNTIME means the entries added at runtime.
+            };
+            static const size_t RUNTIME = size_t(-1);
+
+            void FindParallel(const HashPtr & hash, const Indices & indices, size_t total, size_t maxCount, size_t threads, Results & results) const
+            {
+                size_t blocks = threads * SIMD_PARALLEL_BLOCKS_PER_THREAD;
+                size_t step = (total + blocks - 1) / blocks;
+
+                std::vector<Piece> pieces;
+                for (size_t i = 0; i < indices.size(); ++i)
+                {
+                    const Set & set = _sets[indices[i]];
+                    for (size_t s = 0; s <= set.spans.size(); ++s)
+                    {
+                        size_t span = s < set.spans.size() ? s : RUNTIME;
+                        size_t count = s < set.spans.size() ? set.spans[s].count : set.ids.size();
+                        for (size_t begin = 0; begin < count; begin += step)
+                        {
+                            Piece piece = { indices[i], span, begin, std::min(begin + step, count) };
+                            pieces.push_back(piece);
+                        }
+                    }
+                }
+
+                Indices bounds(1, 0);
+                for (size_t i = 0, sum = 0; i < pieces.size(); ++i)
+                {
+                    sum += pieces[i].end - pieces[i].begin;
+                    if (sum >= step * bounds.size() || i + 1 == pieces.size())
+                        bounds.push_back(i + 1);
+                }
+
+                std::vector<Sums> sums(threads, Sums(std::min(maxCount, step)));
+                std::vector<Results> partial(bounds.size() - 1);
+                auto process = [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t b = begin; b < end; ++b)
+                    {
+                        for (size_t i = bounds[b]; i < bounds[b + 1]; ++i)
+                        {
+                            const Piece & piece = pieces[i];
+                            const Set & set = _sets[piece.set];
+                            if (piece.span == RUNTIME)
+                                FindAdded(set, piece.begin, piece.end, hash, sums[thread].data(), partial[b]);
+                            else
+                                FindSpan(set.spans[piece.span], piece.begin, piece.end, hash, sums[thread].data(), partial[b]);
+                        }
+                    }
+                };
+                struct Wrapper
+                {
+                    static void Task(const void * function, size_t thread, size_t begin, size_t end)
+                    {
+                        (*(const decltype(process)*)function)(thread, begin, end);
+                    }
+                };
+                if (!ThreadPool::Global().Run(0, partial.size(), 1, threads, Wrapper::Task, &process))
+                    process(0, 0, partial.size());
+
+                for (size_t b = 0; b < partial.size(); ++b)
+                    for (size_t i = 0; i < partial[b].size(); ++i)
+                        results.push_back(partial[b][i]);
+            }
+#endif
+
+            void FindIn(size_t index, const HashPtr & hash, uint64_t * sums, Results & results) const
             {
                 const Set & set = _sets[index];
-                for (size_t i = 0; i < set.size(); ++i)
+                for (size_t s = 0; s < set.spans.size(); ++s)
+                    FindSpan(set.spans[s], 0, set.spans[s].count, hash, sums, results);
+                FindAdded(set, 0, set.ids.size(), hash, sums, results);
+            }
+
+            void FindSpan(const Span & span, size_t begin, size_t end, const HashPtr & hash, uint64_t * sums, Results & results) const
+            {
+                if (begin >= end)
+                    return;
+
+                ::SimdSquaredDifferenceSums(hash->fast, span.fast + begin*_fastSize, _fastSize, _fastSize, end - begin, sums);
+                for (size_t i = begin; i < end; ++i)
                 {
-                    double difference = 0;
-                    if (Compare(set[i], hash, difference))
-                        results.push_back(Result(set[i].get(), difference));
+                    double difference;
+                    if (sums[i - begin] <= _fastMax && Compare(hash, span.main + i*_mainSize, difference))
+                    {
+                        Tag tag;
+                        memcpy(&tag, span.tags + i*sizeof(Tag), sizeof(Tag));
+                        results.push_back(Result(tag, difference));
+                    }
                 }
             }
 
-            bool Compare(const HashPtr & a, const HashPtr &  b, double & difference)
+            void FindAdded(const Set & set, size_t begin, size_t end, const HashPtr & hash, uint64_t * sums, Results & results) const
             {
-                if (a->skip || b->skip)
-                    return false;
+                if (begin >= end)
+                    return;
 
-                uint64_t fastSum = 0;
-                ::SimdSquaredDifferenceSum(a->fast, _fastSize, b->fast, _fastSize, _fastSize, 1, &fastSum);
-                if (fastSum > _fastMax)
-                    return false;
+                ::SimdSquaredDifferenceSums(hash->fast, set.fast.data() + begin*_fastSize, _fastSize, _fastSize, end - begin, sums);
+                for (size_t i = begin; i < end; ++i)
+                {
+                    if (sums[i - begin] > _fastMax)
+                        continue;
 
+                    double difference;
+                    if (!_skip[set.ids[i]] && Compare(hash, set.main.data() + i*_mainSize, difference))
+                        results.push_back(Result(set.tags[i], difference));
+                }
+            }
+
+            bool Compare(const HashPtr & hash, const uint8_t * main, double & difference) const
+            {
                 uint64_t mainSum = 0;
-                ::SimdSquaredDifferenceSum(a->main, _mainSize, b->main, _mainSize, _mainSize, 1, &mainSum);
+                ::SimdSquaredDifferenceSums(hash->main, main, _mainSize, _mainSize, 1, &mainSum);
                 if (mainSum > _mainMax)
                     return false;
 
@@ -317,9 +813,48 @@ namespace Simd
 
                 return difference <= _threshold;
             }
+
+            size_t Count(const Set & set, bool all, size_t begin) const
+            {
+                size_t count = 0;
+                if (all)
+                {
+                    for (size_t s = 0; s < set.spans.size(); ++s)
+                        count += set.spans[s].count;
+                }
+                for (size_t i = 0; i < set.ids.size(); ++i)
+                {
+                    if (set.ids[i] >= begin && !_skip[set.ids[i]])
+                        count++;
+                }
+                return count;
+            }
+
+            void Write(std::ostream & os, const Set & set, bool all, size_t begin, size_t part) const
+            {
+                size_t size = part == 0 ? _fastSize : (part == 1 ? _mainSize : sizeof(Tag));
+                if (all)
+                {
+                    for (size_t s = 0; s < set.spans.size(); ++s)
+                    {
+                        const Span & span = set.spans[s];
+                        const uint8_t * src = part == 0 ? span.fast : (part == 1 ? span.main : span.tags);
+                        os.write((const char*)src, span.count*size);
+                    }
+                }
+                for (size_t i = 0; i < set.ids.size(); ++i)
+                {
+                    if (set.ids[i] < begin || _skip[set.ids[i]])
+                        continue;
+                    const uint8_t * src = part == 0 ? set.fast.data() + i * _fastSize : 
+                        (part == 1 ? set.main.data() + i * _mainSize : (const uint8_t*)(set.tags.data() + i));
+                    os.write((const char*)src, size);
+                }
+            }
         };
         typedef std::unique_ptr<Matcher> MatcherPtr;
         MatcherPtr _matcher;
+        size_t _threadNumber;
 
         struct Matcher_0D : public Matcher
         {
@@ -327,7 +862,11 @@ namespace Simd
                 : Matcher(threshold, size)
             {
                 this->_sets.resize(1);
-                this->_sets[0].reserve(number);
+                this->_sets[0].fast.reserve(number*this->_fastSize);
+                this->_sets[0].main.reserve(number*this->_mainSize);
+                this->_sets[0].tags.reserve(number);
+                this->_sets[0].ids.reserve(number);
+                this->_skip.reserve(number);
             }
 
             virtual void Add(const HashPtr & hash)
@@ -335,9 +874,10 @@ namespace Simd
                 this->AddIn(0, hash);
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+        protected:
+            virtual void Select(const HashPtr & hash, typename Matcher::Indices & indices) const
             {
-                this->FindIn(0, hash, results);
+                indices.push_back(0);
             }
         };
 
@@ -348,6 +888,7 @@ namespace Simd
                 , _range(256)
             {
                 this->_sets.resize(_range);
+                this->_skip.reserve(number);
                 _half = (int)ceil(double(_range)*threshold);
             }
 
@@ -356,17 +897,18 @@ namespace Simd
                 this->AddIn(Get(hash), hash);
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+        protected:
+            virtual void Select(const HashPtr & hash, typename Matcher::Indices & indices) const
             {
                 size_t index = Get(hash);
                 for (size_t i = std::max(index, _half) - _half, end = std::min(index + _half + 1, _range); i < end; ++i)
-                    this->FindIn(i, hash, results);
+                    indices.push_back(i);
             }
 
         private:
             size_t _range, _half;
 
-            size_t Get(const HashPtr & hash)
+            size_t Get(const HashPtr & hash) const
             {
                 size_t sum = 0;
                 for (size_t i = 0; i < this->_fastSize; ++i)
@@ -397,6 +939,7 @@ namespace Simd
                 _stride.z = _range.x*_range.y;
 
                 this->_sets.resize(_range.z*_range.x*_range.y);
+                this->_skip.reserve(number);
                 _half = (int)ceil(double(_maxRange)*threshold);
             }
 
@@ -407,7 +950,8 @@ namespace Simd
                 this->AddIn(i.x*_stride.x + i.y*_stride.y + i.z*_stride.z, hash);
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+        protected:
+            virtual void Select(const HashPtr & hash, typename Matcher::Indices & indices) const
             {
                 Index i, lo, hi;
                 Get(hash, i);
@@ -423,7 +967,7 @@ namespace Simd
                 for (int z = lo.z; z < hi.z; z += _stride.z)
                     for (int y = lo.y; y < hi.y; y += _stride.y)
                         for (int x = lo.x; x < hi.x; x += _stride.x)
-                            this->FindIn(x + y + z, hash, results);
+                            indices.push_back(x + y + z);
             }
 
         private:
@@ -438,7 +982,7 @@ namespace Simd
             };
             Index _shift, _range, _stride;
 
-            void Get(const HashPtr & hash, Index & index)
+            void Get(const HashPtr & hash, Index & index) const
             {
                 const uint8_t * p = hash->fast;
                 int s[2][2];
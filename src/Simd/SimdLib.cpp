@@ -61,15 +61,21 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdConst.h"
 #include "Simd/SimdLog.h"
 #include "Simd/SimdPerformance.h"
+#include "Simd/SimdParallel.hpp"
 
 #include "Simd/SimdGaussianBlur.h"
 #include "Simd/SimdResizer.h"
+#include "Simd/SimdDistances.h"
+#include "Simd/SimdWarp.h"
+#include "Simd/SimdStripFilter.h"
 #include "Simd/SimdSynetConvolution8i.h"
+#include "Simd/SimdSynetConvolution16b.h"
 #include "Simd/SimdSynetConvolution32f.h"
 #include "Simd/SimdSynetDeconvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynetScale8i.h"
+#include "Simd/SimdSynetYuvToTensor.h"
 
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse1.h"
@@ -83,6 +89,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdAvx512f.h"
 #include "Simd/SimdAvx512bw.h"
 #include "Simd/SimdAvx512vnni.h"
+#include "Simd/SimdAvx512bf16.h"
 #include "Simd/SimdVmx.h"
 #include "Simd/SimdVsx.h"
 #include "Simd/SimdNeon.h"
@@ -101,6 +108,44 @@ SIMD_API const char * SimdVersion()
     return SIMD_VERSION;
 }
 
+namespace Simd
+{
+    template<class Function> void ParallelRows(size_t width, size_t height, size_t halo, size_t align, uint8_t * dst, size_t dstStride, size_t dstSize, const Function & function)
+    {
+        size_t threads = width * height >= Base::GetThreadThreshold() ? Base::GetThreadNumber() : 1;
+        size_t strip = AlignHi(Simd::Max<size_t>(4 * halo, 16), align);
+        size_t strips = Simd::Min(threads * SIMD_PARALLEL_BLOCKS_PER_THREAD, height / strip);
+        if (threads < 2 || strips < 2)
+        {
+            function(0, height, dst, dstStride);
+            return;
+        }
+        Simd::Parallel(0, strips, [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                size_t y0 = AlignLo(height * i / strips, align);
+                size_t y1 = i + 1 < strips ? AlignLo(height * (i + 1) / strips, align) : height;
+                function(y0, y1 - y0, dst + y0 * dstStride, dstStride);
+            }
+        }, threads);
+        if (halo)
+        {
+            Simd::Parallel(1, strips, [&](size_t thread, size_t begin, size_t end)
+            {
+                Array8u buffer(4 * halo * dstSize);
+                for (size_t i = begin; i < end; ++i)
+                {
+                    size_t y = AlignLo(height * i / strips, align);
+                    function(y - 2 * halo, 4 * halo, buffer.data, dstSize);
+                    for (size_t row = halo; row < 3 * halo; ++row)
+                        memcpy(dst + (y - 2 * halo + row) * dstStride, buffer.data + row * dstSize, dstSize);
+                }
+            }, threads);
+        }
+    }
+}
+
 using namespace Simd;
 
 SIMD_API size_t SimdCpuInfo(SimdCpuInfoType type)
@@ -146,6 +191,9 @@ SIMD_API size_t SimdCpuInfo(SimdCpuInfoType type)
 #ifdef SIMD_AVX512VNNI_ENABLE
     case SimdCpuInfoAvx512vnni: return Avx512vnni::Enable ? 1 : 0;
 #endif
+#ifdef SIMD_AVX512BF16_ENABLE
+    case SimdCpuInfoAvx512bf16: return Avx512bf16::Enable ? 1 : 0;
+#endif
 #ifdef SIMD_VMX_ENABLE
     case SimdCpuInfoVmx: return Vmx::Enable ? 1 : 0;
 #endif
@@ -204,6 +252,26 @@ SIMD_API void SimdSetThreadNumber(size_t threadNumber)
     Base::SetThreadNumber(threadNumber);
 }
 
+SIMD_API size_t SimdGetThreadThreshold()
+{
+    return Base::GetThreadThreshold();
+}
+
+SIMD_API void SimdSetThreadThreshold(size_t pixels)
+{
+    Base::SetThreadThreshold(pixels);
+}
+
+SIMD_API SimdBool SimdSetThreadAffinity(const size_t * cpus, size_t size)
+{
+    return Base::SetThreadAffinity(cpus, size) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdSetThreadNumaNode(size_t node)
+{
+    return Base::SetThreadNumaNode(node) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API SimdBool SimdGetFastMode()
 {
 #ifdef SIMD_SSE_ENABLE
@@ -815,52 +883,60 @@ SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size
 
 SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
+    ParallelRows(width, height, 2, 2, bgr, bgrStride, width * 3, [&](size_t y, size_t h, uint8_t * d, size_t ds)
+    {
+        const uint8_t * s = bayer + y * bayerStride;
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
+        if (Avx512bw::Enable && width >= Avx512bw::A + 2)
+            Avx512bw::BayerToBgr(s, width, h, bayerStride, bayerFormat, d, ds);
+        else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
+        if (Avx2::Enable && width >= Avx2::A + 2)
+            Avx2::BayerToBgr(s, width, h, bayerStride, bayerFormat, d, ds);
+        else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if (Ssse3::Enable && width >= Ssse3::A + 2)
-        Ssse3::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
+        if (Ssse3::Enable && width >= Ssse3::A + 2)
+            Ssse3::BayerToBgr(s, width, h, bayerStride, bayerFormat, d, ds);
+        else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
-    else
+        if (Neon::Enable && width >= Neon::A + 2)
+            Neon::BayerToBgr(s, width, h, bayerStride, bayerFormat, d, ds);
+        else
 #endif
-        Base::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+            Base::BayerToBgr(s, width, h, bayerStride, bayerFormat, d, ds);
+    });
 }
 
 SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+    ParallelRows(width, height, 2, 2, bgra, bgraStride, width * 4, [&](size_t y, size_t h, uint8_t * d, size_t ds)
+    {
+        const uint8_t * s = bayer + y * bayerStride;
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width >= Avx512bw::A + 2)
-        Avx512bw::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
+        if (Avx512bw::Enable && width >= Avx512bw::A + 2)
+            Avx512bw::BayerToBgra(s, width, h, bayerStride, bayerFormat, d, ds, alpha);
+        else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if (Avx2::Enable && width >= Avx2::A + 2)
-        Avx2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
+        if (Avx2::Enable && width >= Avx2::A + 2)
+            Avx2::BayerToBgra(s, width, h, bayerStride, bayerFormat, d, ds, alpha);
+        else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if (Sse2::Enable && width >= Sse2::A + 2)
-        Sse2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
+        if (Sse2::Enable && width >= Sse2::A + 2)
+            Sse2::BayerToBgra(s, width, h, bayerStride, bayerFormat, d, ds, alpha);
+        else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A + 2)
-        Neon::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
-    else
+        if (Neon::Enable && width >= Neon::A + 2)
+            Neon::BayerToBgra(s, width, h, bayerStride, bayerFormat, d, ds, alpha);
+        else
 #endif
-        Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+            Base::BayerToBgra(s, width, h, bayerStride, bayerFormat, d, ds, alpha);
+    });
 }
 
 SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
@@ -920,32 +996,36 @@ SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, s
 
 SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
 {
+    ParallelRows(width, height, 0, 1, gray, grayStride, width, [&](size_t y, size_t h, uint8_t * d, size_t ds)
+    {
+        const uint8_t * s = bgra + y * bgraStride;
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
+        if (Avx512bw::Enable)
+            Avx512bw::BgraToGray(s, width, h, bgraStride, d, ds);
+        else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
+        if(Avx2::Enable && width >= Avx2::A)
+            Avx2::BgraToGray(s, width, h, bgraStride, d, ds);
+        else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
+        if(Sse2::Enable && width >= Sse2::A)
+            Sse2::BgraToGray(s, width, h, bgraStride, d, ds);
+        else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
+        if(Vmx::Enable && width >= Vmx::A)
+            Vmx::BgraToGray(s, width, h, bgraStride, d, ds);
+        else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
-    else
+        if (Neon::Enable && width >= Neon::HA)
+            Neon::BgraToGray(s, width, h, bgraStride, d, ds);
+        else
 #endif
-        Base::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+            Base::BgraToGray(s, width, h, bgraStride, d, ds);
+    });
 }
 
 SIMD_API void SimdBgraToRgb(const uint8_t* bgra, size_t width, size_t height, size_t bgraStride, uint8_t* rgb, size_t rgbStride)
@@ -1104,6 +1184,69 @@ SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t
         Base::BgraToYuva420p(bgra, bgraStride, width, height, y, yStride, u, uStride, v, vStride, a, aStride);
 }
 
+SIMD_API void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+    uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgraToYuv420pV2(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
+SIMD_API void SimdBgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+    uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::BgraToNv12(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToNv12(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToNv12(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+        Base::BgraToNv12(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
+}
+
+SIMD_API void SimdBgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+    uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::BgraToNv21(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgraToNv21(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgraToNv21(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
+    else
+#endif
+        Base::BgraToNv21(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
+}
+
 SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -1192,37 +1335,41 @@ SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t
 
 SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
 {
+    ParallelRows(width, height, 0, 1, gray, grayStride, width, [&](size_t y, size_t h, uint8_t * d, size_t ds)
+    {
+        const uint8_t * s = bgr + y * bgrStride;
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable)
-        Avx512bw::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        if (Avx512bw::Enable)
+            Avx512bw::BgrToGray(s, width, h, bgrStride, d, ds);
+        else
 #endif
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        if(Avx2::Enable && width >= Avx2::A)
+            Avx2::BgrToGray(s, width, h, bgrStride, d, ds);
+        else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width >= Ssse3::A)
-        Ssse3::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        if(Ssse3::Enable && width >= Ssse3::A)
+            Ssse3::BgrToGray(s, width, h, bgrStride, d, ds);
+        else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width >= Sse2::A)
-        Sse2::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        if(Sse2::Enable && width >= Sse2::A)
+            Sse2::BgrToGray(s, width, h, bgrStride, d, ds);
+        else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        if(Vmx::Enable && width >= Vmx::A)
+            Vmx::BgrToGray(s, width, h, bgrStride, d, ds);
+        else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::A)
-        Neon::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
-    else
+        if (Neon::Enable && width >= Neon::A)
+            Neon::BgrToGray(s, width, h, bgrStride, d, ds);
+        else
 #endif
-        Base::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
+            Base::BgrToGray(s, width, h, bgrStride, d, ds);
+    });
 }
 
 SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
@@ -1350,6 +1497,69 @@ SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height,
         Base::BgrToYuv444p(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride);
 }
 
+SIMD_API void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+    uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::BgrToYuv420pV2(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
+SIMD_API void SimdBgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+    uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::BgrToNv12(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToNv12(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToNv12(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+        Base::BgrToNv12(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
+}
+
+SIMD_API void SimdBgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+    uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::BgrToNv21(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::BgrToNv21(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::BgrToNv21(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
+    else
+#endif
+        Base::BgrToNv21(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
+}
+
 SIMD_API void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                   uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType)
 {
@@ -1728,6 +1938,16 @@ SIMD_API void * SimdDetectionLoadA(const char * path)
     return Base::DetectionLoadA(path);
 }
 
+SIMD_API size_t SimdDetectionSaveBinary(const void * data, uint8_t * dst, size_t size)
+{
+    return Base::DetectionSaveBinary(data, dst, size);
+}
+
+SIMD_API void * SimdDetectionLoadBinary(const uint8_t * src, size_t size)
+{
+    return Base::DetectionLoadBinary(src, size);
+}
+
 SIMD_API void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags)
 {
     Base::DetectionInfo(data, width, height, flags);
@@ -2242,6 +2462,41 @@ SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * ds
         Base::Float16ToFloat32(src, size, dst);
 }
 
+SIMD_API void SimdFloat32ToBFloat16(const float * src, size_t size, uint16_t * dst)
+{
+#ifdef SIMD_AVX512BF16_ENABLE
+    if (Avx512bf16::Enable)
+        Avx512bf16::Float32ToBFloat16(src, size, dst);
+    else
+#endif
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Float32ToBFloat16(src, size, dst);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && size >= Avx2::F)
+        Avx2::Float32ToBFloat16(src, size, dst);
+    else
+#endif
+        Base::Float32ToBFloat16(src, size, dst);
+}
+
+SIMD_API void SimdBFloat16ToFloat32(const uint16_t * src, size_t size, float * dst)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::BFloat16ToFloat32(src, size, dst);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && size >= Avx2::F)
+        Avx2::BFloat16ToFloat32(src, size, dst);
+    else
+#endif
+        Base::BFloat16ToFloat32(src, size, dst);
+}
+
 SIMD_API void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -2360,40 +2615,64 @@ SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t siz
     simdCosineDistance32f(a, b, size, distance);
 }
 
-SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
-                     size_t channelCount, uint8_t * dst, size_t dstStride)
+SIMD_API void * SimdDistancesInit(size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance, const void * const * B, const float * bScales)
 {
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx512bw::Enable)
+        return Avx512bw::DistancesInit(N, K, type, distance, B, bScales);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    if (Avx2::Enable)
+        return Avx2::DistancesInit(N, K, type, distance, B, bScales);
     else
+#endif
+        return Base::DistancesInit(N, K, type, distance, B, bScales);
+}
+
+SIMD_API void SimdDistancesTopK(const void * context, size_t M, const void * const * A, const float * aScales, size_t top, float * distances, size_t * indices)
+{
+    ((const Base::Distances*)context)->TopK(M, A, aScales, top, distances, indices);
+}
+
+SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+                     size_t channelCount, uint8_t * dst, size_t dstStride)
+{
+    ParallelRows(width, height, 1, 1, dst, dstStride, width * channelCount, [&](size_t y, size_t h, uint8_t * d, size_t ds)
+    {
+        const uint8_t * s = src + y * srcStride;
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
+            Avx512bw::GaussianBlur3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+        if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
+            Avx2::GaussianBlur3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && (width - 1)*channelCount >= Ssse3::A)
-        Ssse3::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if(Ssse3::Enable && (width - 1)*channelCount >= Ssse3::A)
+            Ssse3::GaussianBlur3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
+            Sse2::GaussianBlur3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
+            Vmx::GaussianBlur3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
+            Neon::GaussianBlur3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
-        Base::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+            Base::GaussianBlur3x3(s, srcStride, width, h, channelCount, d, ds);
+    });
 }
 
 SIMD_API void* SimdGaussianBlurInit(size_t width, size_t height, size_t channels, const float* radius)
@@ -3348,62 +3627,70 @@ SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, si
 
 SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    ParallelRows(width, height, 1, 1, dst, dstStride, width * channelCount, [&](size_t y, size_t h, uint8_t * d, size_t ds)
+    {
+        const uint8_t * s = src + y * srcStride;
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if (Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
+            Avx512bw::MedianFilterSquare3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
-        Avx2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
+            Avx2::MedianFilterSquare3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
-        Sse2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if(Sse2::Enable && (width - 1)*channelCount >= Sse2::A)
+            Sse2::MedianFilterSquare3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
-        Vmx::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if(Vmx::Enable && (width - 1)*channelCount >= Vmx::A)
+            Vmx::MedianFilterSquare3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
-        Neon::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if (Neon::Enable && (width - 1)*channelCount >= Neon::A)
+            Neon::MedianFilterSquare3x3(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
-        Base::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+            Base::MedianFilterSquare3x3(s, srcStride, width, h, channelCount, d, ds);
+    });
 }
 
 SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    ParallelRows(width, height, 2, 1, dst, dstStride, width * channelCount, [&](size_t y, size_t h, uint8_t * d, size_t ds)
+    {
+        const uint8_t * s = src + y * srcStride;
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
-        Avx512bw::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if (Avx512bw::Enable && (width - 2)*channelCount >= Avx512bw::A)
+            Avx512bw::MedianFilterSquare5x5(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
-        Avx2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
+            Avx2::MedianFilterSquare5x5(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
-        Sse2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if(Sse2::Enable && (width - 2)*channelCount >= Sse2::A)
+            Sse2::MedianFilterSquare5x5(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
-        Vmx::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if(Vmx::Enable && (width - 2)*channelCount >= Vmx::A)
+            Vmx::MedianFilterSquare5x5(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
-        Neon::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
-    else
+        if (Neon::Enable && (width - 2)*channelCount >= Neon::A)
+            Neon::MedianFilterSquare5x5(s, srcStride, width, h, channelCount, d, ds);
+        else
 #endif
-        Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
+            Base::MedianFilterSquare5x5(s, srcStride, width, h, channelCount, d, ds);
+    });
 }
 
 SIMD_API void SimdNeuralConvert(const uint8_t * src, size_t srcStride, size_t width, size_t height, float * dst, size_t dstStride, int inversion)
@@ -3919,8 +4206,134 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
-SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
-               size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
+SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Nv21ToBgr(y, yStride, vu, vuStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv21ToBgra(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Nv21ToRgb(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Nv21ToRgb(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Nv21ToRgb(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Nv21ToRgb(y, yStride, vu, vuStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+               size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
 {
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
@@ -4369,9 +4782,21 @@ SIMD_API void * SimdResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t ds
 
 SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
 {
+    // It isn't split with ParallelRows: resizers keep their row buffers in the context and reuse rows between output rows.
     ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
 }
 
+SIMD_API void SimdCropAndResize(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, SimdResizeChannelType type,
+    const SimdResizeRoi * rois, size_t count, size_t dstWidth, size_t dstHeight, SimdResizeMethodType method)
+{
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && dstWidth * channels >= Avx2::F)
+        Avx2::CropAndResize(src, srcWidth, srcHeight, srcStride, channels, type, rois, count, dstWidth, dstHeight, method);
+    else
+#endif
+        Base::CropAndResize(src, srcWidth, srcHeight, srcStride, channels, type, rois, count, dstWidth, dstHeight, method);
+}
+
 SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -4422,6 +4847,69 @@ SIMD_API void SimdRgbToGray(const uint8_t* rgb, size_t width, size_t height, siz
         Base::RgbToGray(rgb, width, height, rgbStride, gray, grayStride);
 }
 
+SIMD_API void SimdRgbToYuv420pV2(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+    uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::RgbToYuv420pV2(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::RgbToYuv420pV2(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::RgbToYuv420pV2(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride, yuvType);
+    else
+#endif
+        Base::RgbToYuv420pV2(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride, yuvType);
+}
+
+SIMD_API void SimdRgbToNv12(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+    uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::RgbToNv12(rgb, width, height, rgbStride, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::RgbToNv12(rgb, width, height, rgbStride, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::RgbToNv12(rgb, width, height, rgbStride, y, yStride, uv, uvStride, yuvType);
+    else
+#endif
+        Base::RgbToNv12(rgb, width, height, rgbStride, y, yStride, uv, uvStride, yuvType);
+}
+
+SIMD_API void SimdRgbToNv21(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+    uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::RgbToNv21(rgb, width, height, rgbStride, y, yStride, vu, vuStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::RgbToNv21(rgb, width, height, rgbStride, y, yStride, vu, vuStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::RgbToNv21(rgb, width, height, rgbStride, y, yStride, vu, vuStride, yuvType);
+    else
+#endif
+        Base::RgbToNv21(rgb, width, height, rgbStride, y, yStride, vu, vuStride, yuvType);
+}
+
 SIMD_API void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex)
 {
 #ifdef SIMD_AVX512BW_ENABLE
@@ -4591,37 +5079,41 @@ SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t wi
 
 SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    ParallelRows(width, height, 1, 1, dst, dstStride, width * 2, [&](size_t y, size_t h, uint8_t * d, size_t ds)
+    {
+        const uint8_t * s = src + y * srcStride;
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        if (Avx512bw::Enable && width > Avx512bw::A)
+            Avx512bw::SobelDx(s, srcStride, width, h, d, ds);
+        else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        if(Avx2::Enable && width > Avx2::A)
+            Avx2::SobelDx(s, srcStride, width, h, d, ds);
+        else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        if(Ssse3::Enable && width > Ssse3::A)
+            Ssse3::SobelDx(s, srcStride, width, h, d, ds);
+        else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        if(Sse2::Enable && width > Sse2::A)
+            Sse2::SobelDx(s, srcStride, width, h, d, ds);
+        else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        if(Vmx::Enable && width > Vmx::A)
+            Vmx::SobelDx(s, srcStride, width, h, d, ds);
+        else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDx(src, srcStride, width, height, dst, dstStride);
-    else
+        if (Neon::Enable && width > Neon::A)
+            Neon::SobelDx(s, srcStride, width, h, d, ds);
+        else
 #endif
-        Base::SobelDx(src, srcStride, width, height, dst, dstStride);
+            Base::SobelDx(s, srcStride, width, h, d, ds);
+    });
 }
 
 SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
@@ -4686,37 +5178,41 @@ SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width
 
 SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    ParallelRows(width, height, 1, 1, dst, dstStride, width * 2, [&](size_t y, size_t h, uint8_t * d, size_t ds)
+    {
+        const uint8_t * s = src + y * srcStride;
 #ifdef SIMD_AVX512BW_ENABLE
-    if (Avx512bw::Enable && width > Avx512bw::A)
-        Avx512bw::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        if (Avx512bw::Enable && width > Avx512bw::A)
+            Avx512bw::SobelDy(s, srcStride, width, h, d, ds);
+        else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width > Avx2::A)
-        Avx2::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        if(Avx2::Enable && width > Avx2::A)
+            Avx2::SobelDy(s, srcStride, width, h, d, ds);
+        else
 #endif
 #ifdef SIMD_SSSE3_ENABLE
-    if(Ssse3::Enable && width > Ssse3::A)
-        Ssse3::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        if(Ssse3::Enable && width > Ssse3::A)
+            Ssse3::SobelDy(s, srcStride, width, h, d, ds);
+        else
 #endif
 #ifdef SIMD_SSE2_ENABLE
-    if(Sse2::Enable && width > Sse2::A)
-        Sse2::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        if(Sse2::Enable && width > Sse2::A)
+            Sse2::SobelDy(s, srcStride, width, h, d, ds);
+        else
 #endif
 #ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width > Vmx::A)
-        Vmx::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        if(Vmx::Enable && width > Vmx::A)
+            Vmx::SobelDy(s, srcStride, width, h, d, ds);
+        else
 #endif
 #ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width > Neon::A)
-        Neon::SobelDy(src, srcStride, width, height, dst, dstStride);
-    else
+        if (Neon::Enable && width > Neon::A)
+            Neon::SobelDy(s, srcStride, width, h, d, ds);
+        else
 #endif
-        Base::SobelDy(src, srcStride, width, height, dst, dstStride);
+            Base::SobelDy(s, srcStride, width, h, d, ds);
+    });
 }
 
 SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
@@ -4942,6 +5438,21 @@ SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, c
         Base::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
+SIMD_API void SimdSquaredDifferenceSums(const uint8_t * a, const uint8_t * b, size_t bStride, size_t size, size_t count, uint64_t * sums)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::SquaredDifferenceSums(a, b, bStride, size, count, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::SquaredDifferenceSums(a, b, bStride, size, count, sums);
+    else
+#endif
+        Base::SquaredDifferenceSums(a, b, bStride, size, count, sums);
+}
+
 SIMD_API void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum)
 {
     typedef void (* SimdSquaredDifferenceSum32fPtr) (const float * a, const float * b, size_t size, float * sum);
@@ -5313,6 +5824,26 @@ SIMD_API void SimdStretchGray2x2(const uint8_t *src, size_t srcWidth, size_t src
         Base::StretchGray2x2(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
+SIMD_API void * SimdStripFilterInit(size_t width, size_t height, size_t channels, SimdStripFilterType type, const float * radius)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return Avx512bw::StripFilterInit(width, height, channels, type, radius);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::StripFilterInit(width, height, channels, type, radius);
+    else
+#endif
+        return Base::StripFilterInit(width, height, channels, type, radius);
+}
+
+SIMD_API size_t SimdStripFilterRun(void * filter, const uint8_t * src, size_t srcStride, size_t rows, uint8_t * dst, size_t dstStride)
+{
+    return ((Base::StripFilter*)filter)->Run(src, srcStride, rows, dst, dstStride);
+}
+
 SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum)
 {
 #ifdef SIMD_AVX512F_ENABLE
@@ -5407,6 +5938,61 @@ SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src,
     c->Forward(src, buf, dst);
 }
 
+SIMD_API SimdBool SimdSynetConvolution32fReshape(void * context, size_t srcH, size_t srcW)
+{
+    return ((SynetConvolution32f*)context)->Reshape(srcH, srcW) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void SimdSynetSetTuning(SimdSynetTuningType tuning)
+{
+    Base::SetSynetTuning(tuning);
+}
+
+SIMD_API SimdSynetTuningType SimdSynetGetTuning()
+{
+    return Base::SynetTuning();
+}
+
+SIMD_API SimdBool SimdSynetLoadTuning(const char * path)
+{
+    return Base::SynetTuningLoad(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API SimdBool SimdSynetSaveTuning(const char * path)
+{
+    return Base::SynetTuningSave(path) ? SimdTrue : SimdFalse;
+}
+
+SIMD_API void* SimdSynetConvolution16bInit(size_t batch, const SimdConvolutionParameters* conv)
+{
+    typedef void* (*SimdSynetConvolution16bInitPtr) (size_t batch, const SimdConvolutionParameters* conv);
+    const static SimdSynetConvolution16bInitPtr simdSynetConvolution16bInit = SIMD_FUNC2(SynetConvolution16bInit, SIMD_AVX512BF16_FUNC, SIMD_AVX2_FUNC);
+
+    return simdSynetConvolution16bInit(batch, conv);
+}
+
+SIMD_API size_t SimdSynetConvolution16bExternalBufferSize(const void* context)
+{
+    return ((SynetConvolution16b*)context)->ExternalBufferSize();
+}
+
+SIMD_API size_t SimdSynetConvolution16bInternalBufferSize(const void* context)
+{
+    return ((SynetConvolution16b*)context)->InternalBufferSize();
+}
+
+SIMD_API void SimdSynetConvolution16bSetParams(void* context, const float* weight, const float* bias, const float* params)
+{
+    ((SynetConvolution16b*)context)->SetParams(weight, bias, params);
+}
+
+SIMD_API void SimdSynetConvolution16bForward(void* context, const uint8_t* src, uint8_t* buf, uint8_t* dst)
+{
+    SynetConvolution16b* c = (SynetConvolution16b*)context;
+    SIMD_PERF_EXT(c);
+    c->Forward(src, buf, dst);
+}
+
 SIMD_API void* SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
 {
     typedef void* (*SimdSynetConvolution8iInitPtr) (size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
@@ -5437,6 +6023,11 @@ SIMD_API void SimdSynetConvolution8iForward(void* context, const uint8_t* src, u
     c->Forward(src, buf, dst);
 }
 
+SIMD_API SimdBool SimdSynetConvolution8iReshape(void* context, size_t srcH, size_t srcW)
+{
+    return ((SynetConvolution8i*)context)->Reshape(srcH, srcW) ? SimdTrue : SimdFalse;
+}
+
 SIMD_API void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm)
 {
     typedef void* (*SimdSynetDeconvolution32fInitPtr) (size_t batch, const SimdConvolutionParameters * params, SimdGemm32fNNPtr gemm);
@@ -5766,6 +6357,23 @@ SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height
         Base::SynetSetInput(src, width, height, stride, srcFormat, lower, upper, dst, channels, dstFormat);
 }
 
+SIMD_API void * SimdSynetYuvToTensorInit(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH,
+    SimdPixelFormatType order, const float * mean, const float * scale, SimdTensorFormatType format)
+{
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::SynetYuvToTensorInit(srcW, srcH, layout, dstW, dstH, order, mean, scale, format);
+    else
+#endif
+        return Base::SynetYuvToTensorInit(srcW, srcH, layout, dstW, dstH, order, mean, scale, format);
+}
+
+SIMD_API void SimdSynetYuvToTensorRun(void * context, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride,
+    const uint8_t * v, size_t vStride, float * dst)
+{
+    ((Base::SynetYuvToTensor*)context)->Run(y, yStride, u, uStride, v, vStride, dst);
+}
+
 SIMD_API void SimdSynetShuffleLayerForward(const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type)
 {
     typedef void(*SimdSynetShuffleLayerForwardPtr) (const float* src0, const float* src1, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format, int type);
@@ -5969,6 +6577,46 @@ SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t w
         Base::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
 }
 
+SIMD_API void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return Avx512bw::WarpAffineInit(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::WarpAffineInit(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+    else
+#endif
+        return Base::WarpAffineInit(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+}
+
+SIMD_API void SimdWarpAffineRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    ((Warp*)context)->Run(src, srcStride, dst, dstStride);
+}
+
+SIMD_API void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        return Avx512bw::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        return Avx2::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+    else
+#endif
+        return Base::WarpPerspectiveInit(srcW, srcH, dstW, dstH, channels, mat, flags, border);
+}
+
+SIMD_API void SimdWarpPerspectiveRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride)
+{
+    ((Warp*)context)->Run(src, srcStride, dst, dstStride);
+}
+
 typedef void(*SimdWinogradSetFilterPtr) (const float * src, size_t size, float * dst, SimdBool trans);
 typedef void(*SimdWinogradSetInputPtr) (const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
 typedef void(*SimdWinogradSetOutputPtr) (const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
@@ -6127,6 +6775,28 @@ SIMD_API void SimdWinogradKernel3x3Block4x4SetOutput(const float * src, size_t s
     simdWinogradKernel3x3Block4x4SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
 }
 
+SIMD_API void SimdWinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans)
+{
+    const static SimdWinogradSetFilterPtr simdWinogradKernel3x3Block6x6SetFilter = SIMD_FUNC1(WinogradKernel3x3Block6x6SetFilter, SIMD_AVX512F_FUNC);
+
+    simdWinogradKernel3x3Block6x6SetFilter(src, size, dst, trans);
+}
+
+SIMD_API void SimdWinogradKernel3x3Block6x6SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
+    size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans)
+{
+    const static SimdWinogradSetInputPtr simdWinogradKernel3x3Block6x6SetInput = SIMD_FUNC1(WinogradKernel3x3Block6x6SetInput, SIMD_AVX512F_FUNC);
+
+    simdWinogradKernel3x3Block6x6SetInput(src, srcChannels, srcHeight, srcWidth, padY, padX, padH, padW, dst, dstStride, trans);
+}
+
+SIMD_API void SimdWinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans)
+{
+    const static SimdWinogradSetOutputPtr simdWinogradKernel3x3Block6x6SetOutput = SIMD_FUNC1(WinogradKernel3x3Block6x6SetOutput, SIMD_AVX512F_FUNC);
+
+    simdWinogradKernel3x3Block6x6SetOutput(src, srcStride, dst, dstChannels, dstHeight, dstWidth, trans);
+}
+
 SIMD_API void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
     const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride)
 {
@@ -6491,5 +7161,68 @@ SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t*
         Base::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
 }
 
+SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv420pToBgrV2(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdYuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+    size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::DA)
+        Avx2::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSSE3_ENABLE
+    if (Ssse3::Enable && width >= Ssse3::DA)
+        Ssse3::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+    else
+#endif
+        Base::Yuv420pToRgbV2(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, yuvType);
+}
+
 
 
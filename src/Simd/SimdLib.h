@@ -184,6 +184,7 @@ typedef enum
     SimdCpuInfoAvx512f, /*!< Availability of AVX-512F (x86). */
     SimdCpuInfoAvx512bw, /*!< Availability of AVX-512BW (x86). */
     SimdCpuInfoAvx512vnni, /*!< Availability of AVX-512VNNI (x86). */
+    SimdCpuInfoAvx512bf16, /*!< Availability of AVX-512BF16 (x86). */
     SimdCpuInfoVmx, /*!< Availability of VMX or Altivec (PowerPC). */
     SimdCpuInfoVsx, /*!< Availability of VSX (PowerPC). */
     SimdCpuInfoNeon, /*!< Availability of NEON (ARM). */
@@ -207,6 +208,17 @@ typedef enum
     SimdDetectionInfoCanInt16 = 8,
 } SimdDetectionInfoFlags;
 
+/*! @ingroup correlation
+    Describes type of distance used in function ::SimdDistancesInit.
+*/
+typedef enum
+{
+    /*! Cosine distance: 1 - Sum(a[k]*b[k])/Sqrt(Sum(a[k]*a[k])*Sum(b[k]*b[k])). */
+    SimdDistanceCosine,
+    /*! Squared Euclidean distance: Sum((a[k] - b[k])*(a[k] - b[k])). */
+    SimdDistanceSquaredL2,
+} SimdDistanceType;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary8u.
     Images must have the same format (unsigned 8-bit integer for every channel).
@@ -319,8 +331,65 @@ typedef enum
     SimdResizeMethodArea,
     /*! InferenceEngine::Extension::Cpu::Interp compatible method. */
     SimdResizeMethodInferenceEngineInterp,
+    /*! Bicubic method (cubic convolution with a = -0.5). The kernel is widened at downscaling. */
+    SimdResizeMethodBicubic,
+    /*! Lanczos method with 3 lobes. The kernel is widened at downscaling. */
+    SimdResizeMethodLanczos3,
 } SimdResizeMethodType;
 
+/*! @ingroup other_filter
+    Describes type of image filter used in strip (row-by-row) processing mode (see function ::SimdStripFilterInit).
+*/
+typedef enum
+{
+    SimdStripFilterGaussianBlur3x3, /*!< 3x3 Gaussian blur (see ::SimdGaussianBlur3x3). */
+    SimdStripFilterGaussianBlur, /*!< Gaussian blur with given radius (see ::SimdGaussianBlurInit). */
+    SimdStripFilterMedianSquare3x3, /*!< 3x3 median filter (see ::SimdMedianFilterSquare3x3). */
+    SimdStripFilterMedianSquare5x5, /*!< 5x5 median filter (see ::SimdMedianFilterSquare5x5). */
+    SimdStripFilterSobelDx, /*!< Sobel's filter along x axis (see ::SimdSobelDx). Output is 16-bit signed integer. */
+    SimdStripFilterSobelDxAbs, /*!< Absolute value of Sobel's filter along x axis (see ::SimdSobelDxAbs). Output is 16-bit integer. */
+    SimdStripFilterSobelDy, /*!< Sobel's filter along y axis (see ::SimdSobelDy). Output is 16-bit signed integer. */
+    SimdStripFilterSobelDyAbs, /*!< Absolute value of Sobel's filter along y axis (see ::SimdSobelDyAbs). Output is 16-bit integer. */
+    SimdStripFilterLaplace, /*!< Laplace's filter (see ::SimdLaplace). Output is 16-bit signed integer. */
+    SimdStripFilterLaplaceAbs, /*!< Absolute value of Laplace's filter (see ::SimdLaplaceAbs). Output is 16-bit integer. */
+} SimdStripFilterType;
+
+/*! @ingroup resizing
+    Describes a region of interest and its output image for function ::SimdCropAndResize.
+*/
+typedef struct SimdResizeRoi
+{
+    /*!
+        A left edge of the region in the input image (it can be fractional).
+    */
+    float left;
+    /*!
+        A top edge of the region in the input image (it can be fractional).
+    */
+    float top;
+    /*!
+        A right edge of the region in the input image (it can be fractional).
+    */
+    float right;
+    /*!
+        A bottom edge of the region in the input image (it can be fractional).
+    */
+    float bottom;
+    /*!
+        An optional 2x3 affine matrix (can be NULL). If it is not NULL the region edges are ignored and 
+        an output pixel (x, y) is sampled from input point (m[0]*x + m[1]*y + m[2], m[3]*x + m[4]*y + m[5]).
+    */
+    const float * affine;
+    /*!
+        A pointer to pixels data of the output image.
+    */
+    uint8_t * dst;
+    /*!
+        A row size (in bytes) of the output image.
+    */
+    size_t dstStride;
+} SimdResizeRoi;
+
 /*! @ingroup synet
     Describes Synet compatibility flags. This type used in functions ::SimdSynetScaleLayerForward, ::SimdSynetConvert32fTo8u, 
     ::SimdSynetConvolution8iInit, and ::SimdSynetMergedConvolution8iInit.
@@ -349,6 +418,16 @@ typedef enum
     SimdSynetEltwiseOperationMin, /*!< Minimum. */
 } SimdSynetEltwiseOperationType;
 
+/*! @ingroup synet
+    Describes mode of automatic selection of Synet algorithms. It is used in functions ::SimdSynetSetTuning and ::SimdSynetGetTuning.
+*/
+typedef enum
+{
+    SimdSynetTuningNone, /*!< Algorithm is selected by built-in heuristics (default mode). */
+    SimdSynetTuningCached, /*!< Algorithm is taken from tuning cache (see ::SimdSynetLoadTuning). Built-in heuristics are used for unknown parameters. */
+    SimdSynetTuningBenchmark, /*!< Algorithm is taken from tuning cache. For unknown parameters all suitable candidates are benchmarked during initialization and the winner is added to the cache. */
+} SimdSynetTuningType;
+
 /*! @ingroup synet
     Describes operation type used in function ::SimdSynetUnaryOperation32fLayerForward.
 */
@@ -392,6 +471,28 @@ typedef enum
     SimdTensorFormatOyxiXo, /*!< Unspecified hardware optimized 5D-tensor format of 2D-convolution filter. Specific format (::SimdTensorFormatOyxi4o, ::SimdTensorFormatOyxi8o or ::SimdTensorFormatOyxi16o) is determinated by function ::SimdSynetSpecifyTensorFormat. */
 } SimdTensorFormatType;
 
+/*! @ingroup yuv_conversion
+    Describes standard and range of YUV color space. This type is used in functions ::SimdYuv420pToBgrV2, ::SimdNv12ToBgr, ::SimdBgrToNv12 and others.
+*/
+typedef enum
+{
+    SimdYuvBt601, /*!< ITU-R BT.601 (SDTV) with limited range: Y in [16..235], U and V in [16..240]. It is used in functions without ::SimdYuvType parameter. */
+    SimdYuvBt709, /*!< ITU-R BT.709 (HDTV) with limited range: Y in [16..235], U and V in [16..240]. */
+    SimdYuvBt2020, /*!< ITU-R BT.2020 (UHDTV) with limited range: Y in [16..235], U and V in [16..240]. */
+    SimdYuvBt601Full, /*!< ITU-R BT.601 with full range: Y, U and V in [0..255] (JPEG). */
+    SimdYuvBt709Full, /*!< ITU-R BT.709 with full range: Y, U and V in [0..255]. */
+    SimdYuvBt2020Full, /*!< ITU-R BT.2020 with full range: Y, U and V in [0..255]. */
+} SimdYuvType;
+
+/*! @ingroup synet_conversion
+    Describes planes layout of input YUV 4:2:0 image. This type used in function ::SimdSynetYuvToTensorInit.
+*/
+typedef enum
+{
+    SimdYuvLayout420p, /*!< Three planes: Y, U and V. U and V planes have half width and half height of Y plane. */
+    SimdYuvLayoutNv12, /*!< Two planes: Y and interleaved UV. UV plane has half height of Y plane. */
+} SimdYuvLayoutType;
+
 /*! @ingroup synet
     Describes <a href="http://github.com/ermig1979/Synet">Synet Framework</a> tensor data type.
 */
@@ -402,6 +503,8 @@ typedef enum
     SimdTensorData32i, /*!< 32-bit signed integer. */
     SimdTensorData8i, /*!< 8-bit signed integer. */
     SimdTensorData8u, /*!< 8-bit unsigned integer. */
+    SimdTensorData16b, /*!< 16-bit brain float point (BFloat16). */
+    SimdTensorData16f, /*!< 16-bit (half precision) float point. */
 } SimdTensorDataType;
 
 /*! @ingroup transform
@@ -419,6 +522,27 @@ typedef enum
     SimdTransformTransposeRotate270, /*!< Image transposed and rotated 270 degrees counterclockwise. It is equal to vertical mirroring of image. The output image has the same size as input image.*/
 } SimdTransformType;
 
+/*! @ingroup transform
+    Describes interpolation and border modes of image warping (see ::SimdWarpAffineInit and ::SimdWarpPerspectiveInit).
+*/
+typedef enum
+{
+    /*! A bit mask of interpolation type. */
+    SimdWarpInterpMask = 1,
+    /*! Nearest pixel interpolation. */
+    SimdWarpInterpNearest = 0,
+    /*! Bilinear interpolation. */
+    SimdWarpInterpBilinear = 1,
+    /*! A bit mask of border mode. */
+    SimdWarpBorderMask = 6,
+    /*! The pixels outside of the input image are filled by border value. */
+    SimdWarpBorderConstant = 0,
+    /*! The output pixels mapped outside of the input image are not changed. */
+    SimdWarpBorderTransparent = 2,
+    /*! The pixels outside of the input image are replicated from its border. */
+    SimdWarpBorderReplicate = 4,
+} SimdWarpFlags;
+
 /*! @ingroup synet
     \brief Callback function type "SimdGemm32fNNPtr";
 
@@ -595,6 +719,7 @@ extern "C"
             std::cout << "AVX-512F: " << (SimdCpuInfo(SimdCpuInfoAvx512f) ? "Yes" : "No") << std::endl;
             std::cout << "AVX-512BW: " << (SimdCpuInfo(SimdCpuInfoAvx512bw) ? "Yes" : "No") << std::endl;
             std::cout << "AVX-512VNNI: " << (SimdCpuInfo(SimdCpuInfoAvx512vnni) ? "Yes" : "No") << std::endl;
+            std::cout << "AVX-512BF16: " << (SimdCpuInfo(SimdCpuInfoAvx512bf16) ? "Yes" : "No") << std::endl;
             std::cout << "PowerPC-Altivec: " << (SimdCpuInfo(SimdCpuInfoVmx) ? "Yes" : "No") << std::endl;
             std::cout << "PowerPC-VSX: " << (SimdCpuInfo(SimdCpuInfoVsx) ? "Yes" : "No") << std::endl;
             std::cout << "ARM-NEON: " << (SimdCpuInfo(SimdCpuInfoNeon) ? "Yes" : "No") << std::endl;
@@ -697,10 +822,72 @@ extern "C"
 
         \short Sets number of threads used by Simd Library to parallelize some algorithms.
 
+        \note The library keeps a persistent pool of work threads. This function also resizes this pool.
+            The pool is not resized if this function is called from a task executed by the pool.
+
         \param [in] threadNumber - a number of threads.
     */
     SIMD_API void SimdSetThreadNumber(size_t threadNumber);
 
+    /*! @ingroup thread
+
+        \fn size_t SimdGetThreadThreshold();
+
+        \short Gets minimal image size (in pixels) starting from which row-parallel image processing functions use several threads.
+
+        \return current threshold.
+    */
+    SIMD_API size_t SimdGetThreadThreshold();
+
+    /*! @ingroup thread
+
+        \fn void SimdSetThreadThreshold(size_t pixels);
+
+        \short Sets minimal image size (in pixels) starting from which row-parallel image processing functions use several threads.
+
+        Smaller images are processed in the calling thread in order to keep their latency. The default value is 1048576 (1 megapixel).
+        It affects functions ::SimdBgrToGray, ::SimdBgraToGray, ::SimdBayerToBgr, ::SimdBayerToBgra, ::SimdGaussianBlur3x3,
+        ::SimdMedianFilterSquare3x3, ::SimdMedianFilterSquare5x5, ::SimdSobelDx and ::SimdSobelDy.
+
+        \param [in] pixels - a threshold (in pixels).
+    */
+    SIMD_API void SimdSetThreadThreshold(size_t pixels);
+
+    /*! @ingroup thread
+
+        \fn SimdBool SimdSetThreadAffinity(const size_t * cpus, size_t size);
+
+        \short Binds work threads of Simd Library to given logical CPUs.
+
+        Work thread with index i (i = 1, 2, ...) is bound to logical CPU cpus[i % size]. 
+        The calling thread (it has index 0) is not changed, so it has to be bound by user. 
+        Per-thread scratch buffers are touched at first by their work threads, so they are allocated on a local NUMA node.
+        Internal buffers of Synet contexts (used if an external buffer is not given) are not initialized at allocation, 
+        so their pages are touched at first by the work threads which process corresponding parts of the output.
+
+        \note Every CPU must belong to the affinity mask of the calling thread (on Linux), otherwise the function fails.
+            Thread affinity is supported only for Windows and Linux.
+            On Windows logical CPUs of all processor groups are numbered sequentially, a work thread is bound to CPUs of one processor group only.
+
+        \param [in] cpus - an array with indices of logical CPUs. Can be NULL if size is 0.
+        \param [in] size - a size of the array. Use 0 to reset the binding.
+        \return a result of this operation.
+    */
+    SIMD_API SimdBool SimdSetThreadAffinity(const size_t * cpus, size_t size);
+
+    /*! @ingroup thread
+
+        \fn SimdBool SimdSetThreadNumaNode(size_t node);
+
+        \short Binds work threads of Simd Library to all logical CPUs of given NUMA node.
+
+        \note CPUs of the node which do not belong to the affinity mask of the calling thread are skipped. See also function ::SimdSetThreadAffinity.
+
+        \param [in] node - an index of NUMA node.
+        \return a result of this operation. It is false if the NUMA node does not exist or has no allowed CPUs.
+    */
+    SIMD_API SimdBool SimdSetThreadNumaNode(size_t node);
+
     /*! @ingroup cpu_flags
 
         \fn SimdBool SimdGetFastMode();
@@ -1330,6 +1517,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BayerToBgr(const View<A>& bayer, View<A>& bgr).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadThreshold).
+
         \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1350,6 +1539,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BayerToBgra(const View<A>& bayer, View<A>& bgra, uint8_t alpha).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadThreshold).
+
         \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1410,6 +1601,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BgraToGray(const View<A>& bgra, View<A>& gray).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadThreshold).
+
         \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1536,6 +1729,74 @@ extern "C"
     SIMD_API void SimdBgraToYuva420p(const uint8_t * bgra, size_t bgraStride, size_t width, size_t height, 
         uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, uint8_t * a, size_t aStride);
 
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to YUV420P with given YUV standard and range.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output U and V images must have the same width and height (half size relative to Y component).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride,
+        uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to NV12 with given YUV standard and range.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output UV image contains interleaved U and V components and has half height of Y component (its width in pixels is equal to half width of Y component).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride,
+        uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+    /*! @ingroup bgra_conversion
+
+        \fn void SimdBgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType);
+
+        \short Converts 32-bit BGRA image to NV21 with given YUV standard and range.
+
+        The input BGRA and output Y images must have the same width and height.
+        The output VU image contains interleaved V and U components and has half height of Y component (its width in pixels is equal to half width of Y component).
+
+        \param [in] bgra - a pointer to pixels data of input 32-bit BGRA image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] vu - a pointer to pixels data of output 16-bit image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride,
+        uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat);
@@ -1611,6 +1872,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BgrToGray(const View<A>& bgr, View<A>& gray).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadThreshold).
+
         \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1748,6 +2011,74 @@ extern "C"
     */
     SIMD_API void SimdBgrToYuv444p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to YUV420P with given YUV standard and range.
+
+        The input BGR and output Y images must have the same width and height.
+        The output U and V images must have the same width and height (half size relative to Y component).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride,
+        uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to NV12 with given YUV standard and range.
+
+        The input BGR and output Y images must have the same width and height.
+        The output UV image contains interleaved U and V components and has half height of Y component (its width in pixels is equal to half width of Y component).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride,
+        uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit BGR image to NV21 with given YUV standard and range.
+
+        The input BGR and output Y images must have the same width and height.
+        The output VU image contains interleaved V and U components and has half height of Y component (its width in pixels is equal to half width of Y component).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] vu - a pointer to pixels data of output 16-bit image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdBgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride,
+        uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType);
+
     /*! @ingroup binarization
 
         \fn void SimdBinarization(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t value, uint8_t positive, uint8_t negative, uint8_t * dst, size_t dstStride, SimdCompareType compareType);
@@ -2193,6 +2524,40 @@ extern "C"
     */
     SIMD_API void * SimdDetectionLoadStringXml(char * xml);
 
+    /*! @ingroup object_detection
+
+        \fn size_t SimdDetectionSaveBinary(const void * data, uint8_t * dst, size_t size);
+
+        \short Saves a classifier cascade in compact binary format.
+
+        The binary format stores already parsed cascade in a versioned layout which can be used in place by function ::SimdDetectionLoadBinary.
+        It is intended to avoid XML parsing at application startup. The format depends on platform (byte order and structure alignment).
+
+        \param [in] data - a pointer to cascade which was received with using of functions ::SimdDetectionLoadA, ::SimdDetectionLoadStringXml or ::SimdDetectionLoadBinary.
+        \param [out] dst - a pointer to output buffer. It can be NULL.
+        \param [in] size - a size of output buffer.
+        \return a size of binary cascade in bytes. If output buffer is NULL or too small then nothing is written.
+    */
+    SIMD_API size_t SimdDetectionSaveBinary(const void * data, uint8_t * dst, size_t size);
+
+    /*! @ingroup object_detection
+
+        \fn void * SimdDetectionLoadBinary(const uint8_t * src, size_t size);
+
+        \short Loads a classifier cascade from buffer in compact binary format.
+
+        The buffer (for example a memory-mapped file created by function ::SimdDetectionSaveBinary) is used in place without parsing and copying,
+        so read-only mapped pages can be shared between several processes.
+
+        \note The buffer must be aligned at least to 4 bytes and must stay valid until the returned cascade is released.
+
+        \param [in] src - a pointer to buffer with binary cascade.
+        \param [in] size - a size of the buffer.
+        \return a pointer to loaded cascade. On error (wrong format, version or platform) it returns NULL.
+                This pointer is used in functions ::SimdDetectionInfo and ::SimdDetectionInit, and must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdDetectionLoadBinary(const uint8_t * src, size_t size);
+
     /*! @ingroup object_detection
 
         \fn void SimdDetectionInfo(const void * data, size_t * width, size_t * height, SimdDetectionInfoFlags * flags);
@@ -2732,6 +3097,32 @@ extern "C"
     */
     SIMD_API void SimdFloat16ToFloat32(const uint16_t * src, size_t size, float * dst);
 
+    /*! @ingroup float16
+
+        \fn void SimdFloat32ToBFloat16(const float * src, size_t size, uint16_t * dst);
+
+        \short Converts numbers in the array from 32-bit float to 16-bit brain float (BFloat16) format.
+
+        The conversion uses rounding to nearest even.
+
+        \param [in] src - a pointer to the input array with 32-bit float point numbers.
+        \param [in] size - a size of input and output array.
+        \param [out] dst - a pointer to the output array with 16-bit brain float point numbers.
+    */
+    SIMD_API void SimdFloat32ToBFloat16(const float * src, size_t size, uint16_t * dst);
+
+    /*! @ingroup float16
+
+        \fn void SimdBFloat16ToFloat32(const uint16_t * src, size_t size, float * dst);
+
+        \short Converts numbers in the array from 16-bit brain float (BFloat16) to 32-bit float format.
+
+        \param [in] src - a pointer to the input array with 16-bit brain float point numbers.
+        \param [in] size - a size of input and output array.
+        \param [out] dst - a pointer to the output array with 32-bit float point numbers.
+    */
+    SIMD_API void SimdBFloat16ToFloat32(const uint16_t * src, size_t size, float * dst);
+
     /*! @ingroup float16
 
         \fn void SimdSquaredDifferenceSum16f(const uint16_t * a, const uint16_t * b, size_t size, float * sum);
@@ -2850,6 +3241,47 @@ extern "C"
     */
     SIMD_API void SimdCosineDistance32f(const float * a, const float * b, size_t size, float * distance);
 
+    /*! @ingroup correlation
+
+        \fn void * SimdDistancesInit(size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance, const void * const * B, const float * bScales);
+
+        \short Initializes context for search of nearest vectors in the gallery of N vectors.
+
+        The context precomputes norms of the gallery vectors. The gallery itself is not copied, so its vectors have to be valid until the context is released.
+        Search is performed by function ::SimdDistancesTopK.
+
+        \param [in] N - a number of vectors in the gallery.
+        \param [in] K - a size of vectors.
+        \param [in] type - a type of vector elements. It can be ::SimdTensorData32f, ::SimdTensorData16f or ::SimdTensorData8i.
+        \param [in] distance - a type of distance (see ::SimdDistanceType).
+        \param [in] B - a pointer to the array with pointers to the gallery vectors.
+        \param [in] bScales - a pointer to the array with (positive) scales of the gallery vectors (a real vector is equal to B[j][k]*bScales[j]).
+                It is used for quantized (::SimdTensorData8i) vectors and can be NULL (all scales are equal to 1).
+        \return a pointer to distances context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdDistancesInit(size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance, const void * const * B, const float * bScales);
+
+    /*! @ingroup correlation
+
+        \fn void SimdDistancesTopK(const void * context, size_t M, const void * const * A, const float * aScales, size_t top, float * distances, size_t * indices);
+
+        \short Finds top nearest gallery vectors for every of M query vectors.
+
+        The distances are computed by blocks (query block by gallery block), and top selection is fused with computation, so M*N matrix of distances is never created.
+        The gallery is split between threads (see ::SimdSetThreadNumber). For 8-bit integer vectors K must be less than 131072.
+
+        \param [in] context - a distances context. It must be created by function ::SimdDistancesInit and released by function ::SimdRelease.
+        \param [in] M - a number of query vectors.
+        \param [in] A - a pointer to the array with pointers to the query vectors. They must have the same type and size as the gallery vectors.
+        \param [in] aScales - a pointer to the array with (positive) scales of the query vectors. Can be NULL (all scales are equal to 1).
+        \param [in] top - a number of nearest vectors to find for every query.
+        \param [out] distances - a pointer to the output array with distances. Its size must be M*top. Distances of every query are sorted in ascending order.
+                If the gallery has less than top vectors then remaining values are equal to FLT_MAX.
+        \param [out] indices - a pointer to the output array with indices of found gallery vectors. Its size must be M*top.
+                Vectors with equal distances are ordered by index. If the gallery has less than top vectors then remaining values are equal to -1.
+    */
+    SIMD_API void SimdDistancesTopK(const void * context, size_t M, const void * const * A, const float * aScales, size_t top, float * distances, size_t * indices);
+
     /*! @ingroup gaussian_filter
 
         \fn void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride);
@@ -2867,6 +3299,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::GaussianBlur3x3(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadThreshold).
+
         \param [in] src - a pointer to pixels data of source image.
         \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
@@ -3853,6 +4287,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::MedianFilterSquare3x3(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadThreshold).
+
         \param [in] src - a pointer to pixels data of original input image.
         \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
@@ -3874,6 +4310,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::MedianFilterSquare5x5(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadThreshold).
+
         \param [in] src - a pointer to pixels data of original input image.
         \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
@@ -4864,6 +5302,10 @@ extern "C"
 
         \short Performs image resizing.
 
+        \note This function is executed in the calling thread. The resize context keeps intermediate row buffers and reuses
+            interpolated rows of previous output row, so one context can't be shared between threads. 
+            In order to process several images in parallel use a separate context for each thread.
+
         \param [in] resizer - a resize context. It must be created by function ::SimdResizerInit and released by function ::SimdRelease.
         \param [in] src - a pointer to pixels data of the original input image.
         \param [in] srcStride - a row size (in bytes) of the input image.
@@ -4872,6 +5314,33 @@ extern "C"
     */
     SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup resizing
+
+        \fn void SimdCropAndResize(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, SimdResizeChannelType type, const SimdResizeRoi * rois, size_t count, size_t dstWidth, size_t dstHeight, SimdResizeMethodType method);
+
+        \short Crops a batch of regions from the image and resizes each of them to the same size.
+
+        Region edges are in continuous coordinates (pixel i covers interval [i, i + 1)). The points outside of the input image are replicated from its border.
+        Bilinear interpolation uses only 2x2 nearest pixels, so it causes aliasing when a region is reduced more than twice. 
+        Area method averages all pixels covered by output pixel and should be used in this case. Affine regions are always resized with using of bilinear interpolation.
+
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in] channels - a channel number of input and output images.
+        \param [in] type - a type of input and output image channel.
+        \param [in] rois - a pointer to array of regions of interest (see ::SimdResizeRoi).
+        \param [in] count - a number of regions.
+        \param [in] dstWidth - a width of the output images.
+        \param [in] dstHeight - a height of the output images.
+        \param [in] method - a resize method. It can be ::SimdResizeMethodBilinear or ::SimdResizeMethodArea.
+    */
+    SIMD_API void SimdCropAndResize(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, SimdResizeChannelType type,
+        const SimdResizeRoi * rois, size_t count, size_t dstWidth, size_t dstHeight, SimdResizeMethodType method);
+
     /*! @ingroup rgb_conversion
 
         \fn void SimdRgbToBgra(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -4911,19 +5380,87 @@ extern "C"
     */
     SIMD_API void SimdRgbToGray(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* gray, size_t grayStride);
 
-    /*! @ingroup segmentation
+    /*! @ingroup rgb_conversion
 
-        \fn void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
+        \fn void SimdRgbToYuv420pV2(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
 
-        \short Changes certain index in mask.
+        \short Converts 24-bit RGB image to YUV420P with given YUV standard and range.
 
-        Mask must has 8-bit gray pixel format.
+        The input RGB and output Y images must have the same width and height.
+        The output U and V images must have the same width and height (half size relative to Y component).
 
-        For every point:
-        \verbatim
-        if(mask[i] == oldIndex)
-            mask[i] = newIndex;
-        \endverbatim
+        \param [in] rgb - a pointer to pixels data of input 24-bit RGB image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] u - a pointer to pixels data of output 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [out] v - a pointer to pixels data of output 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdRgbToYuv420pV2(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride,
+        uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+    /*! @ingroup rgb_conversion
+
+        \fn void SimdRgbToNv12(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit RGB image to NV12 with given YUV standard and range.
+
+        The input RGB and output Y images must have the same width and height.
+        The output UV image contains interleaved U and V components and has half height of Y component (its width in pixels is equal to half width of Y component).
+
+        \param [in] rgb - a pointer to pixels data of input 24-bit RGB image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] uv - a pointer to pixels data of output 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdRgbToNv12(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride,
+        uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+    /*! @ingroup rgb_conversion
+
+        \fn void SimdRgbToNv21(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType);
+
+        \short Converts 24-bit RGB image to NV21 with given YUV standard and range.
+
+        The input RGB and output Y images must have the same width and height.
+        The output VU image contains interleaved V and U components and has half height of Y component (its width in pixels is equal to half width of Y component).
+
+        \param [in] rgb - a pointer to pixels data of input 24-bit RGB image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [out] y - a pointer to pixels data of output 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [out] vu - a pointer to pixels data of output 16-bit image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] yuvType - a type of output YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdRgbToNv21(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride,
+        uint8_t * y, size_t yStride, uint8_t * vu, size_t vuStride, SimdYuvType yuvType);
+
+    /*! @ingroup segmentation
+
+        \fn void SimdSegmentationChangeIndex(uint8_t * mask, size_t stride, size_t width, size_t height, uint8_t oldIndex, uint8_t newIndex);
+
+        \short Changes certain index in mask.
+
+        Mask must has 8-bit gray pixel format.
+
+        For every point:
+        \verbatim
+        if(mask[i] == oldIndex)
+            mask[i] = newIndex;
+        \endverbatim
 
         \note This function has a C++ wrappers: Simd::SegmentationChangeIndex(View<A> & mask, uint8_t oldIndex, uint8_t newIndex).
 
@@ -5048,6 +5585,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::SobelDx(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadThreshold).
+
         \param [in] src - a pointer to pixels data of the input image.
         \param [in] srcStride - a row size of the input image.
         \param [in] width - an image width.
@@ -5119,6 +5658,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::SobelDy(const View<A>& src, View<A>& dst).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadThreshold).
+
         \param [in] src - a pointer to pixels data of the input image.
         \param [in] srcStride - a row size of the input image.
         \param [in] width - an image width.
@@ -5321,6 +5862,29 @@ extern "C"
     SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
         const uint8_t * mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
 
+    /*! @ingroup correlation
+
+        \fn void SimdSquaredDifferenceSums(const uint8_t * a, const uint8_t * b, size_t bStride, size_t size, size_t count, uint64_t * sums);
+
+        \short Calculates sums of squared differences between one vector and many vectors.
+
+        It is useful for fast search of similar vectors (for example image hashes) stored contiguously.
+        For every i from 0 to count:
+        \verbatim
+        sums[i] = 0;
+        for(j = 0; j < size; ++j)
+            sums[i] += (a[j] - b[i*bStride + j])*(a[j] - b[i*bStride + j]);
+        \endverbatim
+
+        \param [in] a - a pointer to the first vector.
+        \param [in] b - a pointer to the set of other vectors.
+        \param [in] bStride - a distance (in bytes) between vectors in the set.
+        \param [in] size - a size of vectors. It must be less than 65536.
+        \param [in] count - a number of vectors in the set.
+        \param [out] sums - a pointer to array of unsigned 64-bit integers with result sums. Its size must be equal to count.
+    */
+    SIMD_API void SimdSquaredDifferenceSums(const uint8_t * a, const uint8_t * b, size_t bStride, size_t size, size_t count, uint64_t * sums);
+
     /*! @ingroup correlation
 
         \fn void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum);
@@ -5661,6 +6225,43 @@ extern "C"
     SIMD_API void SimdStretchGray2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
         uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
 
+    /*! @ingroup other_filter
+
+        \fn void * SimdStripFilterInit(size_t width, size_t height, size_t channels, SimdStripFilterType type, const float * radius);
+
+        \short Creates context of image filter which works in strip (row-by-row) mode.
+
+        The context keeps the last input rows which are needed by filter kernel. So input image can be passed in strips of arbitrary height 
+        and output rows are returned as soon as all their input rows are received. Delay of output is equal to half of kernel height.
+        After the last row of the image the context is ready to process next image of the same size.
+
+        \param [in] width - a width of input and output image.
+        \param [in] height - a height of input and output image.
+        \param [in] channels - a channel number of input and output image. It must be 1 for Sobel's and Laplace's filters.
+        \param [in] type - a type of the filter (see ::SimdStripFilterType).
+        \param [in] radius - a pointer to radius of Gaussian blur. It is used only for ::SimdStripFilterGaussianBlur and can be NULL for other filters.
+        \return a pointer to filter context. On error it returns NULL.
+                This pointer is used in functions ::SimdStripFilterRun.
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdStripFilterInit(size_t width, size_t height, size_t channels, SimdStripFilterType type, const float * radius);
+
+    /*! @ingroup other_filter
+
+        \fn size_t SimdStripFilterRun(void * filter, const uint8_t * src, size_t srcStride, size_t rows, uint8_t * dst, size_t dstStride);
+
+        \short Passes next strip of input image to the filter and gets available output rows.
+
+        \param [in, out] filter - a filter context. It must be created by function ::SimdStripFilterInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the next strip of input image.
+        \param [in] srcStride - a row size (in bytes) of the input strip.
+        \param [in] rows - a number of rows in the input strip. Total number of rows must not exceed image height.
+        \param [out] dst - a pointer to output buffer. It must have space for (rows + 2) rows (or for (rows + radius*2.7) rows for Gaussian blur).
+        \param [in] dstStride - a row size (in bytes) of the output buffer.
+        \return a number of output rows written to dst. They continue output image from the row following the previous call.
+    */
+    SIMD_API size_t SimdStripFilterRun(void * filter, const uint8_t * src, size_t srcStride, size_t rows, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup svm
 
         \fn void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum);
@@ -5800,7 +6401,7 @@ extern "C"
         \param [in] conv - a pointer to convolution parameters.
         \param [in] gemm - a pointer to external function of matrix multiplication. Can be NULL.
         \return a pointer to FP32 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
-            This pointer is used in functions ::SimdSynetConvolution32fExternalBufferSize, ::SimdSynetConvolution32fInternalBufferSize, ::SimdSynetConvolution32fSetParams and ::SimdSynetConvolution32fForward.
+            This pointer is used in functions ::SimdSynetConvolution32fExternalBufferSize, ::SimdSynetConvolution32fInternalBufferSize, ::SimdSynetConvolution32fSetParams, ::SimdSynetConvolution32fForward and ::SimdSynetConvolution32fReshape.
     */
     SIMD_API void * SimdSynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
 
@@ -5853,6 +6454,135 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdSynetConvolution32fReshape(void * context, size_t srcH, size_t srcW);
+
+        \short Changes spatial size of input tensor of FP32 convolution algorithm without its reinitialization.
+
+        Reordered weights are kept, only blocking parameters of the algorithm are recalculated. Output size is derived from new input size and parameters of convolution.
+        Size of external temporary buffer can be changed after successful call, so it must be requested again with using of function ::SimdSynetConvolution32fExternalBufferSize.
+        Reshape is supported by GEMM NN, Winograd, NHWC direct (both implementations) and sparse algorithms. Winograd fails if new size is too small for its block size.
+
+        \param [in, out] context - a pointer to FP32 convolution context. It must be created by function ::SimdSynetConvolution32fInit and released by function ::SimdRelease.
+        \param [in] srcH - a new height of input tensor.
+        \param [in] srcW - a new width of input tensor.
+        \return result of operation. If it is equal to ::SimdFalse then the context is unchanged and it has to be recreated with using of function ::SimdSynetConvolution32fInit.
+    */
+    SIMD_API SimdBool SimdSynetConvolution32fReshape(void * context, size_t srcH, size_t srcW);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn void SimdSynetSetTuning(SimdSynetTuningType tuning);
+
+        \short Sets mode of automatic algorithm selection used in function ::SimdSynetConvolution32fInit.
+
+        In mode ::SimdSynetTuningBenchmark every suitable FP32 convolution algorithm is benchmarked on synthetic data at initialization
+        (only once for given convolution parameters and instruction set) and the fastest one is chosen and stored in the tuning cache.
+        The cache can be saved with using of function ::SimdSynetSaveTuning and loaded at application startup with using of function ::SimdSynetLoadTuning.
+
+        \param [in] tuning - a mode of algorithm selection. By default it is equal to ::SimdSynetTuningNone.
+    */
+    SIMD_API void SimdSynetSetTuning(SimdSynetTuningType tuning);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdSynetTuningType SimdSynetGetTuning();
+
+        \short Gets current mode of automatic algorithm selection (see ::SimdSynetSetTuning).
+
+        \return current mode of algorithm selection.
+    */
+    SIMD_API SimdSynetTuningType SimdSynetGetTuning();
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdSynetLoadTuning(const char * path);
+
+        \short Loads tuning cache from text file. Loaded entries are merged with the current content of the cache.
+
+        \note The tuning cache is specific for given machine and version of the library.
+
+        \param [in] path - a path to tuning file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdSynetLoadTuning(const char * path);
+
+    /*! @ingroup synet_convolution_fp32
+
+        \fn SimdBool SimdSynetSaveTuning(const char * path);
+
+        \short Saves tuning cache to text file.
+
+        \param [in] path - a path to tuning file.
+        \return result of the operation.
+    */
+    SIMD_API SimdBool SimdSynetSaveTuning(const char * path);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn void * SimdSynetConvolution16bInit(size_t batch, const SimdConvolutionParameters * conv);
+
+        \short Initilizes BFloat16 convolution algorithm.
+
+        Input and output tensors must be in ::SimdTensorFormatNhwc format and have ::SimdTensorData32f or ::SimdTensorData16b type.
+        The weights are converted to BFloat16, the accumulation is performed in 32-bit float.
+
+        \param [in] batch - a batch size.
+        \param [in] conv - a pointer to convolution parameters.
+        \return a pointer to BFloat16 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetConvolution16bExternalBufferSize, ::SimdSynetConvolution16bInternalBufferSize, ::SimdSynetConvolution16bSetParams and ::SimdSynetConvolution16bForward.
+    */
+    SIMD_API void * SimdSynetConvolution16bInit(size_t batch, const SimdConvolutionParameters * conv);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn size_t SimdSynetConvolution16bExternalBufferSize(const void * context);
+
+        \short Gets size in bytes of external temporary buffer required for BFloat16 convolution algorithm.
+
+        \param [in] context - a pointer to BFloat16 convolution context. It must be created by function ::SimdSynetConvolution16bInit and released by function ::SimdRelease.
+        \return size of external temporary buffer required for BFloat16 convolution algorithm.
+    */
+    SIMD_API size_t SimdSynetConvolution16bExternalBufferSize(const void * context);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn size_t SimdSynetConvolution16bInternalBufferSize(const void * context);
+
+        \short Gets size of internal buffer used inside BFloat16 convolution algorithm.
+
+        \param [in] context - a pointer to BFloat16 convolution context. It must be created by function ::SimdSynetConvolution16bInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside BFloat16 convolution algorithm.
+    */
+    SIMD_API size_t SimdSynetConvolution16bInternalBufferSize(const void * context);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn void SimdSynetConvolution16bSetParams(void * context, const float * weight, const float * bias, const float * params);
+
+        \short Sets weights, biases and parameters of activation function required for BFloat16 convolution algorithm.
+
+        \param [in, out] context - a pointer to BFloat16 convolution context. It must be created by function ::SimdSynetConvolution16bInit and released by function ::SimdRelease.
+        \param [in] weight - a pointer to original (32-bit float point) convolution weights.
+        \param [in] bias - a pointer to original (32-bit float point) bias. Can be NULL.
+        \param [in] params - a pointer to original (32-bit float point) parameters of activation functions (see ::SimdConvolutionActivationType). Can be NULL.
+    */
+    SIMD_API void SimdSynetConvolution16bSetParams(void * context, const float * weight, const float * bias, const float * params);
+
+    /*! @ingroup synet_convolution_bf16
+
+        \fn void SimdSynetConvolution16bForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
+
+        \short Performs forward propagation of BFloat16 convolution algorithm.
+
+        \param [in] context - a pointer to BFloat16 convolution context. It must be created by function ::SimdSynetConvolution16bInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to input tensor.
+        \param [out] buf - a pointer to external temporary buffer. The size of the external temporary buffer is determined by function ::SimdSynetConvolution16bExternalBufferSize. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to output tensor.
+    */
+    SIMD_API void SimdSynetConvolution16bForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
+
     /*! @ingroup synet_convolution_int8
 
         \fn void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
@@ -5863,7 +6593,7 @@ extern "C"
         \param [in] conv - a pointer to convolution parameters.
         \param [in] compatibility - a flags of bitwise compatibility.
         \return a pointer to INT8 convolution context. On error it returns NULL. It must be released with using of function ::SimdRelease.
-            This pointer is used in functions ::SimdSynetConvolution8iExternalBufferSize, ::SimdSynetConvolution8iInternalBufferSize, ::SimdSynetConvolution8iSetParams and ::SimdSynetConvolution8iForward.
+            This pointer is used in functions ::SimdSynetConvolution8iExternalBufferSize, ::SimdSynetConvolution8iInternalBufferSize, ::SimdSynetConvolution8iSetParams, ::SimdSynetConvolution8iForward and ::SimdSynetConvolution8iReshape.
     */
     SIMD_API void * SimdSynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
 
@@ -5916,6 +6646,22 @@ extern "C"
     */
     SIMD_API void SimdSynetConvolution8iForward(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst);
 
+    /*! @ingroup synet_convolution_int8
+
+        \fn SimdBool SimdSynetConvolution8iReshape(void * context, size_t srcH, size_t srcW);
+
+        \short Changes spatial size of input tensor of INT8 convolution algorithm without its reinitialization.
+
+        Quantized weights are kept, only blocking parameters of the algorithm are recalculated. Output size is derived from new input size and parameters of convolution.
+        Size of external temporary buffer can be changed after successful call, so it must be requested again with using of function ::SimdSynetConvolution8iExternalBufferSize.
+
+        \param [in, out] context - a pointer to INT8 convolution context. It must be created by function ::SimdSynetConvolution8iInit and released by function ::SimdRelease.
+        \param [in] srcH - a new height of input tensor.
+        \param [in] srcW - a new width of input tensor.
+        \return result of operation. If it is equal to ::SimdFalse then the context is unchanged and it has to be recreated with using of function ::SimdSynetConvolution8iInit.
+    */
+    SIMD_API SimdBool SimdSynetConvolution8iReshape(void * context, size_t srcH, size_t srcW);
+
     /*! @ingroup synet_deconvolution_fp32
 
         \fn void * SimdSynetDeconvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
@@ -6830,6 +7576,55 @@ extern "C"
     SIMD_API void SimdSynetSetInput(const uint8_t * src, size_t width, size_t height, size_t stride, SimdPixelFormatType srcFormat, 
         const float * lower, const float * upper, float * dst, size_t channels, SimdTensorFormatType dstFormat);
 
+    /*! @ingroup synet_conversion
+
+        \fn void * SimdSynetYuvToTensorInit(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH, SimdPixelFormatType order, const float * mean, const float * scale, SimdTensorFormatType format);
+
+        \short Initializes context of fused conversion of YUV 4:2:0 image to the input tensor of neural network.
+
+        The conversion combines ::SimdYuv420pToBgr (BT.601), bilinear resizing and normalization in one pass.
+        The input image is processed row by row: only the source rows needed for bilinear interpolation are converted, 
+        so intermediate buffers have size of a few image rows. The output value is estimated as:
+        \verbatim
+        dst[c](x, y) = (Bilinear(bgr[c], x, y) - mean[c]) * scale[c];
+        \endverbatim
+        where channel c is given in order of output tensor.
+
+        \param [in] srcW - a width of input image. It must be even.
+        \param [in] srcH - a height of input image. It must be even.
+        \param [in] layout - a layout of planes of input image (see ::SimdYuvLayoutType).
+        \param [in] dstW - a width of output tensor.
+        \param [in] dstH - a height of output tensor.
+        \param [in] order - an order of 3 channels in output tensor. It can be ::SimdPixelFormatBgr24 or ::SimdPixelFormatRgb24.
+        \param [in] mean - a pointer to array with 3 mean values (for every channel of output tensor).
+        \param [in] scale - a pointer to array with 3 scale values (for every channel of output tensor).
+        \param [in] format - a format of output tensor. It can be ::SimdTensorFormatNchw or ::SimdTensorFormatNhwc.
+        \return a pointer to conversion context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in function ::SimdSynetYuvToTensorRun.
+    */
+    SIMD_API void * SimdSynetYuvToTensorInit(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH, 
+        SimdPixelFormatType order, const float * mean, const float * scale, SimdTensorFormatType format);
+
+    /*! @ingroup synet_conversion
+
+        \fn void SimdSynetYuvToTensorRun(void * context, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, float * dst);
+
+        \short Performs fused conversion of YUV 4:2:0 image to the input tensor of neural network.
+
+        \note The context holds internal row buffers, so it must not be used simultaneously from different threads.
+
+        \param [in, out] context - a pointer to conversion context. It must be created by function ::SimdSynetYuvToTensorInit and released by function ::SimdRelease.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the Y plane.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane (or interleaved UV plane for ::SimdYuvLayoutNv12).
+        \param [in] uStride - a row size of the U (or UV) plane.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane. It is ignored for ::SimdYuvLayoutNv12.
+        \param [in] vStride - a row size of the V plane.
+        \param [out] dst - a pointer to the output 32-bit float tensor with size 3 * dstW * dstH.
+    */
+    SIMD_API void SimdSynetYuvToTensorRun(void * context, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, 
+        const uint8_t * v, size_t vStride, float * dst);
+
     /*! @ingroup synet
 
         \fn void SimdSynetShuffleLayerForward(const float * src0, const float * src1, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format, int type);
@@ -7110,6 +7905,75 @@ extern "C"
     */
     SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup transform
+
+        \fn void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+
+        \short Creates a context of affine warping of 8-bit image.
+
+        An output pixel (x, y) is sampled from the input image at point (x', y') where (x, y) = (m[0]*x' + m[1]*y' + m[2], m[3]*x' + m[4]*y' + m[5]).
+        The inverse transformation and its coordinate increments are precomputed at initialization.
+
+        \param [in] srcW - a width of the input image.
+        \param [in] srcH - a height of the input image.
+        \param [in] dstW - a width of the output image.
+        \param [in] dstH - a height of the output image.
+        \param [in] channels - a channel number of input and output image. It can be 1 (Gray8), 2 (Uv16), 3 (Bgr24) or 4 (Bgra32).
+        \param [in] mat - a pointer to 2x3 matrix of affine transformation of the input image to the output image.
+        \param [in] flags - interpolation and border flags (see ::SimdWarpFlags).
+        \param [in] border - a pointer to pixel value used for ::SimdWarpBorderConstant mode. It can be NULL (the border is filled by zeros).
+        \return a pointer to warp context. On error (for example the matrix is singular) it returns NULL.
+                This pointer is used in function ::SimdWarpAffineRun. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdWarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+
+    /*! @ingroup transform
+
+        \fn void SimdWarpAffineRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs affine warping of 8-bit image.
+
+        \param [in] context - a warp context. It must be created by function ::SimdWarpAffineInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in, out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdWarpAffineRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup transform
+
+        \fn void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+
+        \short Creates a context of perspective warping of 8-bit image.
+
+        \param [in] srcW - a width of the input image.
+        \param [in] srcH - a height of the input image.
+        \param [in] dstW - a width of the output image.
+        \param [in] dstH - a height of the output image.
+        \param [in] channels - a channel number of input and output image. It can be 1 (Gray8), 2 (Uv16), 3 (Bgr24) or 4 (Bgra32).
+        \param [in] mat - a pointer to 3x3 matrix of perspective transformation of the input image to the output image.
+        \param [in] flags - interpolation and border flags (see ::SimdWarpFlags).
+        \param [in] border - a pointer to pixel value used for ::SimdWarpBorderConstant mode. It can be NULL (the border is filled by zeros).
+        \return a pointer to warp context. On error (for example the matrix is singular) it returns NULL.
+                This pointer is used in function ::SimdWarpPerspectiveRun. It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdWarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+
+    /*! @ingroup transform
+
+        \fn void SimdWarpPerspectiveRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs perspective warping of 8-bit image.
+
+        \param [in] context - a warp context. It must be created by function ::SimdWarpPerspectiveInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size (in bytes) of the input image.
+        \param [in, out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdWarpPerspectiveRun(const void * context, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup synet_winograd
 
         \fn void SimdWinogradKernel1x3Block1x4SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
@@ -7502,6 +8366,62 @@ extern "C"
     */
     SIMD_API void SimdWinogradKernel3x3Block4x4SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
 
+    /*! @ingroup synet_winograd
+
+        \fn void SimdWinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
+
+        \short This function is used for filter conversion in Winograd F(6x6,3x3) convolution algorithm.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array with filter weights.
+        \param [in] size - (number of input channels)*(number of output channels).
+        \param [out] dst - a pointer to the output 32-bit float array with filter weights.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdWinogradKernel3x3Block6x6SetFilter(const float * src, size_t size, float * dst, SimdBool trans);
+
+    /*! @ingroup synet_winograd
+
+        \fn void SimdWinogradKernel3x3Block6x6SetInput(const float * src, size_t srcChannels, size_t srcHeight, size_t srcWidth, size_t padY, size_t padX, size_t padH, size_t padW, float * dst, size_t dstStride, SimdBool trans);
+
+        \short This function is used for input image conversion in Winograd F(6x6,3x3) convolution algorithm.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input image.
+        \param [in] srcChannels - a number of input channels.
+        \param [in] srcHeight - a height of input image.
+        \param [in] srcWidth - a width of input image.
+        \param [in] padY - an additional zero padding of input image at the beginning of Y-axis.
+        \param [in] padX - an additional zero padding of input image at the beginning of X-axis.
+        \param [in] padH - an additional zero padding of input image at the end of Y-axis.
+        \param [in] padW - an additional zero padding of input image at the end of X-axis.
+        \param [out] dst - a pointer to the output array with converted image.
+        \param [in] dstStride - a stride of output image.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdWinogradKernel3x3Block6x6SetInput(const float* src, size_t srcChannels, size_t srcHeight, size_t srcWidth,
+        size_t padY, size_t padX, size_t padH, size_t padW, float* dst, size_t dstStride, SimdBool trans);
+
+    /*! @ingroup synet_winograd
+
+        \fn void SimdWinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+
+        \short This function is used for output image conversion in Winograd F(6x6,3x3) convolution algorithm.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input image.
+        \param [in] srcStride - a stride of input image.
+        \param [out] dst - a pointer to the output image.
+        \param [in] dstChannels - a number of output channels.
+        \param [in] dstHeight - a height of output image.
+        \param [in] dstWidth - a width of output image.
+        \param [in] trans - a flag of transposed data.
+    */
+    SIMD_API void SimdWinogradKernel3x3Block6x6SetOutput(const float * src, size_t srcStride, float * dst, size_t dstChannels, size_t dstHeight, size_t dstWidth, SimdBool trans);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuva420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, const uint8_t * a, size_t aStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride);
@@ -7851,6 +8771,219 @@ extern "C"
     SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         size_t width, size_t height, uint8_t* rgb, size_t rgbStride);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 24-bit BGR image with given YUV standard and range.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 32-bit BGRA image with given YUV standard and range.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts YUV420P image to 24-bit RGB image with given YUV standard and range.
+
+        The input Y and output RGB images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit BGR image with given YUV standard and range.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image contains interleaved U and V components and has half height of Y component (its width in pixels is equal to half width of Y component).
+        The function works without intermediate deinterleaving of UV plane.
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit BGRA image with given YUV standard and range.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image contains interleaved U and V components and has half height of Y component (its width in pixels is equal to half width of Y component).
+        The function works without intermediate deinterleaving of UV plane.
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit RGB image with given YUV standard and range.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image contains interleaved U and V components and has half height of Y component (its width in pixels is equal to half width of Y component).
+        The function works without intermediate deinterleaving of UV plane.
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved U and V color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 24-bit BGR image with given YUV standard and range.
+
+        The input Y and output BGR images must have the same width and height.
+        The input VU image contains interleaved V and U components and has half height of Y component (its width in pixels is equal to half width of Y component).
+        The function works without intermediate deinterleaving of VU plane.
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+        size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 32-bit BGRA image with given YUV standard and range.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input VU image contains interleaved V and U components and has half height of Y component (its width in pixels is equal to half width of Y component).
+        The function works without intermediate deinterleaving of VU plane.
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+        size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV21 image to 24-bit RGB image with given YUV standard and range.
+
+        The input Y and output RGB images must have the same width and height.
+        The input VU image contains interleaved V and U components and has half height of Y component (its width in pixels is equal to half width of Y component).
+        The function works without intermediate deinterleaving of VU plane.
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] vu - a pointer to pixels data of input 16-bit image with interleaved V and U color planes.
+        \param [in] vuStride - a row size of the vu image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see ::SimdYuvType).
+    */
+    SIMD_API void SimdNv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+        size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -29,10 +29,13 @@
 #include "Simd/SimdFrame.hpp"
 #include "Simd/SimdDrawing.hpp"
 #include "Simd/SimdFont.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
 #include <stack>
 #include <sstream>
+#include <memory>
+#include <chrono>
 
 #ifndef SIMD_CHECK_PERFORMANCE
 #define SIMD_CHECK_PERFORMANCE()
@@ -434,6 +437,8 @@ namespace Simd
         struct Options
         {
             int CalibrationScaleLevelMax;  /*!< \brief A maximum scale of input frame. By default it is equal to 3 (maximum scale in 8 times). */ 
+            bool CalibrationRoiCropEnable; /*!< \brief A flag to process only bounding box of ROI (plus margin) instead of whole frame. By default it is false. */
+            double CalibrationRoiCropMargin; /*!< \brief A margin (in parts of screen size) added to bounding box of ROI if ROI crop is enabled. It is restricted by range [0, 1]. By default it is equal to 0.05. */
 
             int DifferenceGrayFeatureWeight; /*!< \brief A weight of gray feature for difference estimation. By default it is equal to 18. */ 
             int DifferenceDxFeatureWeight; /*!< \brief A weight of X-gradient feature for difference estimation. By default it is equal to 18. */ 
@@ -458,6 +463,9 @@ namespace Simd
             double ClassificationShiftMin; /*!< \brief A minimal shift (in screen diagonals) of motion region to detect object. By default it is equal to 0.075. */
             double ClassificationTimeMin; /*!< \brief A minimal life time (in seconds) of motion region to detect object. By default it is equal to 1 second. */
 
+            int AdaptiveQuietFrameCount; /*!< \brief A number of successive quiet frames (without motion and objects) to switch to reduced update rate. 0 disables this mode. By default it is equal to 0. */
+            int AdaptiveQuietFrameStep; /*!< \brief Every N-th frame is fully processed at reduced update rate. Other frames are only checked for motion at the top pyramid level. By default it is equal to 4. */
+
             int DebugDrawLevel; /*!< \brief A pyramid level used for debug annotation. By default it is equal to 1. */
             int DebugDrawBottomRight; /*!< \brief A type of debug annotation in right bottom corner (0 - empty; 1 = difference; 2 - texture.gray.value; 3 - texture.dx.value; 4 - texture.dy.value). By default it is equal to 0. */
             bool DebugAnnotateModel; /*!< \brief Debug annotation of model. By default it is equal to false. */
@@ -470,6 +478,8 @@ namespace Simd
             Options()
             {
                 CalibrationScaleLevelMax = 3;
+                CalibrationRoiCropEnable = false;
+                CalibrationRoiCropMargin = 0.05;
 
                 DifferenceGrayFeatureWeight = 18;
                 DifferenceDxFeatureWeight = 18;
@@ -494,6 +504,9 @@ namespace Simd
                 ClassificationShiftMin = 0.075;
                 ClassificationTimeMin = 1.0;
 
+                AdaptiveQuietFrameCount = 0;
+                AdaptiveQuietFrameStep = 4;
+
                 DebugDrawLevel = 1;
                 DebugDrawBottomRight = 0;
                 DebugAnnotateModel = false;
@@ -573,6 +586,13 @@ namespace Simd
 
                 SetFrame(input, output);
 
+                if (SkipFrame())
+                {
+                    _scene.metadata->objects.clear();
+                    DebugAnnotation();
+                    return true;
+                }
+
                 EstimateTextures();
 
                 EstimateDifference();
@@ -587,6 +607,8 @@ namespace Simd
 
                 UpdateBackground();
 
+                UpdateQuiet();
+
                 SetMetadata();
 
                 DebugAnnotation();
@@ -646,6 +668,10 @@ namespace Simd
 
             struct Model
             {
+                Size inputSize;
+                Rect crop;
+                Size screenSize;
+
                 Size originalFrameSize;
 
                 Size frameSize;
@@ -852,6 +878,18 @@ namespace Simd
                 }
             };
 
+            struct Adaptive
+            {
+                int quiet;
+                int skipped;
+
+                Adaptive()
+                    : quiet(0)
+                    , skipped(0)
+                {
+                }
+            };
+
             struct Scene
             {
                 Frame input, * output;
@@ -876,10 +914,12 @@ namespace Simd
 
                 Classification classification;
 
+                Adaptive adaptive;
+
                 void Create(const Options & options)
                 {
                     scaled.Recreate(model.originalFrameSize, model.scaleLevel + 1);
-                    font.Resize(model.originalFrameSize.y / 32);
+                    font.Resize(model.inputSize.y / 32);
                     buffer.Recreate(model.frameSize, model.levelCount);
 
                     texture.Create(model.frameSize, model.levelCount, options);
@@ -889,7 +929,7 @@ namespace Simd
                     segmentation.differenceCreationMin = int(255 * options.SegmentationCreateThreshold);
                     segmentation.differenceExpansionMin = int(255 * options.SegmentationExpandCoefficient*options.SegmentationCreateThreshold);
 
-                    classification.squareShiftMin = ptrdiff_t(Simd::SquaredDistance(model.frameSize, Point())*
+                    classification.squareShiftMin = ptrdiff_t(Simd::SquaredDistance(model.screenSize, Point())*
                         options.ClassificationShiftMin*options.ClassificationShiftMin);
                 }
             };
@@ -901,20 +941,32 @@ namespace Simd
 
                 _scene.input = input;
                 _scene.output = output;
-                Simd::Convert(input, Frame(_scene.scaled[0]).Ref());
+                Simd::Convert(Crop(input), Frame(_scene.scaled[0]).Ref());
                 Simd::Build(_scene.scaled, SimdReduce2x2);
             }
 
+            Frame Crop(const Frame & input) const
+            {
+                const Rect & crop = _scene.model.crop;
+                if (crop == Rect(input.Size()))
+                    return input;
+                if (input.flipped)
+                    return input.Region(crop.left, input.height - crop.bottom, crop.right, input.height - crop.top);
+                return input.Region(crop);
+            }
+
             bool Calibrate(const Size & frameSize)
             {
                 Model & model = _scene.model;
 
-                if (model.originalFrameSize == frameSize)
+                if (model.inputSize == frameSize)
                     return true;
 
                 SIMD_CHECK_PERFORMANCE();
 
-                model.originalFrameSize = frameSize;
+                model.inputSize = frameSize;
+                model.crop = EstimateCrop(frameSize);
+                model.originalFrameSize = model.crop.Size();
 
                 EstimateModelParameters(model);
                 SetScreenRoi(model);
@@ -926,9 +978,29 @@ namespace Simd
                 return true;
             }
 
+            Rect EstimateCrop(const Size & frameSize) const
+            {
+                Rect crop(frameSize);
+                if (_options.CalibrationRoiCropEnable && _model.roi.size() > 2)
+                {
+                    Rect box;
+                    for (size_t i = 0; i < _model.roi.size(); ++i)
+                        box |= OnvifToScreen(_model.roi[i], frameSize);
+                    ptrdiff_t align = ptrdiff_t(1) << _options.CalibrationScaleLevelMax;
+                    ptrdiff_t marginX = ptrdiff_t(frameSize.x * _options.CalibrationRoiCropMargin);
+                    ptrdiff_t marginY = ptrdiff_t(frameSize.y * _options.CalibrationRoiCropMargin);
+                    box.left = std::max<ptrdiff_t>(box.left - marginX, 0) / align * align;
+                    box.top = std::max<ptrdiff_t>(box.top - marginY, 0) / align * align;
+                    box.right = (box.right + marginX + align - 1) / align * align;
+                    box.bottom = (box.bottom + marginY + align - 1) / align * align;
+                    crop &= box;
+                }
+                return crop;
+            }
+
             void EstimateModelParameters(Model & model)
             {
-                Size objectSize = OnvifToScreenSize(_model.size, model.originalFrameSize);
+                Size objectSize = OnvifToScreenSize(_model.size, model.inputSize);
                 Size size = model.originalFrameSize;
                 model.areaRegionMinEstimated = int(objectSize.x*objectSize.y);
                 int levelCount = 1;
@@ -943,8 +1015,12 @@ namespace Simd
                 model.levelCount = levelCount - model.scaleLevel;
                 model.scale = size_t(1) << model.scaleLevel;
                 model.frameSize = model.originalFrameSize;
+                model.screenSize = model.inputSize;
                 for (size_t level = 0; level < model.scaleLevel; ++level)
+                {
                     model.frameSize = Simd::Scale(model.frameSize);
+                    model.screenSize = Simd::Scale(model.screenSize);
+                }
             }
 
             void SetScreenRoi(Model & model)
@@ -953,7 +1029,7 @@ namespace Simd
                 {
                     model.roi.resize(_model.roi.size());
                     for (size_t i = 0; i < _model.roi.size(); ++i)
-                        model.roi[i] = OnvifToScreen(_model.roi[i], model.frameSize);
+                        model.roi[i] = OnvifToScreen(_model.roi[i], model.screenSize) - model.crop.TopLeft() / model.scale;
                 }
                 else
                 {
@@ -1532,6 +1608,60 @@ namespace Simd
                 background.incrementCounterTime = 0;
             }
 
+            bool SkipFrame()
+            {
+                Adaptive & adaptive = _scene.adaptive;
+                if (_options.AdaptiveQuietFrameCount <= 0 || adaptive.quiet < _options.AdaptiveQuietFrameCount)
+                    return false;
+                if (++adaptive.skipped >= _options.AdaptiveQuietFrameStep)
+                {
+                    adaptive.skipped = 0;
+                    return false;
+                }
+                if (EstimateTopDifference())
+                {
+                    adaptive.quiet = 0;
+                    adaptive.skipped = 0;
+                    return false;
+                }
+                return true;
+            }
+
+            bool EstimateTopDifference()
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                Texture & texture = _scene.texture;
+                Simd::Copy(_scene.scaled.Top(), texture.gray.value[0]);
+                Simd::Build(texture.gray.value, SimdReduce4x4);
+                size_t top = texture.gray.value.Size() - 1;
+                Simd::TextureBoostedSaturatedGradient(texture.gray.value[top],
+                    _options.TextureGradientSaturation, _options.TextureGradientBoost,
+                    texture.dx.value[top], texture.dy.value[top]);
+
+                View & difference = _scene.difference[top];
+                Simd::Fill(difference, 0);
+                for (size_t j = 0; j < texture.features.size(); ++j)
+                {
+                    const Texture::Feature & feature = *texture.features[j];
+                    Simd::AddFeatureDifference(feature.value[top], feature.lo.value[top], feature.hi.value[top], feature.weight, difference);
+                }
+                if (_options.DifferenceRoiMaskEnable)
+                    Simd::OperationBinary8u(difference, _scene.model.roiMask[top], difference, SimdOperationBinary8uAnd);
+
+                uint32_t count;
+                Simd::ConditionalCount8u(difference, uint8_t(_scene.segmentation.differenceCreationMin), SimdCompareGreater, count);
+                return count > 0;
+            }
+
+            void UpdateQuiet()
+            {
+                bool quiet = _scene.segmentation.movingRegions.empty() && _scene.tracking.objects.empty() &&
+                    _scene.tracking.justDeletedObjects.empty() && _scene.background.state == Background::Update && 
+                    _scene.stability.state == Stability::Stable;
+                _scene.adaptive.quiet = quiet ? _scene.adaptive.quiet + 1 : 0;
+            }
+
             void SetMetadata()
             {
                 _scene.metadata->objects.clear();
@@ -1542,6 +1672,7 @@ namespace Simd
             void AddToMetadata(const ObjectPtrs & objects)
             {
                 size_t scale = _scene.model.scale;
+                Point offset = _scene.model.crop.TopLeft();
                 for (size_t i = 0; i < objects.size(); ++i)
                 {
                     Object & srcObject = *objects[i];
@@ -1549,7 +1680,7 @@ namespace Simd
                     {
                         Motion::Object dstObject;
                         dstObject.id = srcObject.classificationId;
-                        dstObject.rect = srcObject.rect*scale;
+                        dstObject.rect = (srcObject.rect*scale).Shifted(offset);
                         for (size_t j = 0; j < srcObject.trajectory.size(); ++j)
                         {
                             ptrdiff_t begin = std::max<ptrdiff_t>(0, j - _options.TrackingAveragingHalfRange);
@@ -1559,7 +1690,7 @@ namespace Simd
                                 sum += srcObject.trajectory[l]->point*scale;
                             Motion::Position position;
                             position.time = srcObject.trajectory[j]->time;
-                            position.point = sum / (end - begin);
+                            position.point = sum / (end - begin) + offset;
                             dstObject.trajectory.push_back(position);
                         }
                         _scene.metadata->objects.push_back(dstObject);
@@ -1573,6 +1704,7 @@ namespace Simd
 
                 Frame * output = _scene.output;
                 size_t scale = _scene.model.scale;
+                Point offset = _scene.model.crop.TopLeft();
 
                 if (output && output->format == Frame::Bgr24)
                 {
@@ -1597,10 +1729,10 @@ namespace Simd
                         for (size_t i = 0; i < _scene.model.roi.size(); ++i)
                         {
                             Point p0 = i ? _scene.model.roi[i - 1] : _scene.model.roi.back(), p1 = _scene.model.roi[i];
-                            Simd::DrawLine(canvas, p0*scale, p1*scale, color);
+                            Simd::DrawLine(canvas, p0*scale + offset, p1*scale + offset, color);
                         }
-                        Rect objectMin(OnvifToScreenSize(_model.size, _scene.model.originalFrameSize));
-                        objectMin.Shift(Point(_scene.model.originalFrameSize.x - objectMin.right - 2*scale, scale));
+                        Rect objectMin(OnvifToScreenSize(_model.size, _scene.model.inputSize));
+                        objectMin.Shift(Point(_scene.model.inputSize.x - objectMin.right - 2*scale, scale));
                         Simd::DrawRectangle(canvas, objectMin, color);
                     }
 
@@ -1610,7 +1742,7 @@ namespace Simd
                         for (size_t i = 0; i < _scene.segmentation.movingRegions.size(); ++i)
                         {
                             const MovingRegion & region = *_scene.segmentation.movingRegions[i];
-                            Simd::DrawRectangle(canvas, region.rect*scale, color, 1);
+                            Simd::DrawRectangle(canvas, (region.rect*scale).Shifted(offset), color, 1);
                         }
                     }
 
@@ -1620,16 +1752,173 @@ namespace Simd
                         for (size_t i = 0; i < _scene.tracking.objects.size(); ++i)
                         {
                             const Object & object = *_scene.tracking.objects[i];
-                            Simd::DrawRectangle(canvas, object.rect*scale, color, 1);
-                            _scene.font.Draw(canvas, ToString(object.trackingId), Point(object.rect.Center().x*scale, object.rect.top*scale - _scene.font.Height()), color);
+                            Simd::DrawRectangle(canvas, (object.rect*scale).Shifted(offset), color, 1);
+                            _scene.font.Draw(canvas, ToString(object.trackingId), Point(object.rect.Center().x*scale, object.rect.top*scale - _scene.font.Height()) + offset, color);
                             const MovingRegionPtrs & regions = object.trajectory;
                             for (size_t j = 1; j < regions.size(); ++j)
-                                Simd::DrawLine(canvas, regions[j]->point*scale, regions[j - 1]->point*scale, color, 1);
+                                Simd::DrawLine(canvas, regions[j]->point*scale + offset, regions[j - 1]->point*scale + offset, color, 1);
                         }
                     }
                 }
             }
         };
+
+        /*! @ingroup cpp_motion
+
+            \short Class Manager.
+
+            Performs motion detection for many video streams (cameras) at the same time.
+            Every stream has its own Simd::Motion::Detector. A batch of frames (one frame per stream) is processed
+            in parallel on the global thread pool of the library (See Simd::ThreadPool).
+            Streams are dispatched dynamically one by one in order of their previous processing time (the most expensive streams go first),
+            so a batch of streams with different load is balanced between threads and its latency is stable.
+        */
+        class Manager
+        {
+        public:
+            typedef std::vector<Frame> Frames; /*!< \brief Vector of frames (one frame per stream). */
+            typedef std::vector<Metadata> Metadatas; /*!< \brief Vector of metadata (one metadata per stream). */
+
+            /*!
+                Constructor of Manager.
+
+                \param [in] threadNumber - a number of threads used to process a batch of frames. By default it is equal to number of hardware threads.
+            */
+            Manager(size_t threadNumber = std::thread::hardware_concurrency())
+                : _threadNumber(std::max<size_t>(threadNumber, 1))
+            {
+            }
+
+            /*!
+                Adds a new stream to the manager.
+
+                \param [in] model - a model of scene of the stream.
+                \param [in] options - options of motion detector of the stream.
+                \return an index of the added stream.
+            */
+            size_t Add(const Model & model = Model(), const Options & options = Options())
+            {
+                Stream stream;
+                stream.detector.reset(new Detector());
+                stream.detector->SetModel(model);
+                stream.detector->SetOptions(options);
+                stream.cost = 0;
+                _streams.push_back(stream);
+                return _streams.size() - 1;
+            }
+
+            /*!
+                Gets number of streams.
+
+                \return a number of streams.
+            */
+            size_t Size() const
+            {
+                return _streams.size();
+            }
+
+            /*!
+                Gets motion detector of given stream. It can be used to change its model or options.
+
+                \param [in] index - an index of the stream.
+                \return a reference to motion detector of the stream.
+            */
+            Detector & At(size_t index)
+            {
+                return *_streams[index].detector;
+            }
+
+            /*!
+                Gets average processing time of given stream (exponential moving average). Streams are processed in descending order of this value.
+
+                \param [in] index - an index of the stream.
+                \return an average processing time (in seconds) of the stream. It is equal to 0 before the first processed frame.
+            */
+            double Cost(size_t index) const
+            {
+                return _streams[index].cost;
+            }
+
+            /*!
+                Sets number of threads used to process a batch of frames.
+
+                \param [in] threadNumber - a number of threads.
+            */
+            void SetThreadNumber(size_t threadNumber)
+            {
+                _threadNumber = std::max<size_t>(threadNumber, 1);
+            }
+
+            /*!
+                Processes next batch of frames. Every stream has to successively process all its frames.
+
+                \note If this method is called from a task of the thread pool (see Simd::ThreadPool::Inside()) then the streams are processed in the calling thread.
+
+                \param [in] inputs - a current input frames (one frame per stream). A stream is skipped if its frame is empty (has Frame::None format).
+                \param [out] metadata - a metadata of current frames (one metadata per stream).
+                \return a result of the operation.
+            */
+            bool NextFrames(const Frames & inputs, Metadatas & metadata)
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                if (inputs.size() != _streams.size())
+                    return false;
+                metadata.resize(_streams.size());
+
+                _order.clear();
+                for (size_t i = 0; i < _streams.size(); ++i)
+                {
+                    _streams[i].result = true;
+                    if (inputs[i].format != Frame::None)
+                        _order.push_back(i);
+                }
+                std::stable_sort(_order.begin(), _order.end(), [this](size_t a, size_t b) { return _streams[a].cost > _streams[b].cost; });
+
+                auto process = [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        Stream & stream = _streams[_order[i]];
+                        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                        stream.result = stream.detector->NextFrame(inputs[_order[i]], metadata[_order[i]]);
+                        double cost = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                        stream.cost = stream.cost > 0 ? stream.cost * 0.75 + cost * 0.25 : cost;
+                    }
+                };
+
+                size_t threads = std::min(_threadNumber, _order.size());
+#ifndef SIMD_FUTURE_DISABLE
+                if (ThreadPool::Inside())
+                    threads = 1;
+                struct Wrapper
+                {
+                    static void Task(const void * function, size_t thread, size_t begin, size_t end)
+                    {
+                        (*(const decltype(process)*)function)(thread, begin, end);
+                    }
+                };
+                if (threads < 2 || !ThreadPool::Global().Run(0, _order.size(), 1, threads, Wrapper::Task, &process))
+#endif
+                    process(0, 0, _order.size());
+
+                bool result = true;
+                for (size_t i = 0; i < _streams.size(); ++i)
+                    result = result && _streams[i].result;
+                return result;
+            }
+
+        private:
+            struct Stream
+            {
+                std::shared_ptr<Detector> detector;
+                double cost;
+                bool result;
+            };
+            std::vector<Stream> _streams;
+            std::vector<size_t> _order;
+            size_t _threadNumber;
+        };
     }
 }
 
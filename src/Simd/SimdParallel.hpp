@@ -26,12 +26,251 @@
 
 #include <vector>
 #include <thread>
+#include <algorithm>
 #ifndef SIMD_FUTURE_DISABLE
-#include <future>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+#ifndef SIMD_PARALLEL_SPIN_COUNT
+#define SIMD_PARALLEL_SPIN_COUNT 4096
+#endif
+
+#ifndef SIMD_PARALLEL_BLOCKS_PER_THREAD
+#define SIMD_PARALLEL_BLOCKS_PER_THREAD 4
 #endif
 
 namespace Simd
 {
+#ifndef SIMD_FUTURE_DISABLE
+    /*!
+        \short ThreadPool - a persistent pool of work threads used by function Simd::Parallel.
+
+        Work threads are created once and are reused by all following calls. Idle threads at first spin for a short time 
+        and then are parked on a condition variable. A range is split into blocks which are dynamically taken by 
+        the calling thread and work threads, so a slow (or preempted) thread does not delay the whole task.
+        A call of Run from a task of the pool (on work thread or on the calling thread) is detected and rejected, 
+        so nested tasks are executed by the caller. Resize, SetInit and Size must not be called from a task: 
+        Resize and SetInit are ignored there and Size returns current number of work threads without locking.
+    */
+    class ThreadPool
+    {
+    public:
+        typedef void(*Task)(const void * function, size_t thread, size_t begin, size_t end);
+        typedef void(*Init)(size_t thread);
+
+        ThreadPool()
+            : _generation(0)
+            , _init(NULL)
+            , _stop(false)
+        {
+        }
+
+        ~ThreadPool()
+        {
+            std::lock_guard<std::mutex> run(_run);
+            Stop();
+        }
+
+        /*!
+            Gets global thread pool of the library.
+
+            \return a reference to global thread pool.
+        */
+        static ThreadPool & Global()
+        {
+            static ThreadPool pool;
+            return pool;
+        }
+
+        /*!
+            Gets current number of work threads (the calling thread is not included).
+
+            \return a number of work threads.
+        */
+        size_t Size()
+        {
+            if (Inside())
+                return _workers.size();
+            std::lock_guard<std::mutex> run(_run);
+            return _workers.size();
+        }
+
+        /*!
+            Sets number of work threads (the calling thread is not included).
+
+            \param [in] size - a new number of work threads.
+        */
+        void Resize(size_t size)
+        {
+            if (Inside())
+                return;
+            std::lock_guard<std::mutex> run(_run);
+            if (size < _workers.size())
+                Stop();
+            Reserve(size);
+        }
+
+        /*!
+            Sets a function which is called by every work thread at its start (for example to set thread affinity).
+            Existing work threads are restarted.
+
+            \param [in] init - a function which is called with index of work thread (it is begun from 1). Can be NULL.
+        */
+        void SetInit(Init init)
+        {
+            if (Inside())
+                return;
+            std::lock_guard<std::mutex> run(_run);
+            size_t size = _workers.size();
+            Stop();
+            _init = init;
+            Reserve(size);
+        }
+
+        /*!
+            Executes task in parallel. 
+
+            \param [in] begin - a begin of processed range.
+            \param [in] end - an end of processed range.
+            \param [in] block - a size of block of range which is processed by one call of the task.
+            \param [in] threads - a number of threads (including the calling thread).
+            \param [in] task - a task which processes a block of range.
+            \param [in] function - a pointer to user function which is passed to the task.
+            \return false if the pool is already busy (for example in nested call from a task or in concurrent call from other thread).
+        */
+        bool Run(size_t begin, size_t end, size_t block, size_t threads, Task task, const void * function)
+        {
+            if (Inside())
+                return false;
+            std::unique_lock<std::mutex> run(_run, std::try_to_lock);
+            if (!run.owns_lock())
+                return false;
+            Scope scope;
+            Reserve(threads - 1);
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _job.begin = begin;
+                _job.end = end;
+                _job.block = block;
+                _job.threads = threads;
+                _job.task = task;
+                _job.function = function;
+                _next.store(begin);
+                _pending.store(threads - 1);
+                _generation.fetch_add(1, std::memory_order_release);
+            }
+            _wake.notify_all();
+            Execute(_job, 0);
+            for (size_t i = 0; i < SIMD_PARALLEL_SPIN_COUNT && _pending.load(std::memory_order_acquire); ++i)
+                std::this_thread::yield();
+            if (_pending.load(std::memory_order_acquire))
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _done.wait(lock, [this] { return _pending.load() == 0; });
+            }
+            return true;
+        }
+
+        /*!
+            Checks if current thread executes a task of the pool.
+
+            \return true for work threads and for the calling thread during execution of Run.
+        */
+        static bool Inside()
+        {
+            return InsideFlag();
+        }
+
+    private:
+        static bool & InsideFlag()
+        {
+            static thread_local bool inside = false;
+            return inside;
+        }
+
+        struct Scope
+        {
+            Scope() { InsideFlag() = true; }
+            ~Scope() { InsideFlag() = false; }
+        };
+
+        struct Job
+        {
+            size_t begin, end, block, threads;
+            Task task;
+            const void * function;
+        };
+
+        void Reserve(size_t size)
+        {
+            while (_workers.size() < size)
+            {
+                size_t index = _workers.size() + 1;
+                _workers.push_back(std::thread(&ThreadPool::Worker, this, index, _generation.load()));
+            }
+        }
+
+        void Stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+            for (size_t i = 0; i < _workers.size(); ++i)
+                _workers[i].join();
+            _workers.clear();
+            _stop = false;
+        }
+
+        void Execute(const Job & job, size_t thread)
+        {
+            for (size_t begin = _next.fetch_add(job.block); begin < job.end; begin = _next.fetch_add(job.block))
+                job.task(job.function, thread, begin, std::min(begin + job.block, job.end));
+        }
+
+        void Worker(size_t index, size_t generation)
+        {
+            InsideFlag() = true;
+            if (_init)
+                _init(index);
+            for (;;)
+            {
+                for (size_t i = 0; i < SIMD_PARALLEL_SPIN_COUNT && _generation.load(std::memory_order_acquire) == generation; ++i)
+                    std::this_thread::yield();
+                Job job;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _wake.wait(lock, [this, generation] { return _stop || _generation.load() != generation; });
+                    if (_stop)
+                        return;
+                    generation = _generation.load();
+                    job = _job;
+                }
+                if (index < job.threads)
+                {
+                    Execute(job, index);
+                    if (_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _done.notify_all();
+                    }
+                }
+            }
+        }
+
+        std::vector<std::thread> _workers;
+        std::mutex _run, _mutex;
+        std::condition_variable _wake, _done;
+        std::atomic<size_t> _generation, _next, _pending;
+        Job _job;
+        Init _init;
+        bool _stop;
+    };
+#endif
+
     template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockAlign = 1)
     {
 #ifdef SIMD_FUTURE_DISABLE
@@ -42,22 +281,19 @@ namespace Simd
             function(0, begin, end);
         else
         {
-            std::vector<std::future<void>> futures;
-
-            size_t blockSize = (end - begin + threadNumber - 1) / threadNumber;
+            size_t blockNumber = threadNumber * SIMD_PARALLEL_BLOCKS_PER_THREAD;
+            size_t blockSize = (end - begin + blockNumber - 1) / blockNumber;
             blockSize = (blockSize + blockAlign - 1) / blockAlign * blockAlign;
-            size_t blockBegin = begin;
-            size_t blockEnd = blockBegin + blockSize;
-
-            for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
+            threadNumber = std::min(threadNumber, (end - begin + blockSize - 1) / blockSize);
+            struct Wrapper
             {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
-                blockBegin += blockSize;
-                blockEnd = std::min(blockBegin + blockSize, end);
-            }
-
-            for (size_t i = 0; i < futures.size(); ++i)
-                futures[i].wait();
+                static void Task(const void * function, size_t thread, size_t begin, size_t end)
+                {
+                    (*(const Function*)function)(thread, begin, end);
+                }
+            };
+            if (!ThreadPool::Global().Run(begin, end, blockSize, threadNumber, Wrapper::Task, &function))
+                function(0, begin, end);
         }
 #endif
     }
@@ -62,6 +62,16 @@ namespace Simd
             return type == SimdResizeChannelFloat && 
                 (method == SimdResizeMethodBilinear || method == SimdResizeMethodCaffeInterp || method == SimdResizeMethodInferenceEngineInterp);
         }
+
+        bool IsByteFilter() const
+        {
+            return type == SimdResizeChannelByte && (method == SimdResizeMethodBicubic || method == SimdResizeMethodLanczos3);
+        }
+
+        bool IsFloatFilter() const
+        {
+            return type == SimdResizeChannelFloat && (method == SimdResizeMethodBicubic || method == SimdResizeMethodLanczos3);
+        }
     };
 
     class Resizer : Deletable
@@ -126,6 +136,46 @@ namespace Simd
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
+        const int32_t FILTER_SHIFT = 12;
+        const int32_t FILTER_RANGE = 1 << FILTER_SHIFT;
+        const int32_t FILTER_V_SHIFT = 6;
+        const int32_t FILTER_V_ROUND = 1 << (FILTER_V_SHIFT - 1);
+        const int32_t FILTER_H_SHIFT = 2 * FILTER_SHIFT - FILTER_V_SHIFT;
+        const int32_t FILTER_H_ROUND = 1 << (FILTER_H_SHIFT - 1);
+
+        size_t FilterTaps(SimdResizeMethodType method, size_t srcSize, size_t dstSize);
+
+        void EstimateFilterParams(SimdResizeMethodType method, size_t srcSize, size_t dstSize, size_t taps, int32_t * index, float * alpha);
+
+        class ResizerByteFilter : public Resizer
+        {
+        protected:
+            size_t _kx, _ky;
+            Array32i _ix, _ax, _iy, _ay, _bx;
+
+            virtual void RunV(const uint8_t * src, size_t srcStride, size_t dy, int32_t * dst);
+            virtual void RunH(const int32_t * src, uint8_t * dst);
+        public:
+            ResizerByteFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
+        class ResizerFloatFilter : public Resizer
+        {
+        protected:
+            size_t _kx, _ky;
+            Array32i _ix, _iy;
+            Array32f _ax, _ay, _bx;
+
+            virtual void RunV(const float * src, size_t srcStride, size_t dy, float * dst);
+            virtual void RunH(const float * src, float * dst);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 
@@ -283,6 +333,26 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerByteFilter : public Base::ResizerByteFilter
+        {
+        protected:
+            Array16i _ayp;
+
+            virtual void RunV(const uint8_t * src, size_t srcStride, size_t dy, int32_t * dst);
+            virtual void RunH(const int32_t * src, uint8_t * dst);
+        public:
+            ResizerByteFilter(const ResParam & param);
+        };
+
+        class ResizerFloatFilter : public Base::ResizerFloatFilter
+        {
+        protected:
+            virtual void RunV(const float * src, size_t srcStride, size_t dy, float * dst);
+            virtual void RunH(const float * src, float * dst);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX2_ENABLE 
@@ -297,6 +367,15 @@ namespace Simd
             ResizerFloatBilinear(const ResParam & param);
         };
 
+        class ResizerFloatFilter : public Base::ResizerFloatFilter
+        {
+        protected:
+            virtual void RunV(const float * src, size_t srcStride, size_t dy, float * dst);
+            virtual void RunH(const float * src, float * dst);
+        public:
+            ResizerFloatFilter(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX512F_ENABLE 
@@ -325,6 +404,15 @@ namespace Simd
             virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
         };
 
+        class ResizerByteFilter : public Avx2::ResizerByteFilter
+        {
+        protected:
+            virtual void RunV(const uint8_t * src, size_t srcStride, size_t dy, int32_t * dst);
+            virtual void RunH(const int32_t * src, uint8_t * dst);
+        public:
+            ResizerByteFilter(const ResParam & param);
+        };
+
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX512BW_ENABLE 
@@ -90,6 +90,13 @@ namespace Simd
                 Test(args);
         }
 
+        SIMD_INLINE void Reset()
+        {
+            for (size_t i = 0; i < _candidates.size(); ++i)
+                _candidates[i] = Candidate(_candidates[i].func);
+            _best = _candidates.size() == 1 ? &_candidates[0].func : NULL;
+        }
+
         SIMD_INLINE size_t Size() const
         {
             return _candidates.size();
@@ -0,0 +1,303 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdSsse3.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSSE3_ENABLE    
+    namespace Ssse3
+    {
+        const __m128i K8_SHUFFLE_BGRA_TO_PLANAR = SIMD_MM_SETR_EPI8(0x0, 0x4, 0x8, 0xC, 0x1, 0x5, 0x9, 0xD, 0x2, 0x6, 0xA, 0xE, 0x3, 0x7, 0xB, 0xF);
+
+        template<SimdPixelFormatType format> SIMD_INLINE void LoadPixels(const uint8_t * src, __m128i & blue, __m128i & green, __m128i & red);
+
+        template<> SIMD_INLINE void LoadPixels<SimdPixelFormatBgr24>(const uint8_t * src, __m128i & blue, __m128i & green, __m128i & red)
+        {
+            __m128i bgr[3];
+            bgr[0] = _mm_loadu_si128((__m128i*)src + 0);
+            bgr[1] = _mm_loadu_si128((__m128i*)src + 1);
+            bgr[2] = _mm_loadu_si128((__m128i*)src + 2);
+            blue = BgrToBlue(bgr);
+            green = BgrToGreen(bgr);
+            red = BgrToRed(bgr);
+        }
+
+        template<> SIMD_INLINE void LoadPixels<SimdPixelFormatRgb24>(const uint8_t * src, __m128i & blue, __m128i & green, __m128i & red)
+        {
+            __m128i rgb[3];
+            rgb[0] = _mm_loadu_si128((__m128i*)src + 0);
+            rgb[1] = _mm_loadu_si128((__m128i*)src + 1);
+            rgb[2] = _mm_loadu_si128((__m128i*)src + 2);
+            blue = BgrToRed(rgb);
+            green = BgrToGreen(rgb);
+            red = BgrToBlue(rgb);
+        }
+
+        template<> SIMD_INLINE void LoadPixels<SimdPixelFormatBgra32>(const uint8_t * src, __m128i & blue, __m128i & green, __m128i & red)
+        {
+            __m128i bgra0 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src + 0), K8_SHUFFLE_BGRA_TO_PLANAR);
+            __m128i bgra1 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src + 1), K8_SHUFFLE_BGRA_TO_PLANAR);
+            __m128i bgra2 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src + 2), K8_SHUFFLE_BGRA_TO_PLANAR);
+            __m128i bgra3 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)src + 3), K8_SHUFFLE_BGRA_TO_PLANAR);
+            __m128i bg01 = _mm_unpacklo_epi32(bgra0, bgra1), ra01 = _mm_unpackhi_epi32(bgra0, bgra1);
+            __m128i bg23 = _mm_unpacklo_epi32(bgra2, bgra3), ra23 = _mm_unpackhi_epi32(bgra2, bgra3);
+            blue = _mm_unpacklo_epi64(bg01, bg23);
+            green = _mm_unpackhi_epi64(bg01, bg23);
+            red = _mm_unpacklo_epi64(ra01, ra23);
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToY16(__m128i b16, __m128i g16, __m128i r16)
+        {
+            static const __m128i B_R = SIMD_MM_SET2_EPI16(T::BLUE_TO_Y, T::RED_TO_Y);
+            static const __m128i G_RT = SIMD_MM_SET2_EPI16(T::GREEN_TO_Y, T::B_ROUND);
+            static const __m128i Y_LO = SIMD_MM_SET1_EPI16(T::Y_LO);
+            __m128i lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(b16, r16), B_R),
+                _mm_madd_epi16(_mm_unpacklo_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            __m128i hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(b16, r16), B_R),
+                _mm_madd_epi16(_mm_unpackhi_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            return _mm_add_epi16(_mm_packs_epi32(lo, hi), Y_LO);
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToY8(__m128i blue, __m128i green, __m128i red)
+        {
+            return _mm_packus_epi16(
+                BgrToY16<T>(_mm_unpacklo_epi8(blue, K_ZERO), _mm_unpacklo_epi8(green, K_ZERO), _mm_unpacklo_epi8(red, K_ZERO)),
+                BgrToY16<T>(_mm_unpackhi_epi8(blue, K_ZERO), _mm_unpackhi_epi8(green, K_ZERO), _mm_unpackhi_epi8(red, K_ZERO)));
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToU16(__m128i b16, __m128i g16, __m128i r16)
+        {
+            static const __m128i B_R = SIMD_MM_SET2_EPI16(T::BLUE_TO_U, T::RED_TO_U);
+            static const __m128i G_RT = SIMD_MM_SET2_EPI16(T::GREEN_TO_U, T::B_ROUND);
+            static const __m128i UV_Z = SIMD_MM_SET1_EPI16(T::UV_Z);
+            __m128i lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(b16, r16), B_R),
+                _mm_madd_epi16(_mm_unpacklo_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            __m128i hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(b16, r16), B_R),
+                _mm_madd_epi16(_mm_unpackhi_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            return _mm_add_epi16(_mm_packs_epi32(lo, hi), UV_Z);
+        }
+
+        template<class T> SIMD_INLINE __m128i BgrToV16(__m128i b16, __m128i g16, __m128i r16)
+        {
+            static const __m128i B_R = SIMD_MM_SET2_EPI16(T::BLUE_TO_V, T::RED_TO_V);
+            static const __m128i G_RT = SIMD_MM_SET2_EPI16(T::GREEN_TO_V, T::B_ROUND);
+            static const __m128i UV_Z = SIMD_MM_SET1_EPI16(T::UV_Z);
+            __m128i lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(b16, r16), B_R),
+                _mm_madd_epi16(_mm_unpacklo_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            __m128i hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(b16, r16), B_R),
+                _mm_madd_epi16(_mm_unpackhi_epi16(g16, K16_0001), G_RT)), T::B_SHIFT);
+            return _mm_add_epi16(_mm_packs_epi32(lo, hi), UV_Z);
+        }
+
+        SIMD_INLINE __m128i Average16(__m128i row0, __m128i row1)
+        {
+            return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(_mm_maddubs_epi16(row0, K8_01), 
+                _mm_maddubs_epi16(row1, K8_01)), K16_0002), 2);
+        }
+
+        template<class T, SimdPixelFormatType format> SIMD_INLINE void PixelsToYuv16(const uint8_t * src, size_t srcStride, 
+            uint8_t * y, size_t yStride, __m128i & u16, __m128i & v16)
+        {
+            __m128i blue[2], green[2], red[2];
+            LoadPixels<format>(src, blue[0], green[0], red[0]);
+            LoadPixels<format>(src + srcStride, blue[1], green[1], red[1]);
+            _mm_storeu_si128((__m128i*)y, BgrToY8<T>(blue[0], green[0], red[0]));
+            _mm_storeu_si128((__m128i*)(y + yStride), BgrToY8<T>(blue[1], green[1], red[1]));
+            __m128i b16 = Average16(blue[0], blue[1]);
+            __m128i g16 = Average16(green[0], green[1]);
+            __m128i r16 = Average16(red[0], red[1]);
+            u16 = BgrToU16<T>(b16, g16, r16);
+            v16 = BgrToV16<T>(b16, g16, r16);
+        }
+
+        template<class T, SimdPixelFormatType format> SIMD_INLINE void PixelsToYuv8(const uint8_t * src, size_t srcStride,
+            uint8_t * y, size_t yStride, __m128i & u8, __m128i & v8)
+        {
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            __m128i u16[2], v16[2];
+            PixelsToYuv16<T, format>(src + 0 * A * size, srcStride, y + 0 * A, yStride, u16[0], v16[0]);
+            PixelsToYuv16<T, format>(src + 1 * A * size, srcStride, y + 1 * A, yStride, u16[1], v16[1]);
+            u8 = _mm_packus_epi16(u16[0], u16[1]);
+            v8 = _mm_packus_epi16(v16[0], v16[1]);
+        }
+
+        template<class T, SimdPixelFormatType format> void PixelToYuv420p(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            size_t widthDA = AlignLo(width, DA), tail = width - DA;
+            __m128i _u, _v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0; colY < widthDA; colY += DA)
+                {
+                    PixelsToYuv8<T, format>(src + colY * size, srcStride, y + colY, yStride, _u, _v);
+                    _mm_storeu_si128((__m128i*)(u + colY / 2), _u);
+                    _mm_storeu_si128((__m128i*)(v + colY / 2), _v);
+                }
+                if (widthDA < width)
+                {
+                    PixelsToYuv8<T, format>(src + tail * size, srcStride, y + tail, yStride, _u, _v);
+                    _mm_storeu_si128((__m128i*)(u + tail / 2), _u);
+                    _mm_storeu_si128((__m128i*)(v + tail / 2), _v);
+                }
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+            }
+        }
+
+        template<bool nv21> SIMD_INLINE void StoreUv(uint8_t * uv, __m128i u, __m128i v)
+        {
+            _mm_storeu_si128((__m128i*)uv + 0, nv21 ? _mm_unpacklo_epi8(v, u) : _mm_unpacklo_epi8(u, v));
+            _mm_storeu_si128((__m128i*)uv + 1, nv21 ? _mm_unpackhi_epi8(v, u) : _mm_unpackhi_epi8(u, v));
+        }
+
+        template<class T, SimdPixelFormatType format, bool nv21> void PixelToNv(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            size_t widthDA = AlignLo(width, DA), tail = width - DA;
+            __m128i _u, _v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0; colY < widthDA; colY += DA)
+                {
+                    PixelsToYuv8<T, format>(src + colY * size, srcStride, y + colY, yStride, _u, _v);
+                    StoreUv<nv21>(uv + colY, _u, _v);
+                }
+                if (widthDA < width)
+                {
+                    PixelsToYuv8<T, format>(src + tail * size, srcStride, y + tail, yStride, _u, _v);
+                    StoreUv<nv21>(uv + tail, _u, _v);
+                }
+                src += 2 * srcStride;
+                y += 2 * yStride;
+                uv += uvStride;
+            }
+        }
+
+        template<SimdPixelFormatType format> void PixelToYuv420p(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: PixelToYuv420p<Base::Bt601, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709: PixelToYuv420p<Base::Bt709, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020: PixelToYuv420p<Base::Bt2020, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt601Full: PixelToYuv420p<Base::Bt601Full, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt709Full: PixelToYuv420p<Base::Bt709Full, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            case SimdYuvBt2020Full: PixelToYuv420p<Base::Bt2020Full, format>(src, width, height, srcStride, y, yStride, u, uStride, v, vStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template<SimdPixelFormatType format, bool nv21> void PixelToNv(const uint8_t * src, size_t width, size_t height, size_t srcStride,
+            uint8_t * y, size_t yStride, uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: PixelToNv<Base::Bt601, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709: PixelToNv<Base::Bt709, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020: PixelToNv<Base::Bt2020, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt601Full: PixelToNv<Base::Bt601Full, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt709Full: PixelToNv<Base::Bt709Full, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            case SimdYuvBt2020Full: PixelToNv<Base::Bt2020Full, format, nv21>(src, width, height, srcStride, y, yStride, uv, uvStride); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void BgrToYuv420pV2(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420p<SimdPixelFormatBgr24>(bgr, width, height, bgrStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void BgraToYuv420pV2(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420p<SimdPixelFormatBgra32>(bgra, width, height, bgraStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        void RgbToYuv420pV2(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType)
+        {
+            PixelToYuv420p<SimdPixelFormatRgb24>(rgb, width, height, rgbStride, y, yStride, u, uStride, v, vStride, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        void BgrToNv12(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatBgr24, false>(bgr, width, height, bgrStride, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void BgraToNv12(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatBgra32, false>(bgra, width, height, bgraStride, y, yStride, uv, uvStride, yuvType);
+        }
+
+        void RgbToNv12(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * uv, size_t uvStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatRgb24, false>(rgb, width, height, rgbStride, y, yStride, uv, uvStride, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        void BgrToNv21(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride,
+            uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatBgr24, true>(bgr, width, height, bgrStride, y, yStride, vu, vuStride, yuvType);
+        }
+
+        void BgraToNv21(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * y, size_t yStride,
+            uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatBgra32, true>(bgra, width, height, bgraStride, y, yStride, vu, vuStride, yuvType);
+        }
+
+        void RgbToNv21(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * y, size_t yStride,
+            uint8_t * vu, size_t vuStride, SimdYuvType yuvType)
+        {
+            PixelToNv<SimdPixelFormatRgb24, true>(rgb, width, height, rgbStride, y, yStride, vu, vuStride, yuvType);
+        }
+    }
+#endif// SIMD_SSSE3_ENABLE
+}
@@ -0,0 +1,281 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdSsse3.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSSE3_ENABLE    
+    namespace Ssse3
+    {
+        template<class T> SIMD_INLINE __m128i YuvToRed16(__m128i y16, __m128i v16)
+        {
+            static const __m128i Y_RT = SIMD_MM_SET2_EPI16(T::Y_TO_RGB, T::F_ROUND);
+            static const __m128i V_0 = SIMD_MM_SET2_EPI16(T::V_TO_RED, 0);
+            __m128i lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(y16, K16_0001), Y_RT),
+                _mm_madd_epi16(_mm_unpacklo_epi16(v16, K_ZERO), V_0)), T::F_SHIFT);
+            __m128i hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(y16, K16_0001), Y_RT),
+                _mm_madd_epi16(_mm_unpackhi_epi16(v16, K_ZERO), V_0)), T::F_SHIFT);
+            return _mm_packs_epi32(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m128i YuvToGreen16(__m128i y16, __m128i u16, __m128i v16)
+        {
+            static const __m128i Y_RT = SIMD_MM_SET2_EPI16(T::Y_TO_RGB, T::F_ROUND);
+            static const __m128i U_V = SIMD_MM_SET2_EPI16(T::U_TO_GREEN, T::V_TO_GREEN);
+            __m128i lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(y16, K16_0001), Y_RT),
+                _mm_madd_epi16(_mm_unpacklo_epi16(u16, v16), U_V)), T::F_SHIFT);
+            __m128i hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(y16, K16_0001), Y_RT),
+                _mm_madd_epi16(_mm_unpackhi_epi16(u16, v16), U_V)), T::F_SHIFT);
+            return _mm_packs_epi32(lo, hi);
+        }
+
+        template<class T> SIMD_INLINE __m128i YuvToBlue16(__m128i y16, __m128i u16)
+        {
+            static const __m128i Y_RT = SIMD_MM_SET2_EPI16(T::Y_TO_RGB, T::F_ROUND);
+            static const __m128i U_0 = SIMD_MM_SET2_EPI16(T::U_TO_BLUE, 0);
+            __m128i lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(y16, K16_0001), Y_RT),
+                _mm_madd_epi16(_mm_unpacklo_epi16(u16, K_ZERO), U_0)), T::F_SHIFT);
+            __m128i hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(y16, K16_0001), Y_RT),
+                _mm_madd_epi16(_mm_unpackhi_epi16(u16, K_ZERO), U_0)), T::F_SHIFT);
+            return _mm_packs_epi32(lo, hi);
+        }
+
+        template<SimdPixelFormatType format> SIMD_INLINE void StorePixels(__m128i blue, __m128i green, __m128i red, __m128i alpha, uint8_t * dst);
+
+        template<> SIMD_INLINE void StorePixels<SimdPixelFormatBgr24>(__m128i blue, __m128i green, __m128i red, __m128i alpha, uint8_t * dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, InterleaveBgr<0>(blue, green, red));
+            _mm_storeu_si128((__m128i*)dst + 1, InterleaveBgr<1>(blue, green, red));
+            _mm_storeu_si128((__m128i*)dst + 2, InterleaveBgr<2>(blue, green, red));
+        }
+
+        template<> SIMD_INLINE void StorePixels<SimdPixelFormatRgb24>(__m128i blue, __m128i green, __m128i red, __m128i alpha, uint8_t * dst)
+        {
+            _mm_storeu_si128((__m128i*)dst + 0, InterleaveBgr<0>(red, green, blue));
+            _mm_storeu_si128((__m128i*)dst + 1, InterleaveBgr<1>(red, green, blue));
+            _mm_storeu_si128((__m128i*)dst + 2, InterleaveBgr<2>(red, green, blue));
+        }
+
+        template<> SIMD_INLINE void StorePixels<SimdPixelFormatBgra32>(__m128i blue, __m128i green, __m128i red, __m128i alpha, uint8_t * dst)
+        {
+            __m128i bgLo = _mm_unpacklo_epi8(blue, green), bgHi = _mm_unpackhi_epi8(blue, green);
+            __m128i raLo = _mm_unpacklo_epi8(red, alpha), raHi = _mm_unpackhi_epi8(red, alpha);
+            _mm_storeu_si128((__m128i*)dst + 0, _mm_unpacklo_epi16(bgLo, raLo));
+            _mm_storeu_si128((__m128i*)dst + 1, _mm_unpackhi_epi16(bgLo, raLo));
+            _mm_storeu_si128((__m128i*)dst + 2, _mm_unpacklo_epi16(bgHi, raHi));
+            _mm_storeu_si128((__m128i*)dst + 3, _mm_unpackhi_epi16(bgHi, raHi));
+        }
+
+        template<class T, SimdPixelFormatType format> SIMD_INLINE void YuvToPixels(__m128i y8, __m128i u8, __m128i v8, __m128i alpha, uint8_t * dst)
+        {
+            static const __m128i Y_LO = SIMD_MM_SET1_EPI16(T::Y_LO);
+            static const __m128i UV_Z = SIMD_MM_SET1_EPI16(T::UV_Z);
+            __m128i yLo = _mm_sub_epi16(_mm_unpacklo_epi8(y8, K_ZERO), Y_LO);
+            __m128i uLo = _mm_sub_epi16(_mm_unpacklo_epi8(u8, K_ZERO), UV_Z);
+            __m128i vLo = _mm_sub_epi16(_mm_unpacklo_epi8(v8, K_ZERO), UV_Z);
+            __m128i yHi = _mm_sub_epi16(_mm_unpackhi_epi8(y8, K_ZERO), Y_LO);
+            __m128i uHi = _mm_sub_epi16(_mm_unpackhi_epi8(u8, K_ZERO), UV_Z);
+            __m128i vHi = _mm_sub_epi16(_mm_unpackhi_epi8(v8, K_ZERO), UV_Z);
+            __m128i blue = _mm_packus_epi16(YuvToBlue16<T>(yLo, uLo), YuvToBlue16<T>(yHi, uHi));
+            __m128i green = _mm_packus_epi16(YuvToGreen16<T>(yLo, uLo, vLo), YuvToGreen16<T>(yHi, uHi, vHi));
+            __m128i red = _mm_packus_epi16(YuvToRed16<T>(yLo, vLo), YuvToRed16<T>(yHi, vHi));
+            StorePixels<format>(blue, green, red, alpha, dst);
+        }
+
+        template<class T, SimdPixelFormatType format> SIMD_INLINE void Yuv420ToPixels(const uint8_t * y, size_t yStride, 
+            __m128i u, __m128i v, __m128i alpha, uint8_t * dst, size_t dstStride)
+        {
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            __m128i u0 = _mm_unpacklo_epi8(u, u), u1 = _mm_unpackhi_epi8(u, u);
+            __m128i v0 = _mm_unpacklo_epi8(v, v), v1 = _mm_unpackhi_epi8(v, v);
+            YuvToPixels<T, format>(_mm_loadu_si128((__m128i*)y + 0), u0, v0, alpha, dst + 0 * A * size);
+            YuvToPixels<T, format>(_mm_loadu_si128((__m128i*)y + 1), u1, v1, alpha, dst + 1 * A * size);
+            y += yStride, dst += dstStride;
+            YuvToPixels<T, format>(_mm_loadu_si128((__m128i*)y + 0), u0, v0, alpha, dst + 0 * A * size);
+            YuvToPixels<T, format>(_mm_loadu_si128((__m128i*)y + 1), u1, v1, alpha, dst + 1 * A * size);
+        }
+
+        const __m128i K8_SHUFFLE_DEINTERLEAVE_UV = SIMD_MM_SETR_EPI8(0x0, 0x2, 0x4, 0x6, 0x8, 0xA, 0xC, 0xE, 0x1, 0x3, 0x5, 0x7, 0x9, 0xB, 0xD, 0xF);
+
+        template<bool nv21> SIMD_INLINE void LoadUv(const uint8_t * uv, __m128i & u, __m128i & v)
+        {
+            __m128i uv0 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)uv + 0), K8_SHUFFLE_DEINTERLEAVE_UV);
+            __m128i uv1 = _mm_shuffle_epi8(_mm_loadu_si128((__m128i*)uv + 1), K8_SHUFFLE_DEINTERLEAVE_UV);
+            u = nv21 ? _mm_unpackhi_epi64(uv0, uv1) : _mm_unpacklo_epi64(uv0, uv1);
+            v = nv21 ? _mm_unpacklo_epi64(uv0, uv1) : _mm_unpackhi_epi64(uv0, uv1);
+        }
+
+        template<class T, SimdPixelFormatType format> void Yuv420pToPixel(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride,
+            const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            size_t widthDA = AlignLo(width, DA), tail = width - DA;
+            __m128i _alpha = _mm_set1_epi8(alpha);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0; colY < widthDA; colY += DA)
+                {
+                    __m128i _u = _mm_loadu_si128((__m128i*)(u + colY / 2));
+                    __m128i _v = _mm_loadu_si128((__m128i*)(v + colY / 2));
+                    Yuv420ToPixels<T, format>(y + colY, yStride, _u, _v, _alpha, dst + colY * size, dstStride);
+                }
+                if (widthDA < width)
+                {
+                    __m128i _u = _mm_loadu_si128((__m128i*)(u + tail / 2));
+                    __m128i _v = _mm_loadu_si128((__m128i*)(v + tail / 2));
+                    Yuv420ToPixels<T, format>(y + tail, yStride, _u, _v, _alpha, dst + tail * size, dstStride);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template<class T, SimdPixelFormatType format, bool nv21> void NvToPixel(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= DA) && (height >= 2));
+
+            const size_t size = format == SimdPixelFormatBgra32 ? 4 : 3;
+            size_t widthDA = AlignLo(width, DA), tail = width - DA;
+            __m128i _alpha = _mm_set1_epi8(alpha), _u, _v;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0; colY < widthDA; colY += DA)
+                {
+                    LoadUv<nv21>(uv + colY, _u, _v);
+                    Yuv420ToPixels<T, format>(y + colY, yStride, _u, _v, _alpha, dst + colY * size, dstStride);
+                }
+                if (widthDA < width)
+                {
+                    LoadUv<nv21>(uv + tail, _u, _v);
+                    Yuv420ToPixels<T, format>(y + tail, yStride, _u, _v, _alpha, dst + tail * size, dstStride);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template<SimdPixelFormatType format> void Yuv420pToPixel(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride,
+            const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420pToPixel<Base::Bt601, format>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Yuv420pToPixel<Base::Bt709, format>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Yuv420pToPixel<Base::Bt2020, format>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: Yuv420pToPixel<Base::Bt601Full, format>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: Yuv420pToPixel<Base::Bt709Full, format>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020Full: Yuv420pToPixel<Base::Bt2020Full, format>(y, yStride, u, uStride, v, vStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template<SimdPixelFormatType format, bool nv21> void NvToPixel(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: NvToPixel<Base::Bt601, format, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: NvToPixel<Base::Bt709, format, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: NvToPixel<Base::Bt2020, format, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt601Full: NvToPixel<Base::Bt601Full, format, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709Full: NvToPixel<Base::Bt709Full, format, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020Full: NvToPixel<Base::Bt2020Full, format, nv21>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //---------------------------------------------------------------------
+
+        void Yuv420pToBgrV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv420pToPixel<SimdPixelFormatBgr24>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv420pToBgraV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv420pToPixel<SimdPixelFormatBgra32>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Yuv420pToRgbV2(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Yuv420pToPixel<SimdPixelFormatRgb24>(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        void Nv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            NvToPixel<SimdPixelFormatBgr24, false>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            NvToPixel<SimdPixelFormatBgra32, false>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            NvToPixel<SimdPixelFormatRgb24, false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        //---------------------------------------------------------------------
+
+        void Nv21ToBgr(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            NvToPixel<SimdPixelFormatBgr24, true>(y, yStride, vu, vuStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv21ToBgra(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            NvToPixel<SimdPixelFormatBgra32, true>(y, yStride, vu, vuStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv21ToRgb(const uint8_t * y, size_t yStride, const uint8_t * vu, size_t vuStride,
+            size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            NvToPixel<SimdPixelFormatRgb24, true>(y, yStride, vu, vuStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+    }
+#endif// SIMD_SSSE3_ENABLE
+}
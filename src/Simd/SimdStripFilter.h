@@ -0,0 +1,134 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdStripFilter_h__
+#define __SimdStripFilter_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdGaussianBlur.h"
+
+namespace Simd
+{
+    struct StripFilterParam
+    {
+        size_t width, height, channels, align;
+        SimdStripFilterType type;
+        float radius;
+
+        StripFilterParam(size_t w, size_t h, size_t c, SimdStripFilterType t, const float * r, size_t a)
+            : width(w)
+            , height(h)
+            , channels(c)
+            , align(a)
+            , type(t)
+            , radius(r ? *r : 0.0f)
+        {
+        }
+
+        bool Valid() const
+        {
+            if (width < 2 || height == 0)
+                return false;
+            switch (type)
+            {
+            case SimdStripFilterGaussianBlur3x3:
+            case SimdStripFilterMedianSquare3x3:
+            case SimdStripFilterMedianSquare5x5:
+                return channels >= 1 && channels <= 4;
+            case SimdStripFilterGaussianBlur:
+                return channels >= 1 && channels <= 4 && radius > 0.0f;
+            case SimdStripFilterSobelDx:
+            case SimdStripFilterSobelDxAbs:
+            case SimdStripFilterSobelDy:
+            case SimdStripFilterSobelDyAbs:
+            case SimdStripFilterLaplace:
+            case SimdStripFilterLaplaceAbs:
+                return channels == 1 && width > 2;
+            default:
+                return false;
+            }
+        }
+
+        size_t DstSize() const
+        {
+            return type >= SimdStripFilterSobelDx ? width * sizeof(int16_t) : width * channels;
+        }
+    };
+
+    namespace Base
+    {
+        class StripFilter : public Deletable
+        {
+        public:
+            typedef void(*FilterPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, uint8_t * dst, size_t dstStride);
+
+            StripFilter(const StripFilterParam & param, FilterPtr filter);
+
+            size_t Run(const uint8_t * src, size_t srcStride, size_t rows, uint8_t * dst, size_t dstStride);
+
+            void Reset();
+
+        protected:
+            virtual void Filter(const uint8_t * src, size_t srcStride, size_t height, uint8_t * dst, size_t dstStride);
+
+            StripFilterParam _param;
+            FilterPtr _filter;
+            size_t _half, _srcSize, _srcStride, _dstSize, _dstStride, _first, _received, _emitted;
+            Array8u _src, _dst;
+        };
+
+        class StripFilterGaussianBlur : public StripFilter
+        {
+        public:
+            StripFilterGaussianBlur(const StripFilterParam & param);
+
+        protected:
+            virtual void Filter(const uint8_t * src, size_t srcStride, size_t height, uint8_t * dst, size_t dstStride);
+
+            GaussianBlur _blur;
+        };
+
+        template<void(*filter)(const uint8_t *, size_t, size_t, size_t, uint8_t *, size_t)> void StripFilterGray(
+            const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channels, uint8_t * dst, size_t dstStride)
+        {
+            filter(src, srcStride, width, height, dst, dstStride);
+        }
+
+        void * StripFilterInit(size_t width, size_t height, size_t channels, SimdStripFilterType type, const float * radius);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void * StripFilterInit(size_t width, size_t height, size_t channels, SimdStripFilterType type, const float * radius);
+    }
+#endif //SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        void * StripFilterInit(size_t width, size_t height, size_t channels, SimdStripFilterType type, const float * radius);
+    }
+#endif //SIMD_AVX512BW_ENABLE
+}
+#endif//__SimdStripFilter_h__
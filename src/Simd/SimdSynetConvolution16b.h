@@ -0,0 +1,195 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetConvolution16b_h__
+#define __SimdSynetConvolution16b_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdPerformance.h"
+
+namespace Simd
+{
+    struct ConvParam16b : public SimdConvolutionParameters
+    {
+        SimdBool trans;
+        size_t batch;
+
+        ConvParam16b()
+        {
+        }
+
+        ConvParam16b(size_t batch, const SimdConvolutionParameters * conv)
+        {
+            *((SimdConvolutionParameters*)this) = *conv;
+            this->trans = (srcF == SimdTensorFormatNhwc ? SimdTrue : SimdFalse);
+            this->batch = batch;
+        }
+
+        bool Valid() const
+        {
+            return
+                dstH == (srcH + padY + padH - (dilationY * (kernelY - 1) + 1)) / strideY + 1 && dstH > 0 &&
+                dstW == (srcW + padX + padW - (dilationX * (kernelX - 1) + 1)) / strideX + 1 && dstW > 0 &&
+                (srcT == SimdTensorData32f || srcT == SimdTensorData16b) && (dstT == SimdTensorData32f || dstT == SimdTensorData16b) &&
+                srcF == SimdTensorFormatNhwc && dstF == SimdTensorFormatNhwc && srcC % group == 0 && dstC % group == 0;
+        }
+
+        SIMD_INLINE bool IsKernel(size_t value) const
+        {
+            return kernelY == value && kernelX == value;
+        }
+
+        SIMD_INLINE bool IsDilation(size_t value) const
+        {
+            return dilationY == value && dilationX == value;
+        }
+
+        SIMD_INLINE bool IsStride(size_t value) const
+        {
+            return strideY == value && strideX == value;
+        }
+
+        SIMD_INLINE bool IsPad(size_t value) const
+        {
+            return padY == value && padX == value && padH == value && padW == value;
+        }
+
+        SIMD_INLINE bool Is1x1() const
+        {
+            return IsKernel(1) && IsDilation(1) && IsStride(1) && IsPad(0);
+        }
+
+#ifdef SIMD_PERFORMANCE_STATISTIC
+        String Info() const
+        {
+            std::stringstream ss;
+            ss << batch << "x" << srcC << "x" << srcH << "x" << srcW;
+            ss << "-" << dstC << "x" << kernelY << "x" << kernelX;
+            ss << "-" << strideX << "-" << Simd::Max(padX, padW) << "-" << group << "-" << trans;
+            return ss.str();
+        }
+
+        long long Flop() const
+        {
+            return batch * kernelY * kernelX * srcC * dstH * dstW * dstC / group * 2;
+        }
+#endif
+    };
+
+    class SynetConvolution16b : public Deletable
+    {
+    public:
+        SynetConvolution16b(const ConvParam16b & p);
+
+        const ConvParam16b & Param() const { return _param; }
+
+        virtual String Ext() const = 0;
+        virtual String Desc() const = 0;
+
+        virtual size_t ExternalBufferSize() const;
+        virtual size_t InternalBufferSize() const;
+
+        virtual void SetParams(const float * weight, const float * bias, const float * params);
+
+        virtual void Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst) = 0;
+
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+        Base::PerformanceMeasurer* Perf(const char* func);
+#endif
+
+    protected:
+        uint8_t * Buffer(uint8_t * buffer);
+
+        ConvParam16b _param;
+        Array8u _buffer;
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+        Base::PerformanceMeasurer * _perf;
+#endif
+        Array32f _bias, _params;
+        bool _src16b, _dst16b;
+        size_t _elemS, _elemD, _sizeS, _sizeD;
+    };
+
+    namespace Base
+    {
+        class SynetConvolution16bNhwcGemm : public SynetConvolution16b
+        {
+        public:
+            SynetConvolution16bNhwcGemm(const ConvParam16b & p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const { return Ext() + "::NhwcGemm"; }
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float * weight, const float * bias, const float * params);
+            virtual void Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst);
+
+            static const size_t F = 16;
+
+        protected:
+            typedef void(*GemmPtr)(const uint16_t * src, size_t M, size_t K, size_t srcStride, const uint16_t * weight, size_t D, float * dst, size_t dstStride);
+            typedef void(*BiasAndActivationPtr)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
+            typedef void(*ToBFloat16Ptr)(const float * src, size_t size, uint16_t * dst);
+
+            void ImgToRow(const uint8_t * src, size_t group, uint16_t * dst) const;
+
+            bool _direct;
+            size_t _K, _ldK, _D, _DF, _M;
+            Array16u _weight;
+            GemmPtr _gemm;
+            BiasAndActivationPtr _biasAndActivation;
+            ToBFloat16Ptr _toBFloat16;
+        };
+
+        void * SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters * conv);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetConvolution16bNhwcGemm : public Base::SynetConvolution16bNhwcGemm
+        {
+        public:
+            SynetConvolution16bNhwcGemm(const ConvParam16b & p);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
+        void * SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters * conv);
+    }
+#endif//SIMD_AVX2_ENABLE
+
+#ifdef SIMD_AVX512BF16_ENABLE    
+    namespace Avx512bf16
+    {
+        class SynetConvolution16bNhwcGemm : public Base::SynetConvolution16bNhwcGemm
+        {
+        public:
+            SynetConvolution16bNhwcGemm(const ConvParam16b & p);
+            virtual String Ext() const { return "Avx512bf16"; }
+        };
+
+        void * SynetConvolution16bInit(size_t batch, const SimdConvolutionParameters * conv);
+    }
+#endif//SIMD_AVX512BF16_ENABLE
+}
+
+#endif//__SimdSynetConvolution16b_h__
@@ -60,6 +60,17 @@ namespace Simd
                 srcT == SimdTensorData32f && dstT == SimdTensorData32f && srcF == dstF && (srcF == SimdTensorFormatNchw || srcF == SimdTensorFormatNhwc);
         }
 
+        bool Reshape(size_t srcH, size_t srcW)
+        {
+            if (srcH + padY + padH < dilationY * (kernelY - 1) + 1 || srcW + padX + padW < dilationX * (kernelX - 1) + 1)
+                return false;
+            this->srcH = srcH;
+            this->srcW = srcW;
+            this->dstH = (srcH + padY + padH - (dilationY * (kernelY - 1) + 1)) / strideY + 1;
+            this->dstW = (srcW + padX + padW - (dilationX * (kernelX - 1) + 1)) / strideX + 1;
+            return Valid();
+        }
+
         SIMD_INLINE bool IsKernel(size_t value) const
         {
             return kernelY == value && kernelX == value;
@@ -194,6 +205,11 @@ namespace Simd
 
         virtual void Forward(const float * src, float * buf, float * dst) = 0;
 
+        virtual bool Reshape(size_t srcH, size_t srcW)
+        {
+            return false;
+        }
+
         float * Buffer(float * buffer)
         {
             if (buffer)
@@ -214,6 +230,20 @@ namespace Simd
         typedef void(*NhwcRun)(size_t M, size_t N, size_t K, const float * A, const float * B, float * C, GemmKernelType type, bool compatibility);
         typedef void(*BiasAndActivation)(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, SimdBool trans, float * dst);
 
+        bool ReshapeParam(size_t srcH, size_t srcW)
+        {
+            ConvParam32f param = _param;
+            if (!param.Reshape(srcH, srcW))
+                return false;
+            _param = param;
+#if defined(SIMD_PERFORMANCE_STATISTIC)
+            _perf = NULL;
+#endif
+            _gemm.Reset();
+            _gemmCb.Reset();
+            return true;
+        }
+
         ConvParam32f _param;
         Array32f _buffer;
         float _0, _1;
@@ -242,11 +272,13 @@ namespace Simd
             virtual size_t ExternalBufferSize() const;
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual bool Reshape(size_t srcH, size_t srcW);
 
         protected:
             virtual void ImgToCol(const float * src, float * dst);
             virtual void ImgToRow(const float * src, float * dst);
             bool GemmRuntime() const;
+            void SetSize();
 
             bool _skipConv;
             size_t _M, _N, _K, _ldW, _ldS, _ldD, _grW, _grS, _grD, _batch, _sizeS, _sizeB, _sizeD, _merge;
@@ -279,6 +311,7 @@ namespace Simd
             virtual size_t InternalBufferSize() const;
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual bool Reshape(size_t srcH, size_t srcW);
 
             static bool Preferable(const ConvParam32f & p);
 
@@ -332,6 +365,7 @@ namespace Simd
             virtual String Ext() const { return "Base"; }
             virtual String Desc() const { return Ext() + "::DirectNhwc"; }
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual bool Reshape(size_t srcH, size_t srcW);
 
             static bool Preferable(const ConvParam32f & p);
 
@@ -368,6 +402,7 @@ namespace Simd
             virtual size_t InternalBufferSize() const;
             virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
             virtual void Forward(const float * src, float * buf, float * dst);
+            virtual bool Reshape(size_t srcH, size_t srcW);
 
             static bool Preferable(const ConvParam32f & p);
 
@@ -445,9 +480,87 @@ namespace Simd
 #endif
 
             void SetAlgParam(size_t F, size_t N, AlgParam & alg);
+            void SetMacroH(AlgParam & alg);
             void ReorderWeight(const float* src, float* dst);
         };
 
+        //---------------------------------------------------------------------
+
+        class SynetConvolution32fSparse : public SynetConvolution32f
+        {
+        public:
+            SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense);
+            virtual ~SynetConvolution32fSparse();
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual size_t InternalBufferSize() const;
+            virtual void SetParams(const float * weight, SimdBool * internal, const float * bias, const float * params);
+            virtual void Forward(const float * src, float * buf, float * dst);
+            virtual bool Reshape(size_t srcH, size_t srcW);
+
+            static bool Preferable(const ConvParam32f & p);
+
+            typedef void(*SparseGemmPtr)(size_t M, size_t N, const int32_t * rows, const int32_t * cols, const float * values, const float * src, size_t srcStride, float * dst, size_t dstStride);
+            typedef void(*TransposePtr)(const float * src, size_t srcStride, size_t rows, size_t cols, float * dst, size_t dstStride);
+
+        protected:
+            size_t TileSize() const;
+
+            SynetConvolution32f * _dense;
+            bool _sparse;
+            float _sparsity;
+            size_t _F, _sizeS, _sizeD;
+            Array32i _rows, _cols;
+            Array32f _values;
+            std::vector<Array32f> _threadBuffers;
+            SparseGemmPtr _sparseGemm;
+            TransposePtr _transpose;
+        };
+
+        //---------------------------------------------------------------------
+
+        SimdSynetTuningType SynetTuning();
+        void SetSynetTuning(SimdSynetTuningType tuning);
+        bool SynetTuningLoad(const char * path);
+        bool SynetTuningSave(const char * path);
+
+        class SynetConvolution32fCandidates
+        {
+        public:
+            SynetConvolution32fCandidates(const ConvParam32f & p, const char * ext)
+                : _param(p)
+                , _ext(ext)
+            {
+            }
+
+            template<class T> SIMD_INLINE void Add(const char * name)
+            {
+                _candidates.push_back(Candidate(name, Create<T>));
+            }
+
+            void * Select() const;
+
+        private:
+            typedef SynetConvolution32f * (*CreatePtr)(const ConvParam32f & p);
+
+            template<class T> static SynetConvolution32f * Create(const ConvParam32f & p)
+            {
+                return new T(p);
+            }
+
+            struct Candidate
+            {
+                String name;
+                CreatePtr create;
+                Candidate(const char * n, CreatePtr c) : name(n), create(c) {}
+            };
+
+            ConvParam32f _param;
+            String _ext;
+            std::vector<Candidate> _candidates;
+        };
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
     }
 
@@ -609,6 +722,8 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
+        void ConvolutionBiasAndActivation(const float * bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float * params, ::SimdBool trans, float * dst);
+
         void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C);
         void NhwcReorderB(size_t M, size_t N, size_t K, const float * B, float * pB);
         size_t NhwcBufferSize(size_t M, size_t N, size_t K);
@@ -618,9 +733,12 @@ namespace Simd
         public:
             SynetConvolution32fGemmNN(const ConvParam32f & p);
             virtual String Ext() const { return "Avx2"; }
+            virtual bool Reshape(size_t srcH, size_t srcW);
         protected:
             virtual void ImgToCol(const float * src, float * dst);
         private:
+            void SetEdges();
+
             Array32i _index, _nose, _tail, _start;
         };
 
@@ -668,6 +786,13 @@ namespace Simd
             static bool Set3r(const ConvParam32f& p, AlgParam& a);
         };
 
+        class SynetConvolution32fSparse : public Base::SynetConvolution32fSparse
+        {
+        public:
+            SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense);
+            virtual String Ext() const { return "Avx2"; }
+        };
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
     }
 #endif//SIMD_AVX2_ENABLE
@@ -682,9 +807,12 @@ namespace Simd
         public:
             SynetConvolution32fGemmNN(const ConvParam32f & p);
             virtual String Ext() const { return "Avx512f"; }
+            virtual bool Reshape(size_t srcH, size_t srcW);
         protected:
             virtual void ImgToCol(const float * src, float * dst);
         private:
+            void SetEdges();
+
             Array32i _index;
             Array16u _nose, _tail;
         };
@@ -701,6 +829,9 @@ namespace Simd
         public:
             SynetConvolution32fWinograd(const ConvParam32f & p);
             virtual String Ext() const { return "Avx512f"; }
+
+        protected:
+            static bool Block6x6Preferable(const ConvParam32f & p);
         };
 
         class SynetConvolution32fDirectNchw : public Avx2::SynetConvolution32fDirectNchw
@@ -736,6 +867,13 @@ namespace Simd
             static bool Set3r(const ConvParam32f& p, AlgParam& a);
         };
 
+        class SynetConvolution32fSparse : public Avx2::SynetConvolution32fSparse
+        {
+        public:
+            SynetConvolution32fSparse(const ConvParam32f & p, SynetConvolution32f * dense);
+            virtual String Ext() const { return "Avx512f"; }
+        };
+
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm);
     }
 #endif//SIMD_AVX512F_ENABLE
@@ -27,6 +27,8 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPerformance.h"
 
+#include <vector>
+
 #ifdef _N
 #undef _N
 #endif
@@ -60,6 +62,17 @@ namespace Simd
                 srcF == dstF && (srcF == SimdTensorFormatNchw || srcF == SimdTensorFormatNhwc);
         }
 
+        bool Reshape(size_t srcH, size_t srcW)
+        {
+            if (srcH + padY + padH < dilationY * (kernelY - 1) + 1 || srcW + padX + padW < dilationX * (kernelX - 1) + 1)
+                return false;
+            this->srcH = srcH;
+            this->srcW = srcW;
+            this->dstH = (srcH + padY + padH - (dilationY * (kernelY - 1) + 1)) / strideY + 1;
+            this->dstW = (srcW + padX + padW - (dilationX * (kernelX - 1) + 1)) / strideX + 1;
+            return Valid();
+        }
+
         SIMD_INLINE bool IsKernel(size_t value) const
         {
             return kernelY == value && kernelX == value;
@@ -169,6 +182,8 @@ namespace Simd
 
         virtual void Forward(const uint8_t * src, uint8_t * buf, uint8_t * dst);
 
+        virtual bool Reshape(size_t srcH, size_t srcW);
+
 #if defined(SIMD_PERFORMANCE_STATISTIC)
         Base::PerformanceMeasurer* Perf(const char* func);
 #endif
@@ -176,6 +191,8 @@ namespace Simd
     protected:
         virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst) = 0;
 
+        bool ReshapeParam(size_t srcH, size_t srcW);
+
         typedef void(*Convert32fTo8u)(const float* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, uint8_t* dst, SimdSynetCompatibilityType compatibility);
 
         ConvParam8i _param;
@@ -200,10 +217,13 @@ namespace Simd
             virtual String Ext() const { return "Base"; }
             virtual String Desc() const { return Ext() + "::GemmNN"; }
             virtual size_t ExternalBufferSize() const;
+            virtual bool Reshape(size_t srcH, size_t srcW);
 
         protected:
             virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
 
+            void SetSize();
+
             bool _skipConv;
             size_t _ldW, _ldS, _ldD, _grW, _grS, _grD, _siC, _siK, _siS, _siD, _sizeB;
         };
@@ -217,6 +237,7 @@ namespace Simd
             virtual size_t InternalBufferSize() const;
             virtual size_t ExternalBufferSize() const;
             virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
+            virtual bool Reshape(size_t srcH, size_t srcW);
 
             static bool Preferable(const ConvParam8i& p);
         
@@ -234,7 +255,7 @@ namespace Simd
             void ReorderWeight();
 
             virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
-            void Forward8u(const uint8_t* src, int32_t* buf, uint8_t* dst);
+            void Forward8u(const ConvParam8i& p, size_t batch, const uint8_t* src, int32_t* buf, uint8_t* dst);
 
             AlgParam _alg;
             ConvolutionPtr _convolutions[6];
@@ -247,6 +268,7 @@ namespace Simd
             virtual String Ext() const { return "Base"; }
             virtual String Desc() const;
             virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
+            virtual bool Reshape(size_t srcH, size_t srcW);
 
             static bool Preferable(const ConvParam8i& p);
 
@@ -266,6 +288,45 @@ namespace Simd
             ConvolutionPtr _convolution;
         };
 
+        class SynetConvolution8iNhwcWinograd : public SynetConvolution8i
+        {
+        public:
+            SynetConvolution8iNhwcWinograd(const ConvParam8i& p);
+            virtual String Ext() const { return "Base"; }
+            virtual String Desc() const;
+            virtual size_t InternalBufferSize() const;
+            virtual size_t ExternalBufferSize() const;
+            virtual void SetParams(const float* weight, const float* bias, const float* params, const float* const* stats);
+            virtual bool Reshape(size_t srcH, size_t srcW);
+
+            static bool Preferable(const ConvParam8i& p);
+
+            struct AlgParam
+            {
+                size_t F, tileH, tileW, tileHs, srcC, dstC, strideS, strideD;
+                int32_t size, lower, upper;
+            };
+
+            typedef void(*SetInputPtr)(const uint8_t* src, const ConvParam8i& p, const AlgParam& a, size_t tileY, size_t tileE, uint8_t zero, int16_t* dst);
+            typedef void(*GemmPtr)(size_t M, size_t N, size_t K, const int16_t* src, const int16_t* weight, int32_t* dst);
+            typedef void(*SetOutputPtr)(const int32_t* src, const ConvParam8i& p, const AlgParam& a, size_t tileY, size_t tileE,
+                const float* norm, const float* bias, const float* params, const float* scale, const float* shift, uint8_t* dst);
+
+        protected:
+            void SetAlgParam(size_t F, size_t L2);
+            void SetWeight();
+            size_t ThreadBufferSize() const;
+
+            virtual void Forward8u(const uint8_t* src, uint8_t* buf, uint8_t* dst);
+
+            AlgParam _alg;
+            Array16i _winogradWeight;
+            std::vector<Array8u> _threadBuffers;
+            SetInputPtr _setInput;
+            GemmPtr _gemm;
+            SetOutputPtr _setOutput;
+        };
+
         void * SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility);
     }
 
@@ -315,6 +376,14 @@ namespace Simd
             virtual String Ext() const { return "Avx2"; }
         };
 
+        class SynetConvolution8iNhwcWinograd : public Base::SynetConvolution8iNhwcWinograd
+        {
+        public:
+            SynetConvolution8iNhwcWinograd(const ConvParam8i& p);
+
+            virtual String Ext() const { return "Avx2"; }
+        };
+
         void* SynetConvolution8iInit(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility);
     }
 #endif
@@ -0,0 +1,751 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetNetwork_hpp__
+#define __SimdSynetNetwork_hpp__
+
+#include "Simd/SimdAllocator.hpp"
+
+#include <string.h>
+#include <vector>
+#include <algorithm>
+
+namespace Simd
+{
+    /*! @ingroup cpp_synet_network
+
+        \short Describes type of layer of Simd::SynetNetwork.
+    */
+    enum SynetLayerType
+    {
+        SynetLayerConvolution, /*!< Convolution (see ::SimdSynetConvolution32fInit). */
+        SynetLayerPooling, /*!< Max or average pooling (see ::SimdSynetPoolingForwardMax32f and ::SimdSynetPoolingForwardAverage). */
+        SynetLayerEltwise, /*!< Elementwise operation (see ::SimdSynetEltwiseLayerForward). */
+        SynetLayerScale, /*!< Per channel scale and bias (see ::SimdSynetScaleLayerForward). */
+        SynetLayerActivation, /*!< Activation function (see ::SimdConvolutionActivationType). */
+        SynetLayerSoftmax, /*!< Softmax along channel dimension (see ::SimdSynetSoftmaxLayerForward). */
+    };
+
+    /*! @ingroup cpp_synet_network
+
+        \short Describes layer of Simd::SynetNetwork.
+
+        Inputs of layer are referenced by tensor index: 0 is input of the network, i + 1 is output of i-th layer.
+        Pointers to weights and other parameters must be valid while the network is used.
+    */
+    struct SynetLayer
+    {
+        SynetLayerType type; /*!< \brief A type of the layer. */
+        std::vector<size_t> src; /*!< \brief Indices of input tensors. If it is empty then output of previous layer is used. */
+
+        SimdConvolutionParameters conv; /*!< \brief Convolution parameters (for ::SynetLayerConvolution). */
+        const float * weight; /*!< \brief Convolution weights (for ::SynetLayerConvolution). */
+        const float * scale; /*!< \brief Scale coefficients (for ::SynetLayerScale). */
+        const float * bias; /*!< \brief Bias (for ::SynetLayerConvolution and ::SynetLayerScale). Can be NULL. */
+        const float * params; /*!< \brief Parameters of activation function (for ::SynetLayerConvolution and ::SynetLayerActivation). */
+
+        SimdConvolutionActivationType activation; /*!< \brief A type of activation function (for ::SynetLayerActivation). */
+
+        bool max; /*!< \brief Max or average pooling (for ::SynetLayerPooling). */
+        bool excludePad; /*!< \brief Exclude pad from average value (for ::SynetLayerPooling). */
+        size_t kernelY, kernelX, strideY, strideX, padY, padX, padH, padW; /*!< \brief Pooling geometry (for ::SynetLayerPooling). */
+
+        SimdSynetEltwiseOperationType operation; /*!< \brief Elementwise operation (for ::SynetLayerEltwise). */
+        std::vector<float> coefficients; /*!< \brief Coefficients of weighted sum (for ::SynetLayerEltwise). Empty means unit coefficients. */
+
+        SynetLayer(SynetLayerType t = SynetLayerActivation)
+            : type(t), weight(NULL), scale(NULL), bias(NULL), params(NULL), activation(SimdConvolutionActivationIdentity)
+            , max(true), excludePad(true), kernelY(1), kernelX(1), strideY(1), strideX(1), padY(0), padX(0), padH(0), padW(0)
+            , operation(SimdSynetEltwiseOperationSum)
+        {
+            memset(&conv, 0, sizeof(conv));
+        }
+
+        /*!
+            Creates convolution layer.
+
+            \param [in] conv - convolution parameters. Source and destination tensors must be 32-bit float and have format of the network.
+            \param [in] weight - a pointer to convolution weights.
+            \param [in] bias - a pointer to bias. Can be NULL.
+            \param [in] params - a pointer to parameters of activation function. Can be NULL.
+            \param [in] src - an index of input tensor. By default it is output of previous layer.
+            \return convolution layer.
+        */
+        static SynetLayer Convolution(const SimdConvolutionParameters & conv, const float * weight, const float * bias, const float * params, size_t src = -1)
+        {
+            SynetLayer layer(SynetLayerConvolution);
+            layer.conv = conv;
+            layer.weight = weight;
+            layer.bias = bias;
+            layer.params = params;
+            layer.SetSrc(src);
+            return layer;
+        }
+
+        /*!
+            Creates pooling layer.
+
+            \param [in] max - max (true) or average (false) pooling.
+            \param [in] kernel - a size of pooling kernel.
+            \param [in] stride - a stride of pooling.
+            \param [in] pad - a pad at the begin (and at the end) of input.
+            \param [in] src - an index of input tensor. By default it is output of previous layer.
+            \return pooling layer.
+        */
+        static SynetLayer Pooling(bool max, size_t kernel, size_t stride, size_t pad = 0, size_t src = -1)
+        {
+            SynetLayer layer(SynetLayerPooling);
+            layer.max = max;
+            layer.kernelY = kernel, layer.kernelX = kernel;
+            layer.strideY = stride, layer.strideX = stride;
+            layer.padY = pad, layer.padX = pad, layer.padH = pad, layer.padW = pad;
+            layer.SetSrc(src);
+            return layer;
+        }
+
+        /*!
+            Creates elementwise layer.
+
+            \param [in] operation - a type of elementwise operation.
+            \param [in] src - indices of input tensors (at least 2).
+            \param [in] coefficients - coefficients of weighted sum. Empty means unit coefficients.
+            \return elementwise layer.
+        */
+        static SynetLayer Eltwise(SimdSynetEltwiseOperationType operation, const std::vector<size_t> & src, const std::vector<float> & coefficients = std::vector<float>())
+        {
+            SynetLayer layer(SynetLayerEltwise);
+            layer.operation = operation;
+            layer.src = src;
+            layer.coefficients = coefficients;
+            return layer;
+        }
+
+        /*!
+            Creates scale layer.
+
+            \param [in] scale - a pointer to scale coefficients.
+            \param [in] bias - a pointer to bias. Can be NULL.
+            \param [in] src - an index of input tensor. By default it is output of previous layer.
+            \return scale layer.
+        */
+        static SynetLayer Scale(const float * scale, const float * bias, size_t src = -1)
+        {
+            SynetLayer layer(SynetLayerScale);
+            layer.scale = scale;
+            layer.bias = bias;
+            layer.SetSrc(src);
+            return layer;
+        }
+
+        /*!
+            Creates activation layer.
+
+            \param [in] activation - a type of activation function.
+            \param [in] params - a pointer to parameters of activation function (see ::SimdConvolutionActivationType). Can be NULL for ReLU.
+            \param [in] src - an index of input tensor. By default it is output of previous layer.
+            \return activation layer.
+        */
+        static SynetLayer Activation(SimdConvolutionActivationType activation, const float * params = NULL, size_t src = -1)
+        {
+            SynetLayer layer(SynetLayerActivation);
+            layer.activation = activation;
+            layer.params = params;
+            layer.SetSrc(src);
+            return layer;
+        }
+
+        /*!
+            Creates softmax layer (along channel dimension).
+
+            \param [in] src - an index of input tensor. By default it is output of previous layer.
+            \return softmax layer.
+        */
+        static SynetLayer Softmax(size_t src = -1)
+        {
+            SynetLayer layer(SynetLayerSoftmax);
+            layer.SetSrc(src);
+            return layer;
+        }
+
+    private:
+        void SetSrc(size_t index)
+        {
+            if (index != size_t(-1))
+                src.assign(1, index);
+        }
+    };
+
+    /*! @ingroup cpp_synet_network
+
+        \short Small inference runtime for a graph of FP32 Synet layers.
+
+        It takes a sequence of layer descriptors, fuses eligible neighbouring layers and places all intermediate tensors in one memory arena.
+        Fusions:
+            - convolution chains (1x1/3x3 + depthwise + 1x1, 1x1/3x3 + depthwise, depthwise + 1x1) are replaced by merged convolution (NHWC only);
+            - a merged chain followed by sum with the chain input is executed as merged convolution with addition;
+            - convolution (or merged convolution with addition) followed by activation gets this activation as its own;
+            - scale followed by ReLU or Leaky ReLU is executed by ::SimdSynetFusedLayerForward2.
+        Tensors which have disjoint lifetimes share the same memory (greedy by size placement).
+
+        Using example:
+        \code
+        #include "Simd/SimdSynetNetwork.hpp"
+
+        std::vector<Simd::SynetLayer> layers;
+        layers.push_back(Simd::SynetLayer::Convolution(conv0, weight0, bias0, NULL));
+        layers.push_back(Simd::SynetLayer::Activation(SimdConvolutionActivationRelu));
+        layers.push_back(Simd::SynetLayer::Pooling(true, 2, 2));
+        layers.push_back(Simd::SynetLayer::Softmax());
+
+        Simd::SynetNetwork network;
+        if (network.Init(1, 3, 224, 224, SimdTensorFormatNhwc, layers))
+            network.Forward(src, dst);
+        \endcode
+    */
+    class SynetNetwork
+    {
+    public:
+        SynetNetwork()
+            : _format(SimdTensorFormatUnknown)
+            , _bufferOffset(0)
+        {
+        }
+
+        ~SynetNetwork()
+        {
+            Clear();
+        }
+
+        SynetNetwork(const SynetNetwork &) = delete;
+        SynetNetwork & operator = (const SynetNetwork &) = delete;
+
+        /*!
+            Initializes the network.
+
+            \param [in] batch - a batch size.
+            \param [in] channels - a number of channels of input tensor.
+            \param [in] height - a height of input tensor.
+            \param [in] width - a width of input tensor.
+            \param [in] format - a format of all tensors (::SimdTensorFormatNchw or ::SimdTensorFormatNhwc).
+            \param [in] layers - a sequence of layers. Output of the last layer is output of the network.
+            \param [in] fuse - a flag to fuse neighbouring layers.
+            \return a result of the initialization.
+        */
+        bool Init(size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const std::vector<SynetLayer> & layers, bool fuse = true)
+        {
+            Clear();
+            if (layers.empty() || batch == 0 || (format != SimdTensorFormatNchw && format != SimdTensorFormatNhwc))
+                return false;
+            _format = format;
+            _layers = layers;
+            _tensors.resize(layers.size() + 1);
+            _tensors[0].Set(batch, channels, height, width);
+            for (size_t i = 0; i < _layers.size(); ++i)
+            {
+                if (_layers[i].src.empty())
+                    _layers[i].src.assign(1, i);
+                if (!InferShape(i))
+                    return Clear();
+            }
+            for (size_t i = 0; i < _layers.size(); ++i)
+                for (size_t j = 0; j < _layers[i].src.size(); ++j)
+                    _tensors[_layers[i].src[j]].users++;
+            std::vector<bool> done(_layers.size(), false);
+            for (size_t i = 0; i < _layers.size(); ++i)
+            {
+                if (done[i])
+                    continue;
+                Stage stage;
+                size_t used = fuse ? Fuse(i, stage) : 0;
+                if (used == 0)
+                {
+                    stage = Stage(i, _layers[i].type);
+                    used = 1;
+                    if (!Create(stage))
+                        return Clear();
+                }
+                for (size_t j = 0; j < used; ++j)
+                    done[i + j] = true;
+                _stages.push_back(stage);
+            }
+            Plan();
+            return true;
+        }
+
+        /*!
+            Performs forward propagation of the network.
+
+            \param [in] src - a pointer to input tensor.
+            \param [out] dst - a pointer to output tensor. It must not overlap with input tensor.
+        */
+        void Forward(const float * src, float * dst)
+        {
+            _tensors[0].data = (float*)src;
+            _tensors.back().data = dst;
+            for (size_t i = 1; i + 1 < _tensors.size(); ++i)
+                _tensors[i].data = _tensors[i].users ? _arena.data() + _tensors[i].offset : NULL;
+            float * buf = _arena.data() + _bufferOffset;
+            for (size_t i = 0; i < _stages.size(); ++i)
+                Forward(_stages[i], buf);
+        }
+
+        /*!
+            Gets size of output tensor of the network.
+
+            \return size of output tensor (in 32-bit floats).
+        */
+        size_t DstSize() const
+        {
+            return _tensors.empty() ? 0 : _tensors.back().size;
+        }
+
+        /*!
+            Gets size of memory arena which contains all intermediate tensors and temporary buffers.
+
+            \return size of memory arena (in 32-bit floats).
+        */
+        size_t ArenaSize() const
+        {
+            return _arena.size();
+        }
+
+        /*!
+            Gets number of executed stages (after fusion of layers).
+
+            \return number of stages.
+        */
+        size_t StageNumber() const
+        {
+            return _stages.size();
+        }
+
+    private:
+        typedef std::vector<float, Allocator<float>> Vector;
+
+        struct Tensor
+        {
+            size_t batch, channels, height, width, size, users, begin, end, offset;
+            float * data;
+
+            void Set(size_t b, size_t c, size_t h, size_t w)
+            {
+                batch = b, channels = c, height = h, width = w;
+                size = b * c * h * w;
+                users = 0, begin = 0, end = 0, offset = 0;
+                data = NULL;
+            }
+        };
+
+        enum StageType
+        {
+            StageConvolution = SynetLayerConvolution,
+            StagePooling = SynetLayerPooling,
+            StageEltwise = SynetLayerEltwise,
+            StageScale = SynetLayerScale,
+            StageActivation = SynetLayerActivation,
+            StageSoftmax = SynetLayerSoftmax,
+            StageMergedConvolution,
+            StageScaleRelu,
+        };
+
+        struct Stage
+        {
+            StageType type;
+            size_t layer, dst;
+            std::vector<size_t> src;
+            void * context;
+            float slope;
+
+            Stage(size_t l = 0, SynetLayerType t = SynetLayerActivation)
+                : type(StageType(t)), layer(l), dst(l + 1), context(NULL), slope(0.0f)
+            {
+            }
+        };
+
+        SimdTensorFormatType _format;
+        std::vector<SynetLayer> _layers;
+        std::vector<Tensor> _tensors;
+        std::vector<Stage> _stages;
+        std::vector<float> _zero;
+        Vector _arena;
+        size_t _bufferOffset;
+
+        bool Clear()
+        {
+            for (size_t i = 0; i < _stages.size(); ++i)
+                if (_stages[i].context)
+                    SimdRelease(_stages[i].context);
+            _stages.clear();
+            _tensors.clear();
+            _layers.clear();
+            _arena.clear();
+            _zero.clear();
+            _bufferOffset = 0;
+            return false;
+        }
+
+        bool InferShape(size_t index)
+        {
+            SynetLayer & l = _layers[index];
+            for (size_t i = 0; i < l.src.size(); ++i)
+                if (l.src[i] > index)
+                    return false;
+            const Tensor & s = _tensors[l.src[0]];
+            Tensor & d = _tensors[index + 1];
+            switch (l.type)
+            {
+            case SynetLayerConvolution:
+            {
+                const SimdConvolutionParameters & c = l.conv;
+                if (c.srcC != s.channels || c.srcH != s.height || c.srcW != s.width || l.weight == NULL)
+                    return false;
+                if (c.srcF != _format || c.dstF != _format || c.srcT != SimdTensorData32f || c.dstT != SimdTensorData32f)
+                    return false;
+                d.Set(s.batch, c.dstC, c.dstH, c.dstW);
+                return true;
+            }
+            case SynetLayerPooling:
+            {
+                if (l.kernelY == 0 || l.kernelX == 0 || l.strideY == 0 || l.strideX == 0 || 
+                    s.height + l.padY + l.padH < l.kernelY || s.width + l.padX + l.padW < l.kernelX)
+                    return false;
+                d.Set(s.batch, s.channels, (s.height + l.padY + l.padH - l.kernelY) / l.strideY + 1, (s.width + l.padX + l.padW - l.kernelX) / l.strideX + 1);
+                return true;
+            }
+            case SynetLayerEltwise:
+            {
+                if (l.src.size() < 2 || (l.coefficients.size() && l.coefficients.size() != l.src.size()))
+                    return false;
+                for (size_t i = 1; i < l.src.size(); ++i)
+                    if (_tensors[l.src[i]].size != s.size)
+                        return false;
+                if (l.operation == SimdSynetEltwiseOperationSum && l.coefficients.empty())
+                    l.coefficients.assign(l.src.size(), 1.0f);
+                d.Set(s.batch, s.channels, s.height, s.width);
+                return true;
+            }
+            case SynetLayerScale:
+            {
+                if (l.scale == NULL)
+                    return false;
+                d.Set(s.batch, s.channels, s.height, s.width);
+                return true;
+            }
+            case SynetLayerActivation:
+            {
+                if (l.activation != SimdConvolutionActivationIdentity && l.activation != SimdConvolutionActivationRelu && l.params == NULL)
+                    return false;
+                d.Set(s.batch, s.channels, s.height, s.width);
+                return true;
+            }
+            case SynetLayerSoftmax:
+            {
+                d.Set(s.batch, s.channels, s.height, s.width);
+                return true;
+            }
+            default:
+                return false;
+            }
+        }
+
+        bool Single(size_t layer, SynetLayerType type) const
+        {
+            return layer < _layers.size() && _layers[layer].type == type && _tensors[layer].users == 1 && 
+                _layers[layer].src.size() == 1 && _layers[layer].src[0] == layer;
+        }
+
+        static bool Depthwise(const SimdConvolutionParameters & c)
+        {
+            return c.group != 1 && c.group == c.srcC && c.group == c.dstC;
+        }
+
+        size_t Fuse(size_t index, Stage & stage)
+        {
+            const SynetLayer & l = _layers[index];
+            if (l.type == SynetLayerConvolution)
+            {
+                size_t used = FuseMerged(index, stage);
+                if (used)
+                    return used;
+                if (l.conv.activation == SimdConvolutionActivationIdentity && Single(index + 1, SynetLayerActivation))
+                {
+                    stage = Stage(index, SynetLayerConvolution);
+                    stage.dst = index + 2;
+                    if (Create(stage, &_layers[index + 1]))
+                        return 2;
+                }
+            }
+            if (l.type == SynetLayerScale && Single(index + 1, SynetLayerActivation))
+            {
+                const SynetLayer & a = _layers[index + 1];
+                if (a.activation == SimdConvolutionActivationRelu || a.activation == SimdConvolutionActivationLeakyRelu)
+                {
+                    stage = Stage(index, SynetLayerScale);
+                    stage.type = StageScaleRelu;
+                    stage.dst = index + 2;
+                    stage.slope = a.activation == SimdConvolutionActivationRelu ? 0.0f : a.params[0];
+                    if (l.bias == NULL && _zero.size() < _tensors[index + 1].channels)
+                        _zero.resize(_tensors[index + 1].channels, 0.0f);
+                    return 2;
+                }
+            }
+            return 0;
+        }
+
+        size_t FuseMerged(size_t index, Stage & stage)
+        {
+            if (_format != SimdTensorFormatNhwc)
+                return 0;
+            size_t count = 0;
+            const SimdConvolutionParameters & c0 = _layers[index].conv;
+            if (Single(index + 1, SynetLayerConvolution))
+            {
+                const SimdConvolutionParameters & c1 = _layers[index + 1].conv;
+                if (c0.group == 1 && Depthwise(c1))
+                {
+                    count = 2;
+                    if (Single(index + 2, SynetLayerConvolution) && _layers[index + 2].conv.group == 1 && _layers[index + 2].conv.kernelY == 1)
+                        count = 3;
+                }
+                else if (Depthwise(c0) && c1.group == 1 && c1.kernelY == 1)
+                    count = 2;
+            }
+            if (count == 0)
+                return 0;
+            SimdConvolutionParameters convs[3];
+            for (size_t i = 0; i < count; ++i)
+                convs[i] = _layers[index + i].conv;
+            size_t used = count, dst = index + count;
+            SimdBool add = SimdFalse;
+            if (count == 3 && convs[2].activation == SimdConvolutionActivationIdentity && _tensors[dst].users == 1 && dst < _layers.size())
+            {
+                const SynetLayer & e = _layers[dst];
+                if (e.type == SynetLayerEltwise && e.operation == SimdSynetEltwiseOperationSum && e.src.size() == 2 &&
+                    e.coefficients[0] == 1.0f && e.coefficients[1] == 1.0f && ((e.src[0] == dst && e.src[1] == _layers[index].src[0]) || 
+                    (e.src[1] == dst && e.src[0] == _layers[index].src[0])))
+                {
+                    add = SimdTrue;
+                    used++, dst++;
+                }
+            }
+            const float * params = _layers[index + count - 1].params;
+            if (convs[count - 1].activation == SimdConvolutionActivationIdentity && Single(dst, SynetLayerActivation))
+            {
+                convs[count - 1].activation = _layers[dst].activation;
+                params = _layers[dst].params;
+                used++, dst++;
+            }
+            stage = Stage(index, SynetLayerConvolution);
+            stage.type = StageMergedConvolution;
+            stage.dst = dst;
+            stage.context = SimdSynetMergedConvolution32fInit(_tensors[index].batch, convs, count, add);
+            if (stage.context == NULL)
+                return 0;
+            const float * weight[3], * bias[3], * param[3];
+            for (size_t i = 0; i < count; ++i)
+            {
+                weight[i] = _layers[index + i].weight;
+                bias[i] = _layers[index + i].bias;
+                param[i] = i == count - 1 ? params : _layers[index + i].params;
+            }
+            SimdSynetMergedConvolution32fSetParams(stage.context, weight, NULL, bias, param);
+            return used;
+        }
+
+        bool Create(Stage & stage, const SynetLayer * activation = NULL)
+        {
+            const SynetLayer & l = _layers[stage.layer];
+            stage.src = l.src;
+            if (stage.type == StageConvolution)
+            {
+                SimdConvolutionParameters conv = l.conv;
+                const float * params = l.params;
+                if (activation)
+                {
+                    conv.activation = activation->activation;
+                    params = activation->params;
+                }
+                stage.context = SimdSynetConvolution32fInit(_tensors[stage.layer + 1].batch, &conv, NULL);
+                if (stage.context == NULL)
+                    return false;
+                SimdSynetConvolution32fSetParams(stage.context, l.weight, NULL, l.bias, params);
+            }
+            return true;
+        }
+
+        void Plan()
+        {
+            for (size_t i = 0; i < _stages.size(); ++i)
+            {
+                Stage & s = _stages[i];
+                if (s.type == StageMergedConvolution || s.type == StageScaleRelu)
+                    s.src = _layers[s.layer].src;
+                for (size_t j = 0; j < s.src.size(); ++j)
+                    _tensors[s.src[j]].end = i + 1;
+                _tensors[s.dst].begin = i;
+                _tensors[s.dst].end = std::max(_tensors[s.dst].end, i + 1);
+            }
+            for (size_t i = 1; i < _tensors.size(); ++i)
+                _tensors[i].users = 0;
+            for (size_t i = 0; i < _stages.size(); ++i)
+            {
+                for (size_t j = 0; j < _stages[i].src.size(); ++j)
+                    _tensors[_stages[i].src[j]].users++;
+                _tensors[_stages[i].dst].users++;
+            }
+            const size_t align = SimdAlignment() / sizeof(float);
+            std::vector<size_t> order;
+            for (size_t i = 1; i + 1 < _tensors.size(); ++i)
+                if (_tensors[i].users)
+                    order.push_back(i);
+            std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) { return _tensors[a].size > _tensors[b].size; });
+            std::vector<size_t> placed;
+            size_t total = 0;
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                Tensor & t = _tensors[order[i]];
+                size_t size = (t.size + align - 1) / align * align, offset = 0;
+                for (bool moved = true; moved;)
+                {
+                    moved = false;
+                    for (size_t j = 0; j < placed.size(); ++j)
+                    {
+                        const Tensor & p = _tensors[placed[j]];
+                        bool alive = p.begin < t.end && t.begin < p.end;
+                        if (alive && offset < p.offset + p.size && p.offset < offset + size)
+                        {
+                            offset = (p.offset + p.size + align - 1) / align * align;
+                            moved = true;
+                        }
+                    }
+                }
+                t.offset = offset;
+                total = std::max(total, offset + size);
+                placed.push_back(order[i]);
+            }
+            size_t buffer = 0;
+            for (size_t i = 0; i < _stages.size(); ++i)
+            {
+                const Stage & s = _stages[i];
+                if (s.type == StageConvolution)
+                    buffer = std::max(buffer, SimdSynetConvolution32fExternalBufferSize(s.context));
+                if (s.type == StageMergedConvolution)
+                    buffer = std::max(buffer, SimdSynetMergedConvolution32fExternalBufferSize(s.context));
+            }
+            _bufferOffset = total;
+            _arena.resize(total + buffer + align);
+        }
+
+        void Forward(const Stage & stage, float * buf)
+        {
+            const SynetLayer & l = _layers[stage.layer];
+            const Tensor & s = _tensors[stage.src[0]];
+            Tensor & d = _tensors[stage.dst];
+            size_t spatial = s.height * s.width, size = s.channels * spatial;
+            switch (stage.type)
+            {
+            case StageConvolution:
+                SimdSynetConvolution32fForward(stage.context, s.data, buf, d.data);
+                break;
+            case StageMergedConvolution:
+                SimdSynetMergedConvolution32fForward(stage.context, s.data, buf, d.data);
+                break;
+            case StagePooling:
+                for (size_t b = 0; b < s.batch; ++b)
+                {
+                    const float * src = s.data + b * size;
+                    float * dst = d.data + b * d.channels * d.height * d.width;
+                    if (l.max)
+                        SimdSynetPoolingForwardMax32f(src, s.channels, s.height, s.width, l.kernelY, l.kernelX, l.strideY, l.strideX,
+                            l.padY, l.padX, dst, d.height, d.width, _format);
+                    else
+                        SimdSynetPoolingForwardAverage(src, s.channels, s.height, s.width, l.kernelY, l.kernelX, l.strideY, l.strideX,
+                            l.padY, l.padX, dst, d.height, d.width, l.excludePad ? SimdTrue : SimdFalse, _format);
+                }
+                break;
+            case StageEltwise:
+            {
+                std::vector<const float*> src(stage.src.size());
+                for (size_t i = 0; i < src.size(); ++i)
+                    src[i] = _tensors[stage.src[i]].data;
+                SimdSynetEltwiseLayerForward(src.data(), l.coefficients.empty() ? NULL : l.coefficients.data(), src.size(), s.size, l.operation, d.data);
+                break;
+            }
+            case StageScale:
+                for (size_t b = 0; b < s.batch; ++b)
+                    SimdSynetScaleLayerForward(s.data + b * size, l.scale, l.bias, s.channels, s.height, s.width, d.data + b * size, _format, SimdSynetCompatibilityFmaUse);
+                break;
+            case StageScaleRelu:
+                for (size_t b = 0; b < s.batch; ++b)
+                    SimdSynetFusedLayerForward2(s.data + b * size, l.scale, l.bias ? l.bias : _zero.data(), s.channels, spatial, &stage.slope, d.data + b * size, _format);
+                break;
+            case StageActivation:
+                Activate(l, s, d.data);
+                break;
+            case StageSoftmax:
+                if (_format == SimdTensorFormatNchw)
+                    SimdSynetSoftmaxLayerForward(s.data, s.batch, s.channels, spatial, d.data);
+                else
+                    SimdSynetSoftmaxLayerForward(s.data, s.batch * spatial, s.channels, 1, d.data);
+                break;
+            }
+        }
+
+        void Activate(const SynetLayer & l, const Tensor & s, float * dst)
+        {
+            const float * p = l.params;
+            float zero = 0.0f;
+            switch (l.activation)
+            {
+            case SimdConvolutionActivationIdentity:
+                if (dst != s.data)
+                    memcpy(dst, s.data, s.size * sizeof(float));
+                break;
+            case SimdConvolutionActivationRelu:
+                SimdSynetRelu32f(s.data, s.size, &zero, dst);
+                break;
+            case SimdConvolutionActivationLeakyRelu:
+                SimdSynetRelu32f(s.data, s.size, p, dst);
+                break;
+            case SimdConvolutionActivationRestrictRange:
+                SimdSynetRestrictRange32f(s.data, s.size, p + 0, p + 1, dst);
+                break;
+            case SimdConvolutionActivationPrelu:
+                for (size_t b = 0, size = s.size / s.batch; b < s.batch; ++b)
+                    SimdSynetPreluLayerForward(s.data + b * size, p, s.channels, s.height * s.width, dst + b * size, _format);
+                break;
+            case SimdConvolutionActivationElu:
+                SimdSynetElu32f(s.data, s.size, p, dst);
+                break;
+            case SimdConvolutionActivationHswish:
+                SimdSynetHswish32f(s.data, s.size, p + 0, p + 1, dst);
+                break;
+            case SimdConvolutionActivationMish:
+                SimdSynetMish32f(s.data, s.size, p, dst);
+                break;
+            }
+        }
+    };
+}
+
+#endif//__SimdSynetNetwork_hpp__
@@ -0,0 +1,113 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetYuvToTensor_h__
+#define __SimdSynetYuvToTensor_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMemory.h"
+
+namespace Simd
+{
+    struct YuvToTensorParam
+    {
+        size_t srcW, srcH, dstW, dstH;
+        SimdYuvLayoutType layout;
+        SimdPixelFormatType order;
+        SimdTensorFormatType format;
+        float mean[3], scale[3];
+
+        YuvToTensorParam(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH,
+            SimdPixelFormatType order, const float * mean, const float * scale, SimdTensorFormatType format)
+        {
+            this->srcW = srcW;
+            this->srcH = srcH;
+            this->layout = layout;
+            this->dstW = dstW;
+            this->dstH = dstH;
+            this->order = order;
+            this->format = format;
+            for (size_t c = 0; c < 3; ++c)
+            {
+                this->mean[c] = mean ? mean[c] : 0.0f;
+                this->scale[c] = scale ? scale[c] : 1.0f;
+            }
+        }
+
+        bool Valid() const
+        {
+            return srcW >= 2 && srcW % 2 == 0 && srcH >= 2 && srcH % 2 == 0 && dstW > 0 && dstH > 0 &&
+                (layout == SimdYuvLayout420p || layout == SimdYuvLayoutNv12) &&
+                (order == SimdPixelFormatBgr24 || order == SimdPixelFormatRgb24) &&
+                (format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc);
+        }
+    };
+
+    namespace Base
+    {
+        class SynetYuvToTensor : public Deletable
+        {
+        public:
+            SynetYuvToTensor(const YuvToTensorParam & param);
+
+            void Run(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, float * dst);
+
+        protected:
+            typedef void(*Yuv420pToBgrPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
+            typedef void(*DeinterleaveUvPtr)(const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
+            typedef void(*BlendRowsPtr)(const float * row0, const float * row1, float alpha, const float * scale, const float * shift, size_t size, float * dst);
+
+            YuvToTensorParam _param;
+            Array32i _ix, _iy;
+            Array32f _ax, _ay, _scale, _shift, _rows[2];
+            Array8u _bgr, _uv;
+            ptrdiff_t _rowY[2], _pairY;
+            size_t _stepX, _stepC;
+            Yuv420pToBgrPtr _yuv420pToBgr;
+            DeinterleaveUvPtr _deinterleaveUv;
+            BlendRowsPtr _blendRows;
+
+            void EstimateIndexAlpha(size_t srcSize, size_t dstSize, size_t step, int32_t * indices, float * alphas);
+            void SetRow(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, ptrdiff_t row, float * dst);
+        };
+
+        void * SynetYuvToTensorInit(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH,
+            SimdPixelFormatType order, const float * mean, const float * scale, SimdTensorFormatType format);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetYuvToTensor : public Base::SynetYuvToTensor
+        {
+        public:
+            SynetYuvToTensor(const YuvToTensorParam & param);
+        };
+
+        void * SynetYuvToTensorInit(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH,
+            SimdPixelFormatType order, const float * mean, const float * scale, SimdTensorFormatType format);
+    }
+#endif//SIMD_AVX2_ENABLE
+}
+#endif//__SimdSynetYuvToTensor_h__
@@ -0,0 +1,168 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdWarp_h__
+#define __SimdWarp_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    struct WarpParam
+    {
+        size_t srcW, srcH, dstW, dstH, channels, align;
+        SimdWarpFlags flags;
+        bool perspective, valid;
+        float inv[9];
+        uint8_t border[4];
+
+        WarpParam(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, bool perspective, SimdWarpFlags flags, const uint8_t * border, size_t align)
+        {
+            this->srcW = srcW;
+            this->srcH = srcH;
+            this->dstW = dstW;
+            this->dstH = dstH;
+            this->channels = channels;
+            this->align = align;
+            this->flags = flags;
+            this->perspective = perspective;
+            for (size_t c = 0; c < 4; ++c)
+                this->border[c] = border && c < channels ? border[c] : 0;
+            double m[9] = { mat[0], mat[1], mat[2], mat[3], mat[4], mat[5], 0.0, 0.0, 1.0 };
+            if (perspective)
+                m[6] = mat[6], m[7] = mat[7], m[8] = mat[8];
+            double det = m[0] * (m[4] * m[8] - m[5] * m[7]) - m[1] * (m[3] * m[8] - m[5] * m[6]) + m[2] * (m[3] * m[7] - m[4] * m[6]);
+            this->valid = det != 0.0 && channels >= 1 && channels <= 4 && srcW > 0 && srcH > 0;
+            double k = det != 0.0 ? 1.0 / det : 0.0;
+            inv[0] = float((m[4] * m[8] - m[5] * m[7]) * k);
+            inv[1] = float((m[2] * m[7] - m[1] * m[8]) * k);
+            inv[2] = float((m[1] * m[5] - m[2] * m[4]) * k);
+            inv[3] = float((m[5] * m[6] - m[3] * m[8]) * k);
+            inv[4] = float((m[0] * m[8] - m[2] * m[6]) * k);
+            inv[5] = float((m[2] * m[3] - m[0] * m[5]) * k);
+            inv[6] = float((m[3] * m[7] - m[4] * m[6]) * k);
+            inv[7] = float((m[1] * m[6] - m[0] * m[7]) * k);
+            inv[8] = float((m[0] * m[4] - m[1] * m[3]) * k);
+        }
+
+        bool IsNearest() const
+        {
+            return (flags & SimdWarpInterpMask) == SimdWarpInterpNearest;
+        }
+
+        bool IsBilinear() const
+        {
+            return (flags & SimdWarpInterpMask) == SimdWarpInterpBilinear;
+        }
+
+        SimdWarpFlags Border() const
+        {
+            return SimdWarpFlags(flags & SimdWarpBorderMask);
+        }
+    };
+
+    class Warp : Deletable
+    {
+    public:
+        Warp(const WarpParam & param)
+            : _param(param)
+        {
+        }
+
+        virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride) = 0;
+
+    protected:
+        WarpParam _param;
+    };
+
+    namespace Base
+    {
+        const int WARP_SHIFT = 8;
+        const int WARP_RANGE = 1 << WARP_SHIFT;
+        const int WARP_ROUND = 1 << (2 * WARP_SHIFT - 1);
+
+        class WarpByte : public Warp
+        {
+        public:
+            WarpByte(const WarpParam & param);
+
+            virtual void Run(const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
+
+        protected:
+            Array32f _ax, _ay, _aw, _cx, _cy, _cw;
+            Array32i _fx, _fy;
+            Array8u _in;
+
+            virtual void EstimateRow(size_t dy);
+            virtual void InterpolateRow(const uint8_t * src, size_t srcStride, uint8_t * dst);
+
+            void InterpolateBorder(const uint8_t * src, size_t srcStride, size_t dx, uint8_t * dst);
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+    }
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class WarpByte : public Base::WarpByte
+        {
+        public:
+            WarpByte(const WarpParam & param);
+
+        protected:
+            virtual void EstimateRow(size_t dy);
+            virtual void InterpolateRow(const uint8_t * src, size_t srcStride, uint8_t * dst);
+
+            template<size_t cn> void InterpolateRow(const uint8_t * src, size_t srcStride, bool transparent, uint8_t * dst);
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+    }
+#endif //SIMD_AVX2_ENABLE 
+
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        class WarpByte : public Avx2::WarpByte
+        {
+        public:
+            WarpByte(const WarpParam & param);
+
+        protected:
+            virtual void EstimateRow(size_t dy);
+            virtual void InterpolateRow(const uint8_t * src, size_t srcStride, uint8_t * dst);
+        };
+
+        void * WarpAffineInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+
+        void * WarpPerspectiveInit(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+    }
+#endif //SIMD_AVX512BW_ENABLE 
+}
+#endif//__SimdWarp_h__
@@ -544,6 +544,47 @@ namespace Simd
             dst[stride * 34] = r24 * t[15] - r12 * t[16] + r6 * t[17];
             dst[stride * 35] = t[17];
         }
+
+        //-----------------------------------------------------------------------
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetFilter3(const float * src, size_t srcStep, float * dst, size_t dstStep)
+        {
+            const float r2_9 = float(2.0f / 9.0f);
+            const float r1_90 = float(1.0f / 90.0f);
+            const float r1_45 = float(1.0f / 45.0f);
+            const float r2_45 = float(2.0f / 45.0f);
+            const float r32_45 = float(32.0f / 45.0f);
+            const float r16_45 = float(16.0f / 45.0f);
+            const float r8_45 = float(8.0f / 45.0f);
+            float s0 = src[0 * srcStep];
+            float s1 = src[1 * srcStep];
+            float s2 = src[2 * srcStep];
+            dst[0 * dstStep] = s0;
+            dst[1 * dstStep] = -r2_9 * (s0 + s1 + s2);
+            dst[2 * dstStep] = -r2_9 * (s0 - s1 + s2);
+            dst[3 * dstStep] = r1_90 * s0 + r1_45 * s1 + r2_45 * s2;
+            dst[4 * dstStep] = r1_90 * s0 - r1_45 * s1 + r2_45 * s2;
+            dst[5 * dstStep] = r32_45 * s0 + r16_45 * s1 + r8_45 * s2;
+            dst[6 * dstStep] = r32_45 * s0 - r16_45 * s1 + r8_45 * s2;
+            dst[7 * dstStep] = s2;
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetFilter1n(const float * src, float * dst, size_t stride)
+        {
+            float t[24];
+            for (size_t col = 0; col < 3; ++col)
+                WinogradKernel3x3Block6x6SetFilter3(src + col, 3, t + col, 3);
+            for (size_t row = 0; row < 8; ++row)
+                WinogradKernel3x3Block6x6SetFilter3(t + row * 3, 1, dst + row * 8 * stride, stride);
+        }
+
+        SIMD_INLINE void WinogradKernel3x3Block6x6SetFilter1t(const float * src, float * dst, size_t stride)
+        {
+            float s[9];
+            for (size_t i = 0; i < 9; ++i)
+                s[i] = src[i * stride];
+            WinogradKernel3x3Block6x6SetFilter1n(s, dst, stride);
+        }
     }
 }
 
@@ -0,0 +1,102 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdYuvToBgr_h__
+#define __SimdYuvToBgr_h__
+
+#include "Simd/SimdMath.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        /*
+        * Coefficients of conversion between YUV and BGR for given luma weights (KR and KB are given in 1/10000 units).
+        * Limited range: Y in [16..235], U and V in [16..240]. Full range: Y, U and V in [0..255].
+        */
+        template<int KR, int KB, bool FULL> struct YuvCoefficients
+        {
+            static const int Y_LO = FULL ? 0 : 16;
+            static const int UV_Z = 128;
+
+            static const int F_SHIFT = 13;
+            static const int F_ROUND = 1 << (F_SHIFT - 1);
+            static const int Y_TO_RGB = int((FULL ? 1.0 : 255.0 / 219.0) * (1 << F_SHIFT) + 0.5);
+            static const int V_TO_RED = int((FULL ? 1.0 : 255.0 / 224.0) * 2.0 * (1.0 - KR * 0.0001) * (1 << F_SHIFT) + 0.5);
+            static const int U_TO_BLUE = int((FULL ? 1.0 : 255.0 / 224.0) * 2.0 * (1.0 - KB * 0.0001) * (1 << F_SHIFT) + 0.5);
+            static const int U_TO_GREEN = -int((FULL ? 1.0 : 255.0 / 224.0) * 2.0 * (1.0 - KB * 0.0001) * KB / (10000 - KR - KB) * (1 << F_SHIFT) + 0.5);
+            static const int V_TO_GREEN = -int((FULL ? 1.0 : 255.0 / 224.0) * 2.0 * (1.0 - KR * 0.0001) * KR / (10000 - KR - KB) * (1 << F_SHIFT) + 0.5);
+
+            static const int B_SHIFT = 14;
+            static const int B_ROUND = 1 << (B_SHIFT - 1);
+            static const int RED_TO_Y = int((FULL ? 1.0 : 219.0 / 255.0) * KR * 0.0001 * (1 << B_SHIFT) + 0.5);
+            static const int GREEN_TO_Y = int((FULL ? 1.0 : 219.0 / 255.0) * (10000 - KR - KB) * 0.0001 * (1 << B_SHIFT) + 0.5);
+            static const int BLUE_TO_Y = int((FULL ? 1.0 : 219.0 / 255.0) * KB * 0.0001 * (1 << B_SHIFT) + 0.5);
+            static const int RED_TO_U = -int((FULL ? 1.0 : 224.0 / 255.0) * 0.5 * KR / (10000 - KB) * (1 << B_SHIFT) + 0.5);
+            static const int GREEN_TO_U = -int((FULL ? 1.0 : 224.0 / 255.0) * 0.5 * (10000 - KR - KB) / (10000 - KB) * (1 << B_SHIFT) + 0.5);
+            static const int BLUE_TO_U = int((FULL ? 1.0 : 224.0 / 255.0) * 0.5 * (1 << B_SHIFT) + 0.5);
+            static const int RED_TO_V = int((FULL ? 1.0 : 224.0 / 255.0) * 0.5 * (1 << B_SHIFT) + 0.5);
+            static const int GREEN_TO_V = -int((FULL ? 1.0 : 224.0 / 255.0) * 0.5 * (10000 - KR - KB) / (10000 - KR) * (1 << B_SHIFT) + 0.5);
+            static const int BLUE_TO_V = -int((FULL ? 1.0 : 224.0 / 255.0) * 0.5 * KB / (10000 - KR) * (1 << B_SHIFT) + 0.5);
+        };
+
+        typedef YuvCoefficients<2990, 1140, false> Bt601;
+        typedef YuvCoefficients<2126, 722, false> Bt709;
+        typedef YuvCoefficients<2627, 593, false> Bt2020;
+        typedef YuvCoefficients<2990, 1140, true> Bt601Full;
+        typedef YuvCoefficients<2126, 722, true> Bt709Full;
+        typedef YuvCoefficients<2627, 593, true> Bt2020Full;
+
+        template<class T> SIMD_INLINE int YuvToBlue(int y, int u)
+        {
+            return RestrictRange((T::Y_TO_RGB * (y - T::Y_LO) + T::U_TO_BLUE * (u - T::UV_Z) + T::F_ROUND) >> T::F_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE int YuvToGreen(int y, int u, int v)
+        {
+            return RestrictRange((T::Y_TO_RGB * (y - T::Y_LO) + T::U_TO_GREEN * (u - T::UV_Z) + 
+                T::V_TO_GREEN * (v - T::UV_Z) + T::F_ROUND) >> T::F_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE int YuvToRed(int y, int v)
+        {
+            return RestrictRange((T::Y_TO_RGB * (y - T::Y_LO) + T::V_TO_RED * (v - T::UV_Z) + T::F_ROUND) >> T::F_SHIFT);
+        }
+
+        template<class T> SIMD_INLINE int BgrToY(int blue, int green, int red)
+        {
+            return RestrictRange(((T::BLUE_TO_Y * blue + T::GREEN_TO_Y * green + T::RED_TO_Y * red + T::B_ROUND) >> T::B_SHIFT) + T::Y_LO);
+        }
+
+        template<class T> SIMD_INLINE int BgrToU(int blue, int green, int red)
+        {
+            return RestrictRange(((T::BLUE_TO_U * blue + T::GREEN_TO_U * green + T::RED_TO_U * red + T::B_ROUND) >> T::B_SHIFT) + T::UV_Z);
+        }
+
+        template<class T> SIMD_INLINE int BgrToV(int blue, int green, int red)
+        {
+            return RestrictRange(((T::BLUE_TO_V * blue + T::GREEN_TO_V * green + T::RED_TO_V * red + T::B_ROUND) >> T::B_SHIFT) + T::UV_Z);
+        }
+    }
+}
+#endif//__SimdYuvToBgr_h__
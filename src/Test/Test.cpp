@@ -81,9 +81,11 @@ namespace Test
     TEST_ADD_GROUP_AD0(AbsDifferenceSums3x3Masked);
     TEST_ADD_GROUP_AD0(SquaredDifferenceSum);
     TEST_ADD_GROUP_AD0(SquaredDifferenceSumMasked);
+    TEST_ADD_GROUP_A00(SquaredDifferenceSums);
     TEST_ADD_GROUP_AD0(SquaredDifferenceSum32f);
     TEST_ADD_GROUP_AD0(SquaredDifferenceKahanSum32f);
     TEST_ADD_GROUP_AD0(CosineDistance32f);
+    TEST_ADD_GROUP_A00(DistancesTopK);
 
     TEST_ADD_GROUP_AD0(AddFeatureDifference);
 
@@ -97,6 +99,9 @@ namespace Test
     TEST_ADD_GROUP_AD0(GrayToBgr);
     TEST_ADD_GROUP_AD0(Int16ToGray);
     TEST_ADD_GROUP_A00(RgbToGray);
+    TEST_ADD_GROUP_A00(RgbToYuv420pV2);
+    TEST_ADD_GROUP_A00(RgbToNv12);
+    TEST_ADD_GROUP_A00(RgbToNv21);
 
     TEST_ADD_GROUP_AD0(BgraToBayer);
     TEST_ADD_GROUP_AD0(BgrToBayer);
@@ -106,9 +111,15 @@ namespace Test
     TEST_ADD_GROUP_A00(RgbToBgra);
 
     TEST_ADD_GROUP_AD0(BgraToYuv420p);
+    TEST_ADD_GROUP_A00(BgraToYuv420pV2);
+    TEST_ADD_GROUP_A00(BgraToNv12);
+    TEST_ADD_GROUP_A00(BgraToNv21);
     TEST_ADD_GROUP_AD0(BgraToYuv422p);
     TEST_ADD_GROUP_AD0(BgraToYuv444p);
     TEST_ADD_GROUP_AD0(BgrToYuv420p);
+    TEST_ADD_GROUP_A00(BgrToYuv420pV2);
+    TEST_ADD_GROUP_A00(BgrToNv12);
+    TEST_ADD_GROUP_A00(BgrToNv21);
     TEST_ADD_GROUP_AD0(BgrToYuv422p);
     TEST_ADD_GROUP_AD0(BgrToYuv444p);
     TEST_ADD_GROUP_A00(BgraToYuva420p);
@@ -158,7 +169,9 @@ namespace Test
     TEST_ADD_GROUP_AD0(DetectionLbpDetect32fi);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ip);
     TEST_ADD_GROUP_AD0(DetectionLbpDetect16ii);
+    TEST_ADD_GROUP_A00(DetectionBinary);
     TEST_ADD_GROUP_00S(Detection);
+    TEST_ADD_GROUP_A00(DetectionMotionMask);
 
     TEST_ADD_GROUP_AD0(AlphaBlending);
     TEST_ADD_GROUP_AD0(AlphaFilling);
@@ -191,6 +204,7 @@ namespace Test
 
     TEST_ADD_GROUP_AD0(Float32ToFloat16);
     TEST_ADD_GROUP_AD0(Float16ToFloat32);
+    TEST_ADD_GROUP_A00(Float32ToBFloat16);
     TEST_ADD_GROUP_AD0(SquaredDifferenceSum16f);
     TEST_ADD_GROUP_AD0(CosineDistance16f);
     TEST_ADD_GROUP_A00(CosineDistancesMxNa16f);
@@ -218,6 +232,7 @@ namespace Test
     TEST_ADD_GROUP_AD0(Laplace);
     TEST_ADD_GROUP_AD0(LaplaceAbs);
     TEST_ADD_GROUP_A00(GaussianBlur);
+    TEST_ADD_GROUP_A00(StripFilter);
 
     TEST_ADD_GROUP_AD0(Histogram);
     TEST_ADD_GROUP_AD0(HistogramMasked);
@@ -239,6 +254,8 @@ namespace Test
     TEST_ADD_GROUP_AD0(HogLiteCreateMask);
 
     TEST_ADD_GROUP_00S(ImageMatcher);
+    TEST_ADD_GROUP_A00(ImageMatcherBinary);
+    TEST_ADD_GROUP_A00(ImageMatcherParallel);
 
     TEST_ADD_GROUP_AD0(Integral);
 
@@ -252,6 +269,8 @@ namespace Test
     TEST_ADD_GROUP_AD0(InterleaveBgra);
 
     TEST_ADD_GROUP_00S(Motion);
+    TEST_ADD_GROUP_A00(MotionManager);
+    TEST_ADD_GROUP_A00(MotionDetector);
 
     TEST_ADD_GROUP_AD0(NeuralConvert);
     TEST_ADD_GROUP_AD0(NeuralProductSum);
@@ -302,6 +321,7 @@ namespace Test
 
     TEST_ADD_GROUP_ADS(ResizeBilinear);
     TEST_ADD_GROUP_A00(Resizer);
+    TEST_ADD_GROUP_A00(CropAndResize);
 
     TEST_ADD_GROUP_AD0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_AD0(SegmentationFillSingleHoles);
@@ -354,12 +374,19 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetConvert32fTo8u);
     TEST_ADD_GROUP_A00(SynetConvert8uTo32f);
     TEST_ADD_GROUP_A00(SynetSetInput);
+    TEST_ADD_GROUP_A00(SynetYuvToTensor);
     TEST_ADD_GROUP_A00(SynetReorderImage);
     TEST_ADD_GROUP_A00(SynetReorderFilter);
 
     TEST_ADD_GROUP_A00(SynetConvolution8iForward);
+    TEST_ADD_GROUP_A00(SynetConvolution8iReshape);
+    TEST_ADD_GROUP_A00(SynetConvolution8iWinograd);
+
+    TEST_ADD_GROUP_A00(SynetConvolution16bForward);
 
     TEST_ADD_GROUP_A00(SynetConvolution32fForward);
+    TEST_ADD_GROUP_A00(SynetConvolution32fReshape);
+    TEST_ADD_GROUP_A00(SynetConvolution32fSparse);
 
     TEST_ADD_GROUP_A00(SynetDeconvolution32fForward);
 
@@ -382,13 +409,21 @@ namespace Test
     TEST_ADD_GROUP_A00(SynetScaleLayerForward);
     TEST_ADD_GROUP_A00(SynetScale8iForward);
 
+    TEST_ADD_GROUP_A00(SynetNetwork);
+
     TEST_ADD_GROUP_AD0(TextureBoostedSaturatedGradient);
     TEST_ADD_GROUP_AD0(TextureBoostedUv);
     TEST_ADD_GROUP_AD0(TextureGetDifferenceSum);
     TEST_ADD_GROUP_AD0(TexturePerformCompensation);
 
+    TEST_ADD_GROUP_A00(ThreadThreshold);
+    TEST_ADD_GROUP_A00(ThreadAffinity);
+
     TEST_ADD_GROUP_A00(TransformImage);
 
+    TEST_ADD_GROUP_A00(WarpAffine);
+    TEST_ADD_GROUP_A00(WarpPerspective);
+
     TEST_ADD_GROUP_A00(WinogradKernel1x3Block1x4SetFilter);
     TEST_ADD_GROUP_A00(WinogradKernel1x3Block1x4SetInput);
     TEST_ADD_GROUP_A00(WinogradKernel1x3Block1x4SetOutput);
@@ -410,6 +445,9 @@ namespace Test
     TEST_ADD_GROUP_A00(WinogradKernel3x3Block4x4SetFilter);
     TEST_ADD_GROUP_A00(WinogradKernel3x3Block4x4SetInput);
     TEST_ADD_GROUP_A00(WinogradKernel3x3Block4x4SetOutput);
+    TEST_ADD_GROUP_A00(WinogradKernel3x3Block6x6SetFilter);
+    TEST_ADD_GROUP_A00(WinogradKernel3x3Block6x6SetInput);
+    TEST_ADD_GROUP_A00(WinogradKernel3x3Block6x6SetOutput);
 
     TEST_ADD_GROUP_00S(WinogradKernel1x3Block1x4);
     TEST_ADD_GROUP_00S(WinogradKernel1x5Block1x4);
@@ -418,6 +456,7 @@ namespace Test
     TEST_ADD_GROUP_00S(WinogradKernel3x3Block2x2);
     TEST_ADD_GROUP_00S(WinogradKernel3x3Block3x3);
     TEST_ADD_GROUP_00S(WinogradKernel3x3Block4x4);
+    TEST_ADD_GROUP_00S(WinogradKernel3x3Block6x6);
 
     TEST_ADD_GROUP_AD0(Yuv444pToBgr);
     TEST_ADD_GROUP_AD0(Yuv422pToBgr);
@@ -429,6 +468,16 @@ namespace Test
     TEST_ADD_GROUP_A00(Yuv444pToRgb);
     TEST_ADD_GROUP_A00(Yuv422pToRgb);
     TEST_ADD_GROUP_A00(Yuv420pToRgb);
+    TEST_ADD_GROUP_A00(Yuv420pToBgrV2);
+    TEST_ADD_GROUP_A00(Yuv420pToBgraV2);
+    TEST_ADD_GROUP_A00(Yuv420pToRgbV2);
+    TEST_ADD_GROUP_A00(Nv12ToBgr);
+    TEST_ADD_GROUP_A00(Nv12ToBgra);
+    TEST_ADD_GROUP_A00(Nv12ToRgb);
+    TEST_ADD_GROUP_A00(Nv21ToBgr);
+    TEST_ADD_GROUP_A00(Nv21ToBgra);
+    TEST_ADD_GROUP_A00(Nv21ToRgb);
+    TEST_ADD_GROUP_A00(YuvV2Reference);
 
     TEST_ADD_GROUP_A00(Yuva420pToBgra);
     TEST_ADD_GROUP_AD0(Yuv444pToBgra);
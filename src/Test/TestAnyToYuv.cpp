@@ -405,6 +405,213 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncYuvV2
+        {
+            typedef void(*Yuv420pPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * y, size_t yStride,
+                uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+            typedef void(*NvPtr)(const uint8_t * src, size_t width, size_t height, size_t srcStride, uint8_t * y, size_t yStride,
+                uint8_t * uv, size_t uvStride, SimdYuvType yuvType);
+
+            Yuv420pPtr yuv420p;
+            NvPtr nv;
+            String description;
+
+            FuncYuvV2(const Yuv420pPtr & f, const String & d) : yuv420p(f), nv(NULL), description(d) {}
+            FuncYuvV2(const NvPtr & f, const String & d) : yuv420p(NULL), nv(f), description(d) {}
+
+            void Call(const View & src, View & y, View & u, View & v, View & uv, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                if (yuv420p)
+                    yuv420p(src.data, src.width, src.height, src.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, yuvType);
+                else
+                    nv(src.data, src.width, src.height, src.stride, y.data, y.stride, uv.data, uv.stride, yuvType);
+            }
+        };
+    }
+
+#define FUNC_YUV_V2(function) FuncYuvV2(function, #function)
+
+    bool AnyToYuvV2AutoTest(int width, int height, View::Format srcType, const FuncYuvV2 & f1, const FuncYuvV2 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int uvWidth = width / 2;
+        const int uvHeight = height / 2;
+
+        View src(width, height, srcType, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View y1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u1(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        View v1(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        View uv1(uvWidth, uvHeight, View::Uv16, NULL, TEST_ALIGN(width));
+
+        View y2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u2(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        View v2(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        View uv2(uvWidth, uvHeight, View::Uv16, NULL, TEST_ALIGN(width));
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, y1, u1, v1, uv1, (SimdYuvType)type));
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, y2, u2, v2, uv2, (SimdYuvType)type));
+
+            result = result && Compare(y1, y2, 0, true, 64, 0, "y");
+            if (f1.yuv420p)
+            {
+                result = result && Compare(u1, u2, 0, true, 64, 0, "u");
+                result = result && Compare(v1, v2, 0, true, 64, 0, "v");
+            }
+            else
+                result = result && Compare(uv1, uv2, 0, true, 64, 0, "uv");
+        }
+
+        return result;
+    }
+
+    bool AnyToYuvV2AutoTest(View::Format srcType, const FuncYuvV2 & f1, const FuncYuvV2 & f2)
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(W, H, srcType, f1, f2);
+        result = result && AnyToYuvV2AutoTest(W + O * 2, H - O * 2, srcType, f1, f2);
+
+        return result;
+    }
+
+    bool BgraToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgra32, FUNC_YUV_V2(Simd::Base::BgraToYuv420pV2), FUNC_YUV_V2(SimdBgraToYuv420pV2));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, FUNC_YUV_V2(Simd::Avx2::BgraToYuv420pV2), FUNC_YUV_V2(SimdBgraToYuv420pV2));
+#endif 
+
+        return result;
+    }
+
+    bool BgraToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgra32, FUNC_YUV_V2(Simd::Base::BgraToNv12), FUNC_YUV_V2(SimdBgraToNv12));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, FUNC_YUV_V2(Simd::Avx2::BgraToNv12), FUNC_YUV_V2(SimdBgraToNv12));
+#endif 
+
+        return result;
+    }
+
+    bool BgraToNv21AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgra32, FUNC_YUV_V2(Simd::Base::BgraToNv21), FUNC_YUV_V2(SimdBgraToNv21));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgra32, FUNC_YUV_V2(Simd::Avx2::BgraToNv21), FUNC_YUV_V2(SimdBgraToNv21));
+#endif 
+
+        return result;
+    }
+
+    bool BgrToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgr24, FUNC_YUV_V2(Simd::Base::BgrToYuv420pV2), FUNC_YUV_V2(SimdBgrToYuv420pV2));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, FUNC_YUV_V2(Simd::Avx2::BgrToYuv420pV2), FUNC_YUV_V2(SimdBgrToYuv420pV2));
+#endif 
+
+        return result;
+    }
+
+    bool BgrToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgr24, FUNC_YUV_V2(Simd::Base::BgrToNv12), FUNC_YUV_V2(SimdBgrToNv12));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, FUNC_YUV_V2(Simd::Avx2::BgrToNv12), FUNC_YUV_V2(SimdBgrToNv12));
+#endif 
+
+        return result;
+    }
+
+    bool BgrToNv21AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Bgr24, FUNC_YUV_V2(Simd::Base::BgrToNv21), FUNC_YUV_V2(SimdBgrToNv21));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Bgr24, FUNC_YUV_V2(Simd::Avx2::BgrToNv21), FUNC_YUV_V2(SimdBgrToNv21));
+#endif 
+
+        return result;
+    }
+
+    bool RgbToYuv420pV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Rgb24, FUNC_YUV_V2(Simd::Base::RgbToYuv420pV2), FUNC_YUV_V2(SimdRgbToYuv420pV2));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Rgb24, FUNC_YUV_V2(Simd::Avx2::RgbToYuv420pV2), FUNC_YUV_V2(SimdRgbToYuv420pV2));
+#endif 
+
+        return result;
+    }
+
+    bool RgbToNv12AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Rgb24, FUNC_YUV_V2(Simd::Base::RgbToNv12), FUNC_YUV_V2(SimdRgbToNv12));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Rgb24, FUNC_YUV_V2(Simd::Avx2::RgbToNv12), FUNC_YUV_V2(SimdRgbToNv12));
+#endif 
+
+        return result;
+    }
+
+    bool RgbToNv21AutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToYuvV2AutoTest(View::Rgb24, FUNC_YUV_V2(Simd::Base::RgbToNv21), FUNC_YUV_V2(SimdRgbToNv21));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && AnyToYuvV2AutoTest(View::Rgb24, FUNC_YUV_V2(Simd::Avx2::RgbToNv21), FUNC_YUV_V2(SimdRgbToNv21));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool AnyToYuvDataTest(bool create, int width, int height, View::Format srcType, int dx, int dy, const FuncYuv & f)
     {
         bool result = true;
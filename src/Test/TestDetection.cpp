@@ -427,6 +427,119 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    static void DetectionBinaryDetect(const void * data, const View & src, int throughColumn, int int16, const FuncD & f, View & dst)
+    {
+        View sum(src.width + 1, src.height + 1, View::Int32);
+        View sqsum(src.width + 1, src.height + 1, View::Int32);
+        View tilted(src.width + 1, src.height + 1, View::Int32);
+        Simd::Integral(src, sum, sqsum, tilted);
+
+        size_t w, h;
+        SimdDetectionInfoFlags flags;
+        SimdDetectionInfo(data, &w, &h, &flags);
+        Rect rect(0, 0, src.width - w, src.height - h);
+
+        View mask(src.width, src.height, View::Gray8);
+        Simd::Fill(mask, 255);
+        Simd::Fill(dst, 0);
+
+        void * hid = SimdDetectionInit(data, sum.data, sum.stride, sum.width, sum.height,
+            sqsum.data, sqsum.stride, tilted.data, tilted.stride, throughColumn, int16);
+        SimdDetectionPrepare(hid);
+        f.Call(hid, mask, rect, dst);
+        SimdRelease(hid);
+    }
+
+    static bool DetectionBinaryCorruptedAutoTest(const std::vector<uint8_t> & binary, size_t section, size_t field, int32_t value, const char * name)
+    {
+        std::vector<uint8_t> corrupted = binary;
+        uint32_t offset;
+        memcpy(&offset, corrupted.data() + 40 + section * sizeof(uint32_t), sizeof(offset)); // Binary::Header::offset[section]
+        memcpy(corrupted.data() + offset + field * sizeof(int32_t), &value, sizeof(value));
+        void * bin = SimdDetectionLoadBinary(corrupted.data(), corrupted.size());
+        if (bin != NULL)
+        {
+            TEST_LOG_SS(Error, "Binary cascade with invalid " << name << " is accepted!");
+            SimdRelease(bin);
+            return false;
+        }
+        return true;
+    }
+
+    bool DetectionBinaryAutoTest(const String & path, int throughColumn, int int16, const FuncD & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test binary cascade for '" << path << "'.");
+
+        void * xml = SimdDetectionLoadA(path.c_str());
+        if (xml == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load cascade '" << path << "' !");
+            return false;
+        }
+
+        size_t size = SimdDetectionSaveBinary(xml, NULL, 0);
+        std::vector<uint8_t> binary(size), copy(size);
+        if (SimdDetectionSaveBinary(xml, binary.data(), binary.size()) != size)
+        {
+            TEST_LOG_SS(Error, "Can't save binary cascade!");
+            result = false;
+        }
+
+        void * bin = result ? SimdDetectionLoadBinary(binary.data(), binary.size()) : NULL;
+        if (bin == NULL)
+        {
+            TEST_LOG_SS(Error, "Can't load binary cascade!");
+            SimdRelease(xml);
+            return false;
+        }
+
+        SimdDetectionSaveBinary(bin, copy.data(), copy.size());
+        if (copy != binary)
+        {
+            TEST_LOG_SS(Error, "Resaved binary cascade is different!");
+            result = false;
+        }
+
+        if (SimdDetectionLoadBinary(binary.data(), binary.size() - 1) != NULL)
+        {
+            TEST_LOG_SS(Error, "Truncated binary cascade is accepted!");
+            result = false;
+        }
+
+        result = result && DetectionBinaryCorruptedAutoTest(binary, 0, 0, 1 << 30, "stage first tree");
+        result = result && DetectionBinaryCorruptedAutoTest(binary, 0, 1, 1 << 30, "stage tree count");
+        result = result && DetectionBinaryCorruptedAutoTest(binary, 1, 0, 0, "tree node count");
+        result = result && DetectionBinaryCorruptedAutoTest(binary, 2, 0, -1, "node feature");
+        result = result && DetectionBinaryCorruptedAutoTest(binary, 2, 0, 1 << 30, "node feature");
+
+        View src = GetSample(Size(W, H), false);
+        View dst1(src.Size(), View::Gray8), dst2(src.Size(), View::Gray8);
+        DetectionBinaryDetect(xml, src, throughColumn, int16, f, dst1);
+        DetectionBinaryDetect(bin, src, throughColumn, int16, f, dst2);
+        result = result && Compare(dst1, dst2, 0, true, 32);
+
+        SimdRelease(bin);
+        SimdRelease(xml);
+
+        return result;
+    }
+
+    bool DetectionBinaryAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionBinaryAutoTest(ROOT_PATH + "/data/cascade/haar_face_0.xml", 0, 0, FUNC_D(SimdDetectionHaarDetect32fp));
+        result = result && DetectionBinaryAutoTest(ROOT_PATH + "/data/cascade/haar_face_1.xml", 1, 0, FUNC_D(SimdDetectionHaarDetect32fi));
+        result = result && DetectionBinaryAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml", 0, 0, FUNC_D(SimdDetectionLbpDetect32fp));
+        result = result && DetectionBinaryAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml", 1, 1, FUNC_D(SimdDetectionLbpDetect16ii));
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool DetectionDetectDataTest(bool create, const String & path, int width, int height, int throughColumn, int int16, const FuncD & f)
     {
         bool result = true;
@@ -658,5 +771,64 @@ namespace Test
 
         return result;
     }
+
+    static bool DetectionCompare(const Objects & objects1, const Objects & objects2, const String & description)
+    {
+        bool result = objects1.size() == objects2.size();
+        for (size_t i = 0; i < objects1.size() && result; ++i)
+            if (objects1[i].rect != objects2[i].rect || objects1[i].weight != objects2[i].weight || objects1[i].tag != objects2[i].tag)
+                result = false;
+        if (!result)
+        {
+            TEST_LOG_SS(Error, "Detection with " << description << " motion mask differs: " << objects1.size() << " vs " << objects2.size() << " objects.");
+            for (size_t i = 0; i < objects2.size(); ++i)
+            {
+                TEST_LOG_SS(Error, "(" << objects2[i].rect.left << ", " << objects2[i].rect.top << ", "
+                    << objects2[i].rect.right << ", " << objects2[i].rect.bottom << ") - " << objects2[i].weight);
+            }
+        }
+        return result;
+    }
+
+    static bool DetectionMotionMaskAutoTest(const String & path, int threadNumber)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Detection::Detect with and without motion mask for " << path << " in " << threadNumber << " threads.");
+
+        Detection detection;
+        if (!detection.Load(ROOT_PATH + "/data/cascade/" + path))
+        {
+            TEST_LOG_SS(Error, "Can't load cascade '" << path << "' !");
+            return false;
+        }
+
+        View src = GetSample(Size(W, H), true);
+        detection.Init(src.Size(), 1.1, Size(), Size(INT_MAX, INT_MAX), View(), threadNumber);
+
+        Detection::Rects full(1, Rect(src.Size())), part(1, Rect(W / 4, H / 4, W / 2, H / 2));
+        Objects objects, objects1, objects2;
+
+        detection.Detect(src, objects);
+        detection.Detect(src, objects1, 3, 0.2, true, full);
+        detection.Detect(src, objects2, 3, 0.2, true, part);
+        detection.Detect(src, objects2, 3, 0.2, true, full);
+
+        result = result && DetectionCompare(objects, objects1, "full");
+        result = result && DetectionCompare(objects, objects2, "restored full");
+
+        return result;
+    }
+
+    bool DetectionMotionMaskAutoTest()
+    {
+        bool result = true;
+
+        result = result && DetectionMotionMaskAutoTest("haar_face_0.xml", 1);
+        result = result && DetectionMotionMaskAutoTest("lbp_face.xml", 1);
+        result = result && DetectionMotionMaskAutoTest("lbp_face.xml", 2);
+
+        return result;
+    }
 }
 
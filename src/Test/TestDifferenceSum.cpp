@@ -78,11 +78,28 @@ namespace Test
                 func((float*)a.data, (float*)b.data, a.width, sum);
             }
         };
+
+        struct FuncV
+        {
+            typedef void(*FuncPtr)(const uint8_t * a, const uint8_t * b, size_t bStride, size_t size, size_t count, uint64_t * sums);
+
+            FuncPtr func;
+            String description;
+
+            FuncV(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & a, const View & b, uint64_t * sums) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(a.data, b.data, b.stride, b.width, b.height, sums);
+            }
+        };
     }
 
 #define FUNC_S(function) FuncS(function, #function)
 #define FUNC_M(function) FuncM(function, #function)
 #define FUNC_F(function) FuncF(function, #function)
+#define FUNC_V(function) FuncV(function, #function)
 
     bool DifferenceSumsAutoTest(int width, int height, const FuncS & f1, const FuncS & f2, int count)
     {
@@ -503,6 +520,61 @@ namespace Test
         return result;
     }
 
+    bool SquaredDifferenceSumsAutoTest(int size, int count, const FuncV & f1, const FuncV & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << size << ", " << count << "].");
+
+        View a(size, 1, View::Gray8, NULL, TEST_ALIGN(size));
+        FillRandom(a);
+
+        View b(size, count, View::Gray8, NULL, TEST_ALIGN(size));
+        FillRandom(b);
+
+        Sums64 s1(count, 0), s2(count, 0);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(a, b, s1.data()));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(a, b, s2.data()));
+
+        result = Compare(s1, s2, 0, true, 32);
+
+        return result;
+    }
+
+    bool SquaredDifferenceSumsAutoTest(const FuncV & f1, const FuncV & f2)
+    {
+        bool result = true;
+
+        result = result && SquaredDifferenceSumsAutoTest(16, H, f1, f2);
+        result = result && SquaredDifferenceSumsAutoTest(16, H + O, f1, f2);
+        result = result && SquaredDifferenceSumsAutoTest(256, H, f1, f2);
+        result = result && SquaredDifferenceSumsAutoTest(W + O, H - O, f1, f2);
+        result = result && SquaredDifferenceSumsAutoTest(O, H, f1, f2);
+
+        return result;
+    }
+
+    bool SquaredDifferenceSumsAutoTest()
+    {
+        bool result = true;
+
+        result = result && SquaredDifferenceSumsAutoTest(FUNC_V(Simd::Base::SquaredDifferenceSums), FUNC_V(SimdSquaredDifferenceSums));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SquaredDifferenceSumsAutoTest(FUNC_V(Simd::Avx2::SquaredDifferenceSums), FUNC_V(SimdSquaredDifferenceSums));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SquaredDifferenceSumsAutoTest(FUNC_V(Simd::Avx512bw::SquaredDifferenceSums), FUNC_V(SimdSquaredDifferenceSums));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     bool DifferenceSumsDataTest(bool create, int width, int height, const FuncS & f, int count)
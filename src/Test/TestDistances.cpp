@@ -0,0 +1,205 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+
+#include "Simd/SimdDistances.h"
+
+namespace Test
+{
+    namespace
+    {
+        typedef std::vector<const void*> Pointers;
+
+        struct FuncD
+        {
+            typedef void*(*FuncPtr)(size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance, const void * const * B, const float * bScales);
+
+            FuncPtr func;
+            String desc;
+
+            FuncD(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t M, size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance)
+            {
+                desc = desc + "[" + ToString(M) + "-" + ToString(N) + "-" + ToString(K) + "-" + 
+                    (type == SimdTensorData32f ? "32f" : (type == SimdTensorData16f ? "16f" : "8i")) + "-" +
+                    (distance == SimdDistanceCosine ? "cos" : "l2") + "]";
+            }
+
+            void Call(void * context, const Pointers & A, const Tensor32f & aScales, size_t top, Tensor32f & distances, std::vector<size_t> & indices) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                SimdDistancesTopK(context, A.size(), A.data(), aScales.Size() ? aScales.Data() : NULL, top, distances.Data(), indices.data());
+            }
+        };
+    }
+
+#define FUNC_D(function) FuncD(function, #function)
+
+    static void Convert(const Tensor32f & src, SimdTensorDataType type, std::vector<uint8_t> & dst, Pointers & ptrs)
+    {
+        size_t count = src.Axis(0), size = src.Axis(1);
+        if (type == SimdTensorData32f)
+        {
+            dst.resize(count * size * 4);
+            memcpy(dst.data(), src.Data(), dst.size());
+        }
+        else if (type == SimdTensorData16f)
+        {
+            dst.resize(count * size * 2);
+            ::SimdFloat32ToFloat16(src.Data(), count * size, (uint16_t*)dst.data());
+        }
+        else
+        {
+            dst.resize(count * size);
+            for (size_t i = 0; i < count * size; ++i)
+                dst[i] = (uint8_t)Simd::Round(src.Data()[i] * 127.0f);
+        }
+        ptrs.resize(count);
+        for (size_t i = 0; i < count; ++i)
+            ptrs[i] = dst.data() + i * dst.size() / count;
+    }
+
+    static bool CompareIndices(size_t M, size_t top, const Tensor32f & d1, const std::vector<size_t> & i1,
+        const Tensor32f & d2, const std::vector<size_t> & i2, float eps)
+    {
+        for (size_t m = 0; m < M; ++m)
+        {
+            const float * pd1 = d1.Data() + m * top, * pd2 = d2.Data() + m * top;
+            const size_t * pi1 = i1.data() + m * top, * pi2 = i2.data() + m * top;
+            for (size_t k = 0; k < top; ++k)
+            {
+                if (k && pd2[k] == pd2[k - 1] && pi2[k] < pi2[k - 1])
+                {
+                    TEST_LOG_SS(Error, "Indices of equal distances are not ordered: query " << m << ", position " << k << " : " << pi2[k - 1] << " > " << pi2[k] << " !");
+                    return false;
+                }
+                if (pi1[k] == pi2[k])
+                    continue;
+                size_t j = std::find(pi1, pi1 + top, pi2[k]) - pi1;
+                float d = j < top ? pd1[j] : pd1[top - 1];
+                if (::fabs(d - pd1[k]) > eps)
+                {
+                    TEST_LOG_SS(Error, "Indices are different: query " << m << ", position " << k << " : " << pi1[k] << " (" << pd1[k] << ") != " << pi2[k] << " (" << pd2[k] << ") !");
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool DistancesTopKAutoTest(size_t M, size_t N, size_t K, SimdTensorDataType type, SimdDistanceType distance, size_t top, FuncD f1, FuncD f2, size_t unique = 0)
+    {
+        bool result = true;
+
+        f1.Update(M, N, K, type, distance);
+        f2.Update(M, N, K, type, distance);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " .");
+
+        Tensor32f Af({ M, K }), Bf({ N, K }), aScales, bScales;
+        FillRandom(Af, -1.0f, 1.0f);
+        FillRandom(Bf, -1.0f, 1.0f);
+        for (size_t j = unique; unique && j < N; ++j)
+            memcpy(Bf.Data() + j * K, Bf.Data() + (j % unique) * K, K * sizeof(float));
+        if (type == SimdTensorData8i)
+        {
+            aScales.Reshape({ M });
+            bScales.Reshape({ N });
+            FillRandom(aScales, 0.005f, 0.010f);
+            FillRandom(bScales, 0.005f, 0.010f);
+        }
+        std::vector<uint8_t> Ad, Bd;
+        Pointers A, B;
+        Convert(Af, type, Ad, A);
+        Convert(Bf, type, Bd, B);
+
+        Tensor32f d1({ M, top }), d2({ M, top });
+        std::vector<size_t> i1(M * top), i2(M * top);
+
+        void * c1 = f1.func(N, K, type, distance, B.data(), bScales.Size() ? bScales.Data() : NULL);
+        void * c2 = f2.func(N, K, type, distance, B.data(), bScales.Size() ? bScales.Data() : NULL);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(c1, A, aScales, top, d1, i1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(c2, A, aScales, top, d2, i2));
+
+        ::SimdRelease(c1);
+        ::SimdRelease(c2);
+
+        float eps = type == SimdTensorData32f ? EPS : EPS * 10.0f;
+        result = result && Compare(d1, d2, eps, true, 32, DifferenceBoth);
+
+        result = result && CompareIndices(M, top, d1, i1, d2, i2, eps);
+
+        return result;
+    }
+
+    bool DistancesTopKAutoTest(SimdTensorDataType type, SimdDistanceType distance, const FuncD & f1, const FuncD & f2)
+    {
+        bool result = true;
+
+        result = result && DistancesTopKAutoTest(1, 1000, 256, type, distance, 10, f1, f2);
+        result = result && DistancesTopKAutoTest(7, 1001, 253, type, distance, 5, f1, f2);
+        result = result && DistancesTopKAutoTest(64, 10000, 128, type, distance, 10, f1, f2);
+        result = result && DistancesTopKAutoTest(3, 7, 17, type, distance, 10, f1, f2);
+        result = result && DistancesTopKAutoTest(5, 3000, 64, type, distance, 12, f1, f2, 4);
+
+        return result;
+    }
+
+    bool DistancesTopKAutoTest(const FuncD & f1, const FuncD & f2)
+    {
+        bool result = true;
+
+        SimdTensorDataType types[3] = { SimdTensorData32f, SimdTensorData16f, SimdTensorData8i };
+        SimdDistanceType distances[2] = { SimdDistanceCosine, SimdDistanceSquaredL2 };
+        for (size_t t = 0; t < 3; ++t)
+            for (size_t d = 0; d < 2; ++d)
+                result = result && DistancesTopKAutoTest(types[t], distances[d], f1, f2);
+
+        return result;
+    }
+
+    bool DistancesTopKAutoTest()
+    {
+        bool result = true;
+
+        result = result && DistancesTopKAutoTest(FUNC_D(Simd::Base::DistancesInit), FUNC_D(SimdDistancesInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && DistancesTopKAutoTest(FUNC_D(Simd::Avx2::DistancesInit), FUNC_D(SimdDistancesInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && DistancesTopKAutoTest(FUNC_D(Simd::Avx512bw::DistancesInit), FUNC_D(SimdDistancesInit));
+#endif
+
+        return result;
+    }
+}
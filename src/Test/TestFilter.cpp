@@ -26,6 +26,7 @@
 #include "Test/TestData.h"
 
 #include "Simd/SimdGaussianBlur.h"
+#include "Simd/SimdStripFilter.h"
 
 namespace Test
 {
@@ -820,6 +821,153 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncSF
+        {
+            typedef void* (*FuncPtr)(size_t width, size_t height, size_t channels, SimdStripFilterType type, const float* radius);
+
+            FuncPtr func;
+            String description;
+
+            FuncSF(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdStripFilterType type, size_t channels, size_t strip)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << type << "-" << channels << "-" << strip << "]";
+                description = ss.str();
+            }
+
+            void Call(const View& src, SimdStripFilterType type, float radius, size_t strip, View& dst) const
+            {
+                void* filter = func(src.width, src.height, src.ChannelCount(), type, &radius);
+                View buf(dst.width, strip + 16, dst.format, NULL, TEST_ALIGN(dst.width));
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    for (size_t row = 0, out = 0; row < src.height; row += strip)
+                    {
+                        size_t rows = Simd::Min(strip, src.height - row);
+                        size_t done = SimdStripFilterRun(filter, src.data + row * src.stride, src.stride, rows, buf.data, buf.stride);
+                        if (done)
+                            Simd::Copy(buf.Region(0, 0, buf.width, done), dst.Region(0, out, dst.width, out + done).Ref());
+                        out += done;
+                    }
+                }
+                SimdRelease(filter);
+            }
+        };
+    }
+
+#define FUNC_SF(function) \
+    FuncSF(function, std::string(#function))
+
+    void StripFilterReference(const View& src, SimdStripFilterType type, float radius, View& dst)
+    {
+        switch (type)
+        {
+        case SimdStripFilterGaussianBlur3x3: SimdGaussianBlur3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride); break;
+        case SimdStripFilterMedianSquare3x3: SimdMedianFilterSquare3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride); break;
+        case SimdStripFilterMedianSquare5x5: SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride); break;
+        case SimdStripFilterSobelDx: SimdSobelDx(src.data, src.stride, src.width, src.height, dst.data, dst.stride); break;
+        case SimdStripFilterSobelDxAbs: SimdSobelDxAbs(src.data, src.stride, src.width, src.height, dst.data, dst.stride); break;
+        case SimdStripFilterSobelDy: SimdSobelDy(src.data, src.stride, src.width, src.height, dst.data, dst.stride); break;
+        case SimdStripFilterSobelDyAbs: SimdSobelDyAbs(src.data, src.stride, src.width, src.height, dst.data, dst.stride); break;
+        case SimdStripFilterLaplace: SimdLaplace(src.data, src.stride, src.width, src.height, dst.data, dst.stride); break;
+        case SimdStripFilterLaplaceAbs: SimdLaplaceAbs(src.data, src.stride, src.width, src.height, dst.data, dst.stride); break;
+        case SimdStripFilterGaussianBlur:
+        {
+            void* filter = SimdGaussianBlurInit(src.width, src.height, src.ChannelCount(), &radius);
+            SimdGaussianBlurRun(filter, src.data, src.stride, dst.data, dst.stride);
+            SimdRelease(filter);
+            break;
+        }
+        default:
+            assert(0);
+        }
+    }
+
+    bool StripFilterAutoTest(size_t width, size_t height, size_t channels, SimdStripFilterType type, size_t strip, FuncSF f1, FuncSF f2)
+    {
+        bool result = true;
+
+        f1.Update(type, channels, strip);
+        f2.Update(type, channels, strip);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View::Format srcFormat, dstFormat;
+        switch (channels)
+        {
+        case 1: srcFormat = View::Gray8; break;
+        case 2: srcFormat = View::Uv16; break;
+        case 3: srcFormat = View::Bgr24; break;
+        case 4: srcFormat = View::Bgra32; break;
+        default:
+            assert(0);
+        }
+        dstFormat = type >= SimdStripFilterSobelDx ? View::Int16 : srcFormat;
+        const float radius = 2.0f;
+
+        View src(width, height, srcFormat, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, dstFormat, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstFormat, NULL, TEST_ALIGN(width));
+        View dst3(width, height, dstFormat, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, type, radius, strip, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, type, radius, strip, dst2));
+
+        StripFilterReference(src, type, radius, dst3);
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+        result = result && Compare(dst2, dst3, 0, true, 64, 0, "reference");
+
+        return result;
+    }
+
+    bool StripFilterAutoTest(const FuncSF& f1, const FuncSF& f2)
+    {
+        bool result = true;
+
+        for (int type = SimdStripFilterGaussianBlur3x3; type <= SimdStripFilterLaplaceAbs; ++type)
+        {
+            for (size_t channels = 1; channels <= 4; channels++)
+            {
+                if (type >= SimdStripFilterSobelDx && channels != 1)
+                    continue;
+                result = result && StripFilterAutoTest(W, H, channels, (SimdStripFilterType)type, 16, f1, f2);
+                result = result && StripFilterAutoTest(W + O, H - O, channels, (SimdStripFilterType)type, 5, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool StripFilterAutoTest()
+    {
+        bool result = true;
+
+        result = result && StripFilterAutoTest(FUNC_SF(Simd::Base::StripFilterInit), FUNC_SF(SimdStripFilterInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && StripFilterAutoTest(FUNC_SF(Simd::Avx2::StripFilterInit), FUNC_SF(SimdStripFilterInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && StripFilterAutoTest(FUNC_SF(Simd::Avx512bw::StripFilterInit), FUNC_SF(SimdStripFilterInit));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool ColorFilterDataTest(bool create, int width, int height, View::Format format, const FuncC & f)
     {
         bool result = true;
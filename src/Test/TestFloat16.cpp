@@ -182,6 +182,91 @@ namespace Test
         return result;
     }
 
+    SIMD_INLINE uint16_t Float32ToBFloat16Reference(float value)
+    {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        uint32_t hi = bits >> 16, lo = bits & 0xFFFF;
+        if ((bits & 0x7FFFFFFF) > 0x7F800000)
+            return uint16_t(hi | 0x0040);
+        if (lo > 0x8000 || (lo == 0x8000 && (hi & 1)))
+            hi++;
+        return uint16_t(hi);
+    }
+
+    bool Float32ToBFloat16AutoTest(size_t size, const FuncSH & f1, const FuncSH & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << size << "].");
+
+        View src(size, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View dst1(size, 1, View::Int16, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View dst2(size, 1, View::Int16, NULL, TEST_ALIGN(SIMD_ALIGN));
+
+        FillRandom32f(src, -10.0, 10.0);
+        const uint32_t specials[] = { 0x7FC00000, 0xFFC00000, 0x7F800001, 0xFF812345, 0x7F800000, 0xFF800000, 0x7F7FFFFF, 
+            0x00000000, 0x80000000, 0x3F808000, 0x3F818000, 0x3F808001, 0xBF817FFF, 0x00800000 };
+        for (size_t i = 0, n = sizeof(specials) / sizeof(specials[0]); i < n && i < size; ++i)
+            memcpy(src.data + (i * 97 % size) * 4, specials + i, 4);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 32);
+
+        const float * s = (const float*)src.data;
+        const uint16_t * d = (const uint16_t*)dst1.data;
+        for (size_t i = 0; i < size && result; ++i)
+        {
+            uint16_t reference = Float32ToBFloat16Reference(s[i]);
+            if (d[i] != reference)
+            {
+                uint32_t bits;
+                memcpy(&bits, s + i, sizeof(bits));
+                TEST_LOG_SS(Error, f1.description << " converts 0x" << std::hex << bits << " to 0x" << d[i] << " instead of 0x" << reference << std::dec << " at " << i << " !");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool Float32ToBFloat16AutoTest(const FuncSH & f1, const FuncSH & f2)
+    {
+        bool result = true;
+
+        result = result && Float32ToBFloat16AutoTest(W*H, f1, f2);
+        result = result && Float32ToBFloat16AutoTest(W*H - 1, f1, f2);
+
+        return result;
+    }
+
+    bool Float32ToBFloat16AutoTest()
+    {
+        bool result = true;
+
+        result = result && Float32ToBFloat16AutoTest(FUNC_SH(Simd::Base::Float32ToBFloat16), FUNC_SH(SimdFloat32ToBFloat16));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Float32ToBFloat16AutoTest(FUNC_SH(Simd::Avx2::Float32ToBFloat16), FUNC_SH(SimdFloat32ToBFloat16));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Float32ToBFloat16AutoTest(FUNC_SH(Simd::Avx512bw::Float32ToBFloat16), FUNC_SH(SimdFloat32ToBFloat16));
+#endif 
+
+#ifdef SIMD_AVX512BF16_ENABLE
+        if (Simd::Avx512bf16::Enable)
+            result = result && Float32ToBFloat16AutoTest(FUNC_SH(Simd::Avx512bf16::Float32ToBFloat16), FUNC_SH(SimdFloat32ToBFloat16));
+#endif 
+
+        return result;
+    }
+
     struct FuncS
     {
         typedef void(*FuncPtr)(const uint16_t * a, const uint16_t * b, size_t size, float * sum);
@@ -153,4 +153,202 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------
+
+    typedef std::vector<std::pair<size_t, double> > MatchedTags;
+
+    void FindTags(ImageMatcher & matcher, const View & view, MatchedTags & tags)
+    {
+        ImageMatcher::Results results;
+        matcher.Find(matcher.Create(view, 0), results);
+        tags.clear();
+        for (size_t i = 0; i < results.size(); ++i)
+            tags.push_back(std::make_pair(results[i].tag, results[i].difference));
+        std::sort(tags.begin(), tags.end());
+    }
+
+    bool ImageMatcherBinaryAutoTest(size_t type, size_t number, ImageMatcher::HashType hash)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test ImageMatcher Save/Append/Load for " << g_names[type] << " and hash " << (16 << hash) << "x" << (16 << hash) << ".");
+
+        ViewPtrs samples;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            samples.push_back(ViewPtr(new View(32, 32, View::Gray8)));
+            Fill(*samples.back());
+        }
+
+        ImageMatcher original;
+        original.Init(0.05, hash, g_numbers[type]);
+        for (size_t i = 0; i < number / 2; ++i)
+            original.Add(original.Create(*samples[i % samples.size()], i));
+        std::stringstream stream;
+        if (original.Append(stream))
+        {
+            TEST_LOG_SS(Error, "ImageMatcher appends data before Save!");
+            return false;
+        }
+        result = result && original.Save(stream);
+        for (size_t i = number / 2; i < number; ++i)
+            original.Add(original.Create(*samples[i % samples.size()], i));
+        std::stringstream broken;
+        broken.setstate(std::ios::badbit);
+        result = result && !original.Append(broken);
+        result = result && original.Append(stream);
+        if (!result)
+        {
+            TEST_LOG_SS(Error, "Can't save ImageMatcher!");
+            return result;
+        }
+
+        String binary = stream.str();
+        ImageMatcher loaded;
+        if (!loaded.Load((const uint8_t*)binary.data(), binary.size()) || loaded.Size() != original.Size())
+        {
+            TEST_LOG_SS(Error, "Can't load ImageMatcher!");
+            return false;
+        }
+
+        ImageMatcher truncated;
+        if (truncated.Load((const uint8_t*)binary.data(), binary.size() - 1))
+        {
+            TEST_LOG_SS(Error, "ImageMatcher loads truncated data!");
+            return false;
+        }
+
+        String corrupted = binary;
+        uint64_t huge = uint64_t(1) << 60;
+        memcpy(&corrupted[24], &huge, sizeof(huge)); // BinaryHeader::number
+        ImageMatcher estimated;
+        estimated.Load((const uint8_t*)corrupted.data(), corrupted.size());
+
+        for (size_t i = 0; i < samples.size() && result; i += 10)
+        {
+            MatchedTags tags0, tags1;
+            FindTags(original, *samples[i], tags0);
+            FindTags(loaded, *samples[i], tags1);
+            if (tags0 != tags1)
+            {
+                TEST_LOG_SS(Error, "Loaded ImageMatcher finds " << tags1.size() << " instead of " << tags0.size() << " images for sample " << i << " !");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool ImageMatcherBinaryAutoTest()
+    {
+        bool result = true;
+
+        result = result && ImageMatcherBinaryAutoTest(0, 200, ImageMatcher::Hash16x16);
+        result = result && ImageMatcherBinaryAutoTest(1, 2000, ImageMatcher::Hash16x16);
+        result = result && ImageMatcherBinaryAutoTest(2, 20000, ImageMatcher::Hash16x16);
+        result = result && ImageMatcherBinaryAutoTest(0, 200, ImageMatcher::Hash32x32);
+        result = result && ImageMatcherBinaryAutoTest(1, 2000, ImageMatcher::Hash32x32);
+        result = result && ImageMatcherBinaryAutoTest(2, 20000, ImageMatcher::Hash32x32);
+        result = result && ImageMatcherBinaryAutoTest(0, 200, ImageMatcher::Hash64x64);
+        result = result && ImageMatcherBinaryAutoTest(2, 20000, ImageMatcher::Hash64x64);
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool ImageMatcherParallelAutoTest(size_t number, size_t threads, bool flat, bool loaded)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test ImageMatcher::Find for " << number << (flat ? " flat" : " random") << (loaded ? " partially loaded" : "")
+            << " images in 1 and " << threads << " threads.");
+
+        const size_t unique = flat ? 32 : 1000;
+        ImageMatcher single, parallel, saved, other;
+        single.Init(0.05, ImageMatcher::Hash16x16, flat ? number : 0);
+        parallel.Init(0.05, ImageMatcher::Hash16x16, flat ? number : 0);
+        saved.Init(0.05, ImageMatcher::Hash16x16, flat ? number : 0);
+        other.Init(0.05, ImageMatcher::Hash16x16);
+        single.SetThreadNumber(1);
+        parallel.SetThreadNumber(threads);
+
+        ViewPtrs samples;
+        std::vector<ImageMatcher::HashPtr> hashes;
+        for (size_t i = 0; i < unique; ++i)
+        {
+            samples.push_back(ViewPtr(new View(32, 32, View::Gray8)));
+            if (flat)
+                Simd::Fill(*samples.back(), uint8_t(100 + i));
+            else
+                Fill(*samples.back());
+            hashes.push_back(single.Create(*samples.back(), i));
+        }
+        size_t half = loaded ? number / 2 : 0;
+        for (size_t i = 0; i < number; ++i)
+            single.Add(hashes[i % unique]);
+        if (loaded)
+        {
+            for (size_t i = 0; i < half; ++i)
+                saved.Add(hashes[i % unique]);
+            std::stringstream stream;
+            if (!saved.Save(stream) || !parallel.Load(stream) || parallel.Size() != half)
+            {
+                TEST_LOG_SS(Error, "Can't save or load ImageMatcher!");
+                return false;
+            }
+        }
+        for (size_t i = half; i < number; ++i)
+            parallel.Add(hashes[i % unique]);
+
+        ImageMatcher::HashPtr skipped = single.Create(*samples[0], unique);
+        other.Add(skipped);
+        single.Add(skipped);
+        single.Skip(skipped);
+        parallel.Add(skipped);
+        parallel.Skip(skipped);
+
+        for (size_t i = 0; i < unique && result; i += unique / 20)
+        {
+            MatchedTags tags1, tags2;
+            FindTags(single, *samples[i], tags1);
+            FindTags(parallel, *samples[i], tags2);
+            if (tags1.size() < number / unique || tags1 != tags2)
+            {
+                TEST_LOG_SS(Error, "ImageMatcher finds " << tags2.size() << " images in " << threads << " threads instead of " << tags1.size() << " for sample " << i << " !");
+                result = false;
+            }
+            for (size_t j = 0; j < tags2.size() && result; ++j)
+            {
+                if (tags2[j].first == unique)
+                {
+                    TEST_LOG_SS(Error, "ImageMatcher finds skipped image for sample " << i << " !");
+                    result = false;
+                }
+            }
+        }
+
+        MatchedTags tags;
+        FindTags(other, *samples[0], tags);
+        if (result && (tags.size() != 1 || tags[0].first != unique))
+        {
+            TEST_LOG_SS(Error, "ImageMatcher::Skip affects other ImageMatcher!");
+            result = false;
+        }
+
+        return result;
+    }
+
+    bool ImageMatcherParallelAutoTest()
+    {
+        bool result = true;
+
+        result = result && ImageMatcherParallelAutoTest(0x40000, 4, false, false);
+        result = result && ImageMatcherParallelAutoTest(0x40000, 4, false, true);
+        result = result && ImageMatcherParallelAutoTest(0x40000, 4, true, false);
+        result = result && ImageMatcherParallelAutoTest(0x40000, 4, true, true);
+
+        return result;
+    }
 }
@@ -148,4 +148,260 @@ namespace Test
 
         return true;
     }
+
+    //-----------------------------------------------------------------------------
+
+    typedef Simd::Motion::Frame MotionFrame;
+    typedef std::vector<MotionFrame> MotionFrames;
+    typedef std::vector<Simd::Motion::Metadata> MotionMetadatas;
+
+    static void MotionSequence(size_t width, size_t height, size_t count, size_t begin, size_t end, MotionFrames & frames)
+    {
+        View background(width, height, View::Bgr24);
+        FillRandom(background, 64, 192);
+        Simd::GaussianBlur3x3(background, background);
+        Size size(width / 5, height / 4);
+        frames.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            frames[i].Recreate(width, height, MotionFrame::Bgr24);
+            frames[i].timestamp = i * 0.04;
+            Simd::Copy(background, frames[i].planes[0]);
+            if (i >= begin && i < end)
+            {
+                ptrdiff_t x = (width - size.x) * (i - begin) / (end - begin);
+                Rect object(x, (height - size.y) / 2, x + size.x, (height + size.y) / 2);
+                Simd::DrawFilledRectangle(frames[i].planes[0], object, Simd::Pixel::Bgr24(255, 255, 255));
+            }
+        }
+    }
+
+    static bool MotionCompare(const Simd::Motion::Metadata & a, const Simd::Motion::Metadata & b, const String & description)
+    {
+        bool result = a.objects.size() == b.objects.size() && a.events.size() == b.events.size();
+        for (size_t i = 0; i < a.objects.size() && result; ++i)
+            result = a.objects[i].id == b.objects[i].id && a.objects[i].rect == b.objects[i].rect && a.objects[i].trajectory.size() == b.objects[i].trajectory.size();
+        for (size_t i = 0; i < a.events.size() && result; ++i)
+            result = a.events[i].type == b.events[i].type && a.events[i].objectId == b.events[i].objectId;
+        if (!result)
+            TEST_LOG_SS(Error, "Metadata of " << description << " is different: " << a.objects.size() << "/" << a.events.size()
+                << " vs " << b.objects.size() << "/" << b.events.size() << " objects/events.");
+        return result;
+    }
+
+    static size_t MotionEventCount(const MotionMetadatas & metadatas, Simd::Motion::Event::Type type)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < metadatas.size(); ++i)
+            for (size_t j = 0; j < metadatas[i].events.size(); ++j)
+                if (metadatas[i].events[j].type == type)
+                    count++;
+        return count;
+    }
+
+    bool MotionManagerAutoTest(size_t threads, size_t threshold)
+    {
+        bool result = true;
+
+        const size_t streams = 4, count = 150;
+        TEST_LOG_SS(Info, "Test Simd::Motion::Manager for " << streams << " streams in " << threads << " threads (thread threshold " << threshold << ").");
+
+        size_t threadNumber = SimdGetThreadNumber(), threadThreshold = SimdGetThreadThreshold();
+        SimdSetThreadNumber(threads);
+        SimdSetThreadThreshold(threshold);
+
+        std::vector<MotionFrames> sequences(streams);
+        MotionSequence(640, 480, count, 40, 110, sequences[0]);
+        MotionSequence(160, 120, count, 40, 110, sequences[1]);
+        MotionSequence(160, 120, count, 60, 130, sequences[2]);
+        MotionSequence(320, 240, count, count, count, sequences[3]);
+
+        Simd::Motion::Manager manager(threads);
+        std::vector<Simd::Motion::Detector> detectors(streams);
+        std::vector<MotionMetadatas> control(streams, MotionMetadatas(count)), tested(streams, MotionMetadatas(count));
+        for (size_t s = 0; s < streams; ++s)
+            manager.Add();
+
+        Simd::Motion::Manager::Metadatas metadatas(streams);
+        if (manager.NextFrames(Simd::Motion::Manager::Frames(streams - 1), metadatas))
+        {
+            TEST_LOG_SS(Error, "Simd::Motion::Manager::NextFrames must fail for wrong number of frames!");
+            result = false;
+        }
+
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            Simd::Motion::Manager::Frames frames(streams);
+            for (size_t s = 0; s < streams; ++s)
+            {
+                if (s == 2 && i % 3 == 1)
+                    continue;
+                frames[s] = sequences[s][i];
+                detectors[s].NextFrame(frames[s], control[s][i]);
+            }
+            metadatas[2].objects.assign(1, Simd::Motion::Object());
+            if (!manager.NextFrames(frames, metadatas))
+            {
+                TEST_LOG_SS(Error, "Simd::Motion::Manager::NextFrames failed at frame " << i << " !");
+                result = false;
+            }
+            for (size_t s = 0; s < streams; ++s)
+                tested[s][i] = metadatas[s];
+            if (frames[2].format == MotionFrame::None && metadatas[2].objects.size() != 1)
+            {
+                TEST_LOG_SS(Error, "Simd::Motion::Manager changed metadata of skipped stream at frame " << i << " !");
+                result = false;
+            }
+        }
+
+        for (size_t s = 0; s < streams && result; ++s)
+            for (size_t i = 0; i < count && result; ++i)
+                if (s != 2 || i % 3 != 1)
+                    result = result && MotionCompare(control[s][i], tested[s][i], "stream " + ToString(s) + " at frame " + ToString(i));
+
+        for (size_t s = 0; s < 3 && result; ++s)
+        {
+            if (MotionEventCount(control[s], Simd::Motion::Event::ObjectIn) == 0)
+            {
+                TEST_LOG_SS(Error, "Moving object in stream " << s << " is not detected!");
+                result = false;
+            }
+        }
+
+        if (result && !(manager.Cost(0) > manager.Cost(1) && manager.Cost(0) > manager.Cost(2) && manager.Cost(3) > 0))
+        {
+            TEST_LOG_SS(Error, "Wrong costs of Simd::Motion::Manager streams: " << manager.Cost(0) << ", "
+                << manager.Cost(1) << ", " << manager.Cost(2) << ", " << manager.Cost(3) << " !");
+            result = false;
+        }
+
+        SimdSetThreadNumber(threadNumber);
+        SimdSetThreadThreshold(threadThreshold);
+
+        return result;
+    }
+
+    bool MotionManagerAutoTest()
+    {
+        bool result = true;
+
+        result = result && MotionManagerAutoTest(1, SimdGetThreadThreshold());
+        result = result && MotionManagerAutoTest(3, SimdGetThreadThreshold());
+        result = result && MotionManagerAutoTest(3, 160 * 120);
+
+        return result;
+    }
+
+    static void MotionDetect(const MotionFrames & frames, const Simd::Motion::Model & model, const Simd::Motion::Options & options, MotionMetadatas & metadatas)
+    {
+        Simd::Motion::Detector detector;
+        detector.SetModel(model);
+        detector.SetOptions(options);
+        metadatas.resize(frames.size());
+        for (size_t i = 0; i < frames.size(); ++i)
+            detector.NextFrame(frames[i], metadatas[i]);
+    }
+
+    static size_t MotionFirstEvent(const MotionMetadatas & metadatas, Simd::Motion::Event::Type type)
+    {
+        for (size_t i = 0; i < metadatas.size(); ++i)
+            for (size_t j = 0; j < metadatas[i].events.size(); ++j)
+                if (metadatas[i].events[j].type == type)
+                    return i;
+        return metadatas.size();
+    }
+
+    bool MotionDetectorAutoTest(size_t width, size_t height)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::Motion::Detector ROI crop and adaptive frame skip for size [" << width << ", " << height << "].");
+
+        const size_t count = 240, begin = 100, end = 170;
+        MotionFrames frames;
+        MotionSequence(width, height, count, begin, end, frames);
+
+        Simd::Motion::Model model;
+        Simd::Motion::Options options;
+        MotionMetadatas control;
+        MotionDetect(frames, model, options, control);
+        if (MotionEventCount(control, Simd::Motion::Event::ObjectIn) == 0)
+        {
+            TEST_LOG_SS(Error, "Moving object is not detected!");
+            return false;
+        }
+
+        Simd::Motion::Options fullCrop(options);
+        fullCrop.CalibrationRoiCropEnable = true;
+        MotionMetadatas tested;
+        MotionDetect(frames, model, fullCrop, tested);
+        for (size_t i = 0; i < count && result; ++i)
+            result = result && MotionCompare(control[i], tested[i], "ROI crop of full screen at frame " + ToString(i));
+
+        Simd::Motion::Options adaptive(options);
+        adaptive.AdaptiveQuietFrameCount = 10;
+        adaptive.AdaptiveQuietFrameStep = 4;
+        MotionDetect(frames, model, adaptive, tested);
+        size_t controlIn = MotionFirstEvent(control, Simd::Motion::Event::ObjectIn);
+        size_t testedIn = MotionFirstEvent(tested, Simd::Motion::Event::ObjectIn);
+        if (result && (testedIn != controlIn || MotionEventCount(tested, Simd::Motion::Event::ObjectIn) != MotionEventCount(control, Simd::Motion::Event::ObjectIn)))
+        {
+            TEST_LOG_SS(Error, "Adaptive frame skip: object appears at frame " << testedIn << " instead of " << controlIn << " !");
+            result = false;
+        }
+        for (size_t i = 0; i < begin && result; ++i)
+        {
+            if (tested[i].objects.size() || tested[i].events.size())
+            {
+                TEST_LOG_SS(Error, "Adaptive frame skip: unexpected metadata at quiet frame " << i << " !");
+                result = false;
+            }
+        }
+
+        Simd::Motion::FPoints roi;
+        roi.push_back(Simd::Motion::FPoint(-1.0, 1.0));
+        roi.push_back(Simd::Motion::FPoint(0.2, 1.0));
+        roi.push_back(Simd::Motion::FPoint(0.2, -1.0));
+        roi.push_back(Simd::Motion::FPoint(-1.0, -1.0));
+        Simd::Motion::Model left(model.size, roi);
+        MotionDetect(frames, left, options, control);
+        Simd::Motion::Options roiCrop(options);
+        roiCrop.CalibrationRoiCropEnable = true;
+        MotionDetect(frames, left, roiCrop, tested);
+        if (result && MotionEventCount(tested, Simd::Motion::Event::ObjectIn) == 0)
+        {
+            TEST_LOG_SS(Error, "ROI crop: moving object is not detected!");
+            result = false;
+        }
+        Rect box(0, 0, Simd::Motion::OnvifToScreenX(0.2 + 2.0 * roiCrop.CalibrationRoiCropMargin, width) + 8, height);
+        for (size_t i = 0; i < count && result; ++i)
+        {
+            for (size_t j = 0; j < tested[i].objects.size() && result; ++j)
+            {
+                const Rect & rect = tested[i].objects[j].rect;
+                if (!box.Contains(rect))
+                {
+                    TEST_LOG_SS(Error, "ROI crop: object (" << rect.left << ", " << rect.top << ", " << rect.right << ", " << rect.bottom << ") at frame " << i << " is out of crop region!");
+                    result = false;
+                }
+                if (control[i].objects.size() == 1 && tested[i].objects.size() == 1 && !control[i].objects[0].rect.Overlaps(rect))
+                {
+                    TEST_LOG_SS(Error, "ROI crop: object at frame " << i << " doesn't overlap object detected without crop!");
+                    result = false;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool MotionDetectorAutoTest()
+    {
+        bool result = true;
+
+        result = result && MotionDetectorAutoTest(320, 240);
+        result = result && MotionDetectorAutoTest(352, 288);
+
+        return result;
+    }
 }
@@ -247,6 +247,7 @@ namespace Test
         T avx512f;
         T avx512bw;
         T avx512vnni;
+        T avx512bf16;
         T vmx;
         T vsx;
         T neon;
@@ -301,6 +302,8 @@ namespace Test
             AddToFunction(src, dst.avx512bw, enable.avx512bw);
         if (desc.find("Simd::Avx512vnni::") != std::string::npos)
             AddToFunction(src, dst.avx512vnni, enable.avx512vnni);
+        if (desc.find("Simd::Avx512bf16::") != std::string::npos)
+            AddToFunction(src, dst.avx512bf16, enable.avx512bf16);
         if (desc.find("Simd::Vmx::") != std::string::npos)
             AddToFunction(src, dst.vmx, enable.vmx);
         if (desc.find("Simd::Vsx::") != std::string::npos)
@@ -333,6 +336,7 @@ namespace Test
         if (enable.avx512f) Add(Cond(s.avx512f, Cond(s.avx2, Cond(s.avx, Cond(s.sse41, Cond(s.ssse3, Cond(s.sse2, Cond(s.sse, s.base))))))), d.avx512f);
         if (enable.avx512bw) Add(Cond(s.avx512bw, Cond(s.avx512f, Cond(s.avx2, Cond(s.avx, Cond(s.sse41, Cond(s.ssse3, Cond(s.sse2, Cond(s.sse, s.base)))))))), d.avx512bw);
         if (enable.avx512vnni) Add(Cond(s.avx512vnni, Cond(s.avx512bw, Cond(s.avx512f, Cond(s.avx2, Cond(s.avx, Cond(s.sse41, Cond(s.ssse3, Cond(s.sse2, Cond(s.sse, s.base))))))))), d.avx512vnni);
+        if (enable.avx512bf16) Add(Cond(s.avx512bf16, Cond(s.avx512vnni, Cond(s.avx512bw, Cond(s.avx512f, Cond(s.avx2, Cond(s.avx, Cond(s.sse41, Cond(s.ssse3, Cond(s.sse2, Cond(s.sse, s.base)))))))))), d.avx512bf16);
         if (enable.vmx) Add(Cond(s.vmx, s.base), d.vmx);
         if (enable.vsx) Add(Cond(s.vsx, Cond(s.vmx, s.base)), d.vsx);
         if (enable.neon) Add(Cond(s.neon, s.base), d.neon);
@@ -362,7 +366,7 @@ namespace Test
             for (FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
                 report << it->second->Statistic() << std::endl;
         }
-        else
+        else if (map.size())
         {
             report << std::endl << std::endl << "Performance report:" << std::endl << std::endl;
             report << GenerateTable(align)->GenerateText();
@@ -441,8 +445,8 @@ namespace Test
 
         FunctionStatisticMap functions;
         CommonStatistic common;
-        StatisticEnable enable = { false, false, false, false, false, false, false, false, false, false, false, false, false, false };
-        StatisticNames names = { { "Simd", "S" },{ "Base", "B" },{ "Sse", "S1" },{ "Sse2", "S2" },{ "Ssse3", "S3" },{ "Sse41", "S4" },{ "Avx", "A1" },{ "Avx2", "A2" },{ "Avx5f", "A5" },{ "Avx5b", "A6" },{ "Avx5v", "A7" },{ "Vmx", "Vm" },{ "Vsx", "Vs" },{ "Neon", "N" } };
+        StatisticEnable enable = { false, false, false, false, false, false, false, false, false, false, false, false, false, false, false };
+        StatisticNames names = { { "Simd", "S" },{ "Base", "B" },{ "Sse", "S1" },{ "Sse2", "S2" },{ "Ssse3", "S3" },{ "Sse41", "S4" },{ "Avx", "A1" },{ "Avx2", "A2" },{ "Avx5f", "A5" },{ "Avx5b", "A6" },{ "Avx5v", "A7" },{ "Avx5h", "A8" },{ "Vmx", "Vm" },{ "Vsx", "Vs" },{ "Neon", "N" } };
         for (FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
         {
             const PerformanceMeasurer & pm = *it->second;
@@ -453,11 +457,15 @@ namespace Test
         for (FunctionStatisticMap::const_iterator it = functions.begin(); it != functions.end(); ++it)
             AddToCommon(it->second, enable, common);
 
-        size_t size = 0;
+        size_t size = 0, relations = 0;
         for (size_t i = 0; i < enable.Size(); ++i)
+        {
             if (enable[i])
                 size++;
-        TablePtr table(new Table(size*(align ? 4 : 3) - 3, 1 + functions.size()));
+            if (enable[i] && enable[1] && i > 1)
+                relations += 2;
+        }
+        TablePtr table(new Table(1 + size + relations + (align ? size : 0), 1 + functions.size()));
         AddHeader(*table, names, enable, align);
         size_t row = 0;
         table->SetRowProp(row, true, true);
@@ -147,6 +147,8 @@ namespace Test
         case SimdResizeMethodBilinear: return "B";
         case SimdResizeMethodCaffeInterp: return "C";
         case SimdResizeMethodArea: return "A";
+        case SimdResizeMethodBicubic: return "Bc";
+        case SimdResizeMethodLanczos3: return "L3";
         default: assert(0); return "";
         }
     }
@@ -309,6 +311,15 @@ namespace Test
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 2, f1, f2);
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 3, f1, f2);
         result = result && ResizerAutoTest(SimdResizeMethodArea, SimdResizeChannelByte, 4, f1, f2);
+        for (SimdResizeMethodType method = SimdResizeMethodBicubic; method <= SimdResizeMethodLanczos3; method = SimdResizeMethodType(method + 1))
+        {
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 1, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 2, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 3, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelByte, 4, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelFloat, 1, f1, f2);
+            result = result && ResizerAutoTest(method, SimdResizeChannelFloat, 3, f1, f2);
+        }
 #endif
 
         return result;
@@ -370,6 +381,238 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncCR
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, size_t channels, SimdResizeChannelType type,
+                const SimdResizeRoi * rois, size_t count, size_t dstWidth, size_t dstHeight, SimdResizeMethodType method);
+
+            FuncPtr func;
+            String description;
+
+            FuncCR(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdResizeChannelType t, size_t c, SimdResizeMethodType m)
+            {
+                std::stringstream ss;
+                ss << description;
+                ss << "[" << ToString(m) << "-" << ToString(t) << "-" << c << "]";
+                description = ss.str();
+            }
+
+            void Call(const View & src, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method, const std::vector<SimdResizeRoi> & rois, View & dst) const
+            {
+                size_t srcW = src.format == View::Float ? src.width / channels : src.width;
+                size_t dstW = dst.format == View::Float ? dst.width / channels : dst.width;
+                size_t dstH = dst.height / rois.size();
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, srcW, src.height, src.stride, channels, type, rois.data(), rois.size(), dstW, dstH, method);
+            }
+        };
+    }
+
+#define FUNC_CR(function) \
+    FuncCR(function, std::string(#function))
+
+    View::Format CropAndResizeFormat(SimdResizeChannelType type, size_t channels)
+    {
+        if (type == SimdResizeChannelFloat)
+            return View::Float;
+        switch (channels)
+        {
+        case 1: return View::Gray8;
+        case 2: return View::Uv16;
+        case 3: return View::Bgr24;
+        case 4: return View::Bgra32;
+        default:
+            assert(0);
+            return View::None;
+        }
+    }
+
+    template<class T> void CropAndResizeFillSmooth(View & view)
+    {
+        size_t size = view.width * view.PixelSize() / sizeof(T);
+        for (size_t row = 0; row < view.height; ++row)
+        {
+            T * data = view.Row<T>(row);
+            for (size_t col = 0; col < size; ++col)
+            {
+                size_t value = (col * 5 + row * 3) % 510;
+                data[col] = T(value < 256 ? value : 509 - value);
+            }
+        }
+    }
+
+    bool CropAndResizeAutoTest(SimdResizeChannelType type, size_t channels, SimdResizeMethodType method, size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t count, FuncCR f1, FuncCR f2)
+    {
+        bool result = true;
+
+        f1.Update(type, channels, method);
+        f2.Update(type, channels, method);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcW << ", " << srcH << "] -> " << count << " x [" << dstW << ", " << dstH << "].");
+
+        View::Format format = CropAndResizeFormat(type, channels);
+        size_t size = type == SimdResizeChannelFloat ? channels : 1;
+
+        View src(srcW * size, srcH, format, NULL, TEST_ALIGN(srcW));
+        if (format == View::Float)
+            FillRandom32f(src);
+        else
+            FillRandom(src);
+
+        View dst1(dstW * size, dstH * count, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW * size, dstH * count, format, NULL, TEST_ALIGN(dstW));
+
+        std::vector<float> affine(count * 6);
+        std::vector<SimdResizeRoi> rois1(count), rois2(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            SimdResizeRoi & roi = rois1[i];
+            roi.left = Random(int(srcW) * 4) / 8.0f - 2.0f;
+            roi.top = Random(int(srcH) * 4) / 8.0f - 2.0f;
+            roi.right = roi.left + 1.0f + Random(int(srcW) * 4) / 8.0f;
+            roi.bottom = roi.top + 1.0f + Random(int(srcH) * 4) / 8.0f;
+            roi.affine = NULL;
+            if (i % 4 == 3)
+            {
+                float * m = affine.data() + i * 6, angle = float(i) * 0.1f;
+                float scaleX = (roi.right - roi.left) / dstW, scaleY = (roi.bottom - roi.top) / dstH;
+                m[0] = ::cos(angle) * scaleX, m[1] = -::sin(angle) * scaleY, m[2] = roi.left;
+                m[3] = ::sin(angle) * scaleX, m[4] = ::cos(angle) * scaleY, m[5] = roi.top;
+                roi.affine = m;
+            }
+            roi.dst = dst1.data + i * dstH * dst1.stride;
+            roi.dstStride = dst1.stride;
+            rois2[i] = roi;
+            rois2[i].dst = dst2.data + i * dstH * dst2.stride;
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, channels, type, method, rois1, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, channels, type, method, rois2, dst2));
+
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+        else
+            result = result && Compare(dst1, dst2, 0, true, 64);
+
+        if (type == SimdResizeChannelByte)
+        {
+            SimdResizeRoi whole = { 0.0f, 0.0f, float(srcW), float(srcH), NULL, NULL, 0 };
+            View copy(srcW, srcH, format, NULL, TEST_ALIGN(srcW));
+            whole.dst = copy.data;
+            whole.dstStride = copy.stride;
+            f2.func(src.data, srcW, srcH, src.stride, channels, type, &whole, 1, srcW, srcH, method);
+            result = result && Compare(src, copy, 0, true, 64, 0, "identity");
+        }
+
+        return result;
+    }
+
+    bool CropAndResizeReferenceAutoTest(SimdResizeChannelType type, size_t channels, SimdResizeMethodType method, size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t count, FuncCR f)
+    {
+        bool result = true;
+
+        f.Update(type, channels, method);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " & SimdResizerRun on cropped image [" << srcW << ", " << srcH << "] -> " << count << " x [" << dstW << ", " << dstH << "].");
+
+        View::Format format = CropAndResizeFormat(type, channels);
+        size_t size = type == SimdResizeChannelFloat ? channels : 1;
+
+        View src(srcW * size, srcH, format, NULL, TEST_ALIGN(srcW));
+        // Resizer uses coarse interpolation weights for bytes and other rounding of coordinates, so it is a reference only for a smooth image.
+        if (format == View::Float)
+            CropAndResizeFillSmooth<float>(src);
+        else
+            CropAndResizeFillSmooth<uint8_t>(src);
+
+        View dst1(dstW * size, dstH * count, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW * size, dstH * count, format, NULL, TEST_ALIGN(dstW));
+
+        // Resizer has exact area weights only for power of 2 scales.
+        size_t maxX = 0, maxY = 0;
+        while ((dstW << (maxX + 1)) <= srcW)
+            maxX++;
+        while ((dstH << (maxY + 1)) <= srcH)
+            maxY++;
+
+        std::vector<SimdResizeRoi> rois(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t w = dstW + Random(int(srcW - dstW)), h = dstH + Random(int(srcH - dstH));
+            if (method == SimdResizeMethodArea)
+            {
+                w = dstW << Random(int(maxX) + 1);
+                h = dstH << Random(int(maxY) + 1);
+            }
+            size_t x = Random(int(srcW - w + 1)), y = Random(int(srcH - h + 1));
+            SimdResizeRoi & roi = rois[i];
+            roi.left = float(x);
+            roi.top = float(y);
+            roi.right = float(x + w);
+            roi.bottom = float(y + h);
+            roi.affine = NULL;
+            roi.dst = dst1.data + i * dstH * dst1.stride;
+            roi.dstStride = dst1.stride;
+
+            View crop = src.Region(x * size, y, (x + w) * size, y + h);
+            void * resizer = SimdResizerInit(w, h, dstW, dstH, channels, type, method);
+            SimdResizerRun(resizer, crop.data, crop.stride, dst2.data + i * dstH * dst2.stride, dst2.stride);
+            SimdRelease(resizer);
+        }
+
+        f.Call(src, channels, type, method, rois, dst1);
+
+        if (format == View::Float)
+            result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        else
+            result = result && Compare(dst1, dst2, 1, true, 64);
+
+        return result;
+    }
+
+    bool CropAndResizeAutoTest(const FuncCR & f1, const FuncCR & f2)
+    {
+        bool result = true;
+
+        for (SimdResizeMethodType method = SimdResizeMethodBilinear; method <= SimdResizeMethodArea; method = SimdResizeMethodType(method + 2))
+        {
+            result = result && CropAndResizeAutoTest(SimdResizeChannelByte, 1, method, W, H, 112, 112, 16, f1, f2);
+            result = result && CropAndResizeAutoTest(SimdResizeChannelByte, 3, method, W, H, 112, 112, 16, f1, f2);
+            result = result && CropAndResizeAutoTest(SimdResizeChannelByte, 4, method, W - O, H + O, 57, 35, 9, f1, f2);
+            result = result && CropAndResizeAutoTest(SimdResizeChannelFloat, 1, method, W, H, 112, 112, 16, f1, f2);
+            result = result && CropAndResizeAutoTest(SimdResizeChannelFloat, 3, method, W + O, H - O, 57, 35, 9, f1, f2);
+        }
+
+        result = result && CropAndResizeReferenceAutoTest(SimdResizeChannelByte, 1, SimdResizeMethodBilinear, W, H, 112, 112, 8, f1);
+        result = result && CropAndResizeReferenceAutoTest(SimdResizeChannelByte, 3, SimdResizeMethodBilinear, W, H, 57, 35, 8, f1);
+        result = result && CropAndResizeReferenceAutoTest(SimdResizeChannelFloat, 3, SimdResizeMethodBilinear, W, H, 57, 35, 8, f1);
+        result = result && CropAndResizeReferenceAutoTest(SimdResizeChannelByte, 1, SimdResizeMethodArea, W, H, 112, 112, 8, f1);
+        result = result && CropAndResizeReferenceAutoTest(SimdResizeChannelByte, 4, SimdResizeMethodArea, W, H, 57, 35, 8, f1);
+
+        return result;
+    }
+
+    bool CropAndResizeAutoTest()
+    {
+        bool result = true;
+
+        result = result && CropAndResizeAutoTest(FUNC_CR(Simd::Base::CropAndResize), FUNC_CR(SimdCropAndResize));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && CropAndResizeAutoTest(FUNC_CR(Simd::Avx2::CropAndResize), FUNC_CR(SimdCropAndResize));
+#endif
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool ResizeDataTest(bool create, int width, int height, View::Format format, const FuncRB & f)
     {
         bool result = true;
@@ -26,6 +26,8 @@
 #include "Test/TestData.h"
 #include "Test/TestTensor.h"
 
+#include "Simd/SimdSynetYuvToTensor.h"
+
 namespace Test
 {
     template<class S, class D> struct FuncCvt
@@ -328,6 +330,114 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncYT
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH,
+                SimdPixelFormatType order, const float* mean, const float* scale, SimdTensorFormatType format);
+
+            FuncPtr func;
+            String desc;
+
+            FuncYT(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH, SimdPixelFormatType order, SimdTensorFormatType format)
+            {
+                desc = desc + "[" + ToString(srcW) + "x" + ToString(srcH) + (layout == SimdYuvLayoutNv12 ? "-nv12" : "-420p") + "->" +
+                    ToString(dstW) + "x" + ToString(dstH) + (order == SimdPixelFormatRgb24 ? "-rgb-" : "-bgr-") + ToString(format) + "]";
+            }
+
+            void Call(void* context, const View& y, const View& u, const View& v, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetYuvToTensorRun(context, y.data, y.stride, u.data, u.stride, v.data, v.stride, dst.Data());
+            }
+        };
+    }
+
+#define FUNC_YT(function) FuncYT(function, #function)
+
+    bool SynetYuvToTensorAutoTest(size_t srcW, size_t srcH, SimdYuvLayoutType layout, size_t dstW, size_t dstH, SimdPixelFormatType order, SimdTensorFormatType format, FuncYT f1, FuncYT f2)
+    {
+        bool result = true;
+
+        f1.Update(srcW, srcH, layout, dstW, dstH, order, format);
+        f2.Update(srcW, srcH, layout, dstW, dstH, order, format);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc);
+
+        View y(srcW, srcH, View::Gray8), u(srcW / 2, srcH / 2, View::Gray8), v(srcW / 2, srcH / 2, View::Gray8);
+        FillRandom(y);
+        FillRandom(u);
+        FillRandom(v);
+        View uv(srcW / 2, srcH / 2, View::Uv16);
+        Simd::InterleaveUv(u, v, uv);
+
+        const float mean[3] = { 104.0f, 117.0f, 123.0f }, scale[3] = { 0.017f, 0.018f, 0.019f };
+
+        Tensor32f dst1(ToShape(1, 3, dstH, dstW, format), format);
+        Tensor32f dst2(ToShape(1, 3, dstH, dstW, format), format);
+        Tensor32f dst3(ToShape(1, 3, dstH, dstW, format), format);
+
+        void* context1 = f1.func(srcW, srcH, layout, dstW, dstH, order, mean, scale, format);
+        void* context2 = f2.func(srcW, srcH, layout, dstW, dstH, order, mean, scale, format);
+        void* context3 = f2.func(srcW, srcH, SimdYuvLayout420p, dstW, dstH, order, mean, scale, format);
+
+        const View& u1 = layout == SimdYuvLayoutNv12 ? uv : u;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, y, u1, v, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, y, u1, v, dst2));
+
+        ::SimdSynetYuvToTensorRun(context3, y.data, y.stride, u.data, u.stride, v.data, v.stride, dst3.Data());
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+        ::SimdRelease(context3);
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+        result = result && Compare(dst2, dst3, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetYuvToTensorAutoTest(const FuncYT& f1, const FuncYT& f2)
+    {
+        bool result = true;
+
+        SimdYuvLayoutType layouts[2] = { SimdYuvLayout420p, SimdYuvLayoutNv12 };
+        SimdTensorFormatType formats[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+
+        for (int l = 0; l < 2; ++l)
+        {
+            for (int f = 0; f < 2; ++f)
+            {
+                result = result && SynetYuvToTensorAutoTest(W, H, layouts[l], 300, 300, SimdPixelFormatBgr24, formats[f], f1, f2);
+                result = result && SynetYuvToTensorAutoTest(W / 2, H / 2, layouts[l], W - O, H + O, SimdPixelFormatRgb24, formats[f], f1, f2);
+            }
+        }
+        result = result && SynetYuvToTensorAutoTest(32, 18, SimdYuvLayoutNv12, 21, 13, SimdPixelFormatRgb24, SimdTensorFormatNhwc, f1, f2);
+
+        return result;
+    }
+
+    bool SynetYuvToTensorAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetYuvToTensorAutoTest(FUNC_YT(Simd::Base::SynetYuvToTensorInit), FUNC_YT(SimdSynetYuvToTensorInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetYuvToTensorAutoTest(FUNC_YT(Simd::Avx2::SynetYuvToTensorInit), FUNC_YT(SimdSynetYuvToTensorInit));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
     namespace
     {
         struct FuncRT
@@ -0,0 +1,207 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+#include "Test/TestTensor.h"
+#include "Test/TestSynetConvolutionParam.h"
+
+#include "Simd/SimdSynetConvolution16b.h"
+
+namespace Test
+{
+    namespace
+    {
+        typedef Test::SynetConvolutionParam<false> Param;
+
+        struct FuncC
+        {
+            typedef void*(*FuncPtr)(size_t batch, const SimdConvolutionParameters * conv);
+
+            FuncPtr func;
+            String desc;
+
+            FuncC(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(const Param & p)
+            {
+                const char* afs[] = { "-id", "-re", "-lr", "-rr", "-pr", "-el", "-hs", "-mi" };
+                desc = desc + p.Decription(String(afs[p.conv.activation]) + 
+                    (p.conv.srcT == SimdTensorData16b ? "-b" : "-f") + (p.conv.dstT == SimdTensorData16b ? "b" : "f"));
+            }
+
+            void Call(void * context, const uint8_t * src, uint8_t * buf, uint8_t * dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                ::SimdSynetConvolution16bForward(context, src, buf, dst);
+            }
+        };
+    }
+
+#define FUNC_C(function) \
+    FuncC(function, std::string(#function))
+
+    bool SynetConvolution16bForwardAutoTest(float eps, Param p, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "].");
+
+        const SimdConvolutionParameters & c = p.conv;
+
+        Tensor32f weight(p.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), -3.0f, 3.0f);
+        if (p.conv.activation == ::SimdConvolutionActivationHswish)
+        {
+            params.Data()[0] = 3.0f;
+            params.Data()[1] = 1.0f / 6.0f;
+        }
+        else if (p.conv.activation == ::SimdConvolutionActivationMish)
+            params.Data()[0] = 20.0f;
+        else
+        {
+            params.Data()[0] = 0.1f;
+            params.Data()[1] = 1.1f;
+        }
+
+        Tensor32f src32f(p.SrcShape(), p.conv.srcF), dst32f1(p.DstShape(), p.conv.dstF), dst32f2(p.DstShape(), p.conv.dstF);
+        Tensor16u src16b(p.SrcShape(), p.conv.srcF), dst16b1(p.DstShape(), p.conv.dstF), dst16b2(p.DstShape(), p.conv.dstF);
+        Tensor8u buf;
+
+        FillRandom(src32f.Data(), src32f.Size(), -1.0, 1.0f);
+        SimdFloat32ToBFloat16(src32f.Data(), src32f.Size(), src16b.Data());
+
+        const uint8_t * src = p.conv.srcT == SimdTensorData32f ? (uint8_t*)src32f.Data() : (uint8_t*)src16b.Data();
+        uint8_t* dst1 = p.conv.dstT == SimdTensorData32f ? (uint8_t*)dst32f1.Data() : (uint8_t*)dst16b1.Data();
+        uint8_t* dst2 = p.conv.dstT == SimdTensorData32f ? (uint8_t*)dst32f2.Data() : (uint8_t*)dst16b2.Data();
+
+        Fill(dst32f1, 0.1f);
+        Fill(dst32f2, 1.1f);
+
+        void * context1 = f1.func(p.batch, &p.conv);
+        void * context2 = f2.func(p.batch, &p.conv);
+
+        buf.Extend({ ::SimdSynetConvolution16bExternalBufferSize(context1) });
+        buf.Extend({ ::SimdSynetConvolution16bExternalBufferSize(context2) });
+
+        ::SimdSynetConvolution16bSetParams(context1, weight.Data(), bias.Data(), params.Data());
+        ::SimdSynetConvolution16bSetParams(context2, weight.Data(), bias.Data(), params.Data());
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, buf.Data(), dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, buf.Data(), dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        Tensor32f srcRef(p.SrcShape(), p.conv.srcF), weightRef(p.WeightShape()), dstRef(p.DstShape(), p.conv.dstF);
+        Tensor16u weight16b(p.WeightShape());
+        SimdBFloat16ToFloat32(src16b.Data(), src16b.Size(), srcRef.Data());
+        SimdFloat32ToBFloat16(weight.Data(), weight.Size(), weight16b.Data());
+        SimdBFloat16ToFloat32(weight16b.Data(), weight16b.Size(), weightRef.Data());
+
+        SimdConvolutionParameters conv32f = p.conv;
+        conv32f.srcT = SimdTensorData32f;
+        conv32f.dstT = SimdTensorData32f;
+        void * contextRef = ::SimdSynetConvolution32fInit(p.batch, &conv32f, NULL);
+        Tensor32f bufRef({ ::SimdSynetConvolution32fExternalBufferSize(contextRef) });
+        ::SimdSynetConvolution32fSetParams(contextRef, weightRef.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fForward(contextRef, srcRef.Data(), bufRef.Data(), dstRef.Data());
+        ::SimdRelease(contextRef);
+
+        if (p.conv.dstT == SimdTensorData16b)
+        {
+            SimdBFloat16ToFloat32(dst16b1.Data(), dst16b1.Size(), dst32f1.Data());
+            SimdBFloat16ToFloat32(dst16b2.Data(), dst16b2.Size(), dst32f2.Data());
+            Tensor16u dst16bRef(p.DstShape(), p.conv.dstF);
+            SimdFloat32ToBFloat16(dstRef.Data(), dstRef.Size(), dst16bRef.Data());
+            SimdBFloat16ToFloat32(dst16bRef.Data(), dst16bRef.Size(), dstRef.Data());
+            eps = eps * 8.0f;
+        }
+
+        result = result && Compare(dst32f1, dst32f2, eps, true, 64, DifferenceBoth);
+
+        result = result && Compare(dst32f1, dstRef, eps, true, 64, DifferenceBoth, "fp32 reference");
+
+        return result;
+    }
+
+    bool SynetConvolution16bForwardAutoTest(const FuncC& f1, const FuncC& f2)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3), _5(5, 5);
+        const float e = EPS;
+        const SimdBool t1 = SimdTrue;
+        const SimdTensorDataType f32 = SimdTensorData32f, b16 = SimdTensorData16b;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu, 
+            aLr = SimdConvolutionActivationLeakyRelu, aRr = SimdConvolutionActivationRestrictRange, aPr = SimdConvolutionActivationPrelu, 
+            aHs = SimdConvolutionActivationHswish;
+
+#ifdef NDEBUG
+#if 1
+        result = result && SynetConvolution16bForwardAutoTest(e, Param(1, 64, 40, 40, 64, _1, _1, _1, _0, _0, 1, aRe, t1, f32, f32), f1, f2);
+        result = result && SynetConvolution16bForwardAutoTest(e, Param(1, 64, 40, 40, 75, _1, _1, _1, _0, _0, 1, aId, t1, b16, b16), f1, f2);
+        result = result && SynetConvolution16bForwardAutoTest(e, Param(1, 3, 100, 100, 32, _3, _1, _2, _1, _1, 1, aLr, t1, f32, b16), f1, f2);
+        result = result && SynetConvolution16bForwardAutoTest(e, Param(2, 33, 30, 30, 48, _3, _1, _1, _1, _1, 1, aRr, t1, b16, f32), f1, f2);
+        result = result && SynetConvolution16bForwardAutoTest(e, Param(1, 32, 25, 25, 17, _5, _1, _1, _2, _2, 1, aPr, t1, f32, f32), f1, f2);
+        result = result && SynetConvolution16bForwardAutoTest(e, Param(1, 64, 20, 20, 64, _3, _1, _1, _1, _1, 2, aHs, t1, f32, f32), f1, f2);
+#endif
+#else
+        result = result && SynetConvolution16bForwardAutoTest(e, Param(1, 33, 17, 15, 21, _3, _1, _1, _1, _1, 1, aRe, t1, f32, b16), f1, f2);
+#endif
+
+        return result;
+    }
+
+    bool SynetConvolution16bForwardAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution16bForwardAutoTest(FUNC_C(Simd::Base::SynetConvolution16bInit), FUNC_C(SimdSynetConvolution16bInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution16bForwardAutoTest(FUNC_C(Simd::Avx2::SynetConvolution16bInit), FUNC_C(SimdSynetConvolution16bInit));
+#endif
+
+#ifdef SIMD_AVX512BF16_ENABLE
+        if (Simd::Avx512bf16::Enable)
+            result = result && SynetConvolution16bForwardAutoTest(FUNC_C(Simd::Avx512bf16::SynetConvolution16bInit), FUNC_C(SimdSynetConvolution16bInit));
+#endif
+
+        return result;
+    }
+}
@@ -546,6 +546,54 @@ namespace Test
         return result;
     }
 
+    bool SynetConvolution32fTuningReuseAutoTest(const String & path)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test reuse of SynetConvolution32f tuning cache.");
+
+        std::vector<String> lines;
+        {
+            std::ifstream ifs(path.c_str());
+            String line, key, name;
+            while (std::getline(ifs, line))
+            {
+                std::stringstream ss(line);
+                if (line.empty() || line[0] == '#' || !(ss >> key >> name))
+                    continue;
+                lines.push_back(key + " GemmNN");
+            }
+        }
+        if (lines.empty())
+        {
+            TEST_LOG_SS(Error, "Tuning file '" << path << "' is empty!");
+            return false;
+        }
+        {
+            std::ofstream ofs(path.c_str());
+            for (size_t i = 0; i < lines.size(); ++i)
+                ofs << lines[i] << std::endl;
+        }
+        if (!::SimdSynetLoadTuning(path.c_str()))
+        {
+            TEST_LOG_SS(Error, "Can't load tuning file '" << path << "'!");
+            return false;
+        }
+
+        const Size _1(1, 1), _3(3, 3);
+        Param p(1, 96, 12, 12, 96, _3, _1, _1, _1, _1, 1, ::SimdConvolutionActivationPrelu, ::SimdTrue);
+        ::SimdSynetSetTuning(::SimdSynetTuningCached);
+        Simd::SynetConvolution32f * conv = (Simd::SynetConvolution32f*)Simd::Base::SynetConvolution32fInit(p.batch, &p.conv, NULL);
+        if (conv == NULL || conv->Desc().find("::GemmNN") == String::npos)
+        {
+            TEST_LOG_SS(Error, "Cached tuning winner GemmNN is not reused: " << (conv ? conv->Desc() : String("NULL")) << "!");
+            result = false;
+        }
+        delete conv;
+
+        return result;
+    }
+
     bool SynetConvolution32fForwardAutoTest()
     {
         const float EPS = 0.001f;
@@ -583,6 +631,234 @@ namespace Test
             result = result && SynetConvolution32fForwardAutoTest(2 * EPS, FUNC_C(Simd::Neon::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
 #endif
 
+        if (result)
+        {
+            String path = TempPath("_synet_tuning.txt");
+            ::SimdSynetSetTuning(::SimdSynetTuningBenchmark);
+            result = result && SynetConvolution32fForwardAutoTest(2 * EPS, FUNC_C(Simd::Base::SynetConvolution32fInit), FUNC_C(SimdSynetConvolution32fInit));
+            if (result && !::SimdSynetSaveTuning(path.c_str()))
+            {
+                TEST_LOG_SS(Error, "Can't save tuning file '" << path << "'!");
+                result = false;
+            }
+            result = result && SynetConvolution32fTuningReuseAutoTest(path);
+            ::SimdSynetSetTuning(::SimdSynetTuningNone);
+            std::remove(path.c_str());
+        }
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool SynetConvolution32fReshapeAutoTest(float eps, const Param & p, size_t srcH, size_t srcW, FuncC f)
+    {
+        bool result = true;
+
+        Param q = p;
+        q.conv.srcH = srcH;
+        q.conv.srcW = srcW;
+        q.conv.dstH = (srcH + p.conv.padY + p.conv.padH - (p.conv.dilationY * (p.conv.kernelY - 1) + 1)) / p.conv.strideY + 1;
+        q.conv.dstW = (srcW + p.conv.padX + p.conv.padW - (p.conv.dilationX * (p.conv.kernelX - 1) + 1)) / p.conv.strideX + 1;
+
+        f.Update(q);
+
+        const SimdConvolutionParameters & c = q.conv;
+        Tensor32f src(q.SrcShape());
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight(q.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+
+        Tensor32f buf1, buf2, dst1(q.DstShape()), dst2(q.DstShape());
+        ::SimdFill32f(dst1.Data(), dst1.Size(), params.Data() + 0);
+        ::SimdFill32f(dst2.Data(), dst2.Size(), params.Data() + 1);
+
+        void * context1 = f.func(p.batch, &p.conv, NULL);
+        void * context2 = f.func(q.batch, &q.conv, NULL);
+
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+
+        if (::SimdSynetConvolution32fReshape(context1, srcH, srcW))
+        {
+            TEST_LOG_SS(Info, "Test " << f.desc << " reshape from " << p.conv.srcH << "x" << p.conv.srcW << ".");
+
+            buf1.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context1) });
+            buf2.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context2) });
+
+            ::SimdSynetConvolution32fForward(context1, src.Data(), buf1.Data(), dst1.Data());
+            ::SimdSynetConvolution32fForward(context2, src.Data(), buf2.Data(), dst2.Data());
+
+            result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+        }
+        else
+        {
+            TEST_LOG_SS(Error, "Can't reshape " << f.desc << " from " << p.conv.srcH << "x" << p.conv.srcW << "!");
+            result = false;
+        }
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fReshapeAutoTest(float eps, FuncC f)
+    {
+        bool result = true;
+
+        const SimdBool t1 = SimdTrue;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu, aPr = SimdConvolutionActivationPrelu;
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+
+        result = result && SynetConvolution32fReshapeAutoTest(eps, Param(1, 64, 32, 32, 64, _3, _1, _1, _1, _1, 1, aRe, t1), 57, 41, f);
+        result = result && SynetConvolution32fReshapeAutoTest(eps, Param(1, 64, 64, 48, 96, _1, _1, _1, _0, _0, 1, aPr, t1), 17, 23, f);
+        result = result && SynetConvolution32fReshapeAutoTest(eps, Param(1, 3, 96, 96, 32, _3, _1, _2, _1, _1, 1, aRe, t1), 131, 75, f);
+        result = result && SynetConvolution32fReshapeAutoTest(eps, Param(2, 32, 20, 20, 48, _3, _1, _1, _0, _0, 1, aRe, t1), 38, 27, f);
+
+        return result;
+    }
+
+    bool SynetConvolution32fReshapeAutoTest()
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        result = result && SynetConvolution32fReshapeAutoTest(EPS, FUNC_C(Simd::Base::SynetConvolution32fInit));
+
+#ifdef SIMD_SSE2_ENABLE
+        if (Simd::Sse2::Enable)
+            result = result && SynetConvolution32fReshapeAutoTest(EPS, FUNC_C(Simd::Sse2::SynetConvolution32fInit));
+#endif 
+
+#ifdef SIMD_AVX_ENABLE
+        if (Simd::Avx::Enable)
+            result = result && SynetConvolution32fReshapeAutoTest(EPS, FUNC_C(Simd::Avx::SynetConvolution32fInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution32fReshapeAutoTest(EPS, FUNC_C(Simd::Avx2::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetConvolution32fReshapeAutoTest(EPS, FUNC_C(Simd::Avx512f::SynetConvolution32fInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution32fReshapeAutoTest(EPS, FUNC_C(Simd::Neon::SynetConvolution32fInit));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    static void * SynetConvolution32fGemmNNInit(size_t batch, const SimdConvolutionParameters * conv, SimdGemm32fNNPtr gemm)
+    {
+        return new Simd::Base::SynetConvolution32fGemmNN(Simd::ConvParam32f(batch, conv, gemm));
+    }
+
+    bool SynetConvolution32fSparseAutoTest(float eps, const Param & p, float sparsity, FuncC f1, FuncC f2)
+    {
+        bool result = true;
+
+        f1.Update(p);
+        f2.Update(p);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << "] with sparsity " << sparsity << ".");
+
+        const SimdConvolutionParameters & c = p.conv;
+        Tensor32f src(p.SrcShape());
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f weight(p.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+        for (size_t i = 0; i < weight.Size(); ++i)
+            if (Random() < sparsity)
+                weight.Data()[i] = 0.0f;
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+
+        Tensor32f buf, dst1(p.DstShape()), dst2(p.DstShape());
+        ::SimdFill32f(dst1.Data(), dst1.Size(), params.Data() + 0);
+        ::SimdFill32f(dst2.Data(), dst2.Size(), params.Data() + 1);
+
+        void * context1 = f1.func(p.batch, &p.conv, NULL);
+        void * context2 = f2.func(p.batch, &p.conv, NULL);
+
+        buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context1) });
+        buf.Extend({ ::SimdSynetConvolution32fExternalBufferSize(context2) });
+
+        ::SimdSynetConvolution32fSetParams(context1, weight.Data(), NULL, bias.Data(), params.Data());
+        ::SimdSynetConvolution32fSetParams(context2, weight.Data(), NULL, bias.Data(), params.Data());
+
+        String desc = ((Simd::SynetConvolution32f*)context1)->Desc();
+        if ((desc.find("::Sparse-") != String::npos) != (sparsity > 0.5f))
+        {
+            TEST_LOG_SS(Error, "Unexpected engine " << desc << " was selected for sparsity " << sparsity << "!");
+            result = false;
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, buf, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, buf, dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetConvolution32fSparseAutoTest(float eps, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        const SimdBool t0 = SimdFalse, t1 = SimdTrue;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu, aPr = SimdConvolutionActivationPrelu;
+        const Size _0(0, 0), _1(1, 1);
+
+        result = result && SynetConvolution32fSparseAutoTest(eps, Param(1, 128, 19, 21, 96, _1, _1, _1, _0, _0, 1, aRe, t1), 0.9f, f1, f2);
+        result = result && SynetConvolution32fSparseAutoTest(eps, Param(2, 96, 17, 15, 131, _1, _1, _1, _0, _0, 1, aPr, t1), 0.8f, f1, f2);
+        result = result && SynetConvolution32fSparseAutoTest(eps, Param(1, 64, 13, 11, 64, _1, _1, _1, _0, _0, 1, aId, t1), 0.3f, f1, f2);
+        result = result && SynetConvolution32fSparseAutoTest(eps, Param(1, 128, 19, 21, 96, _1, _1, _1, _0, _0, 1, aRe, t0), 0.9f, f1, f2);
+        result = result && SynetConvolution32fSparseAutoTest(eps, Param(2, 96, 17, 15, 131, _1, _1, _1, _0, _0, 1, aPr, t0), 0.8f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetConvolution32fSparseAutoTest()
+    {
+        const float EPS = 0.001f;
+        bool result = true;
+
+        result = result && SynetConvolution32fSparseAutoTest(EPS, FUNC_C(Simd::Base::SynetConvolution32fInit), FUNC_C(SynetConvolution32fGemmNNInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution32fSparseAutoTest(EPS, FUNC_C(Simd::Avx2::SynetConvolution32fInit), FUNC_C(SynetConvolution32fGemmNNInit));
+#endif
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && SynetConvolution32fSparseAutoTest(EPS, FUNC_C(Simd::Avx512f::SynetConvolution32fInit), FUNC_C(SynetConvolution32fGemmNNInit));
+#endif
+
         return result;
     }
 }
@@ -209,6 +209,11 @@ namespace Test
         result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 128, 20, 12, 128, _1, _1, _1, _0, _0, 1, aMi, t1, u8, u8), 1, c, f1, f2);
         result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 128, 20, 12, 128, _3, _1, _1, _1, _1, 128, aMi, t1, u8, u8), 1, c, f1, f2);
 #endif
+#if 1
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(8, 64, 28, 28, 64, _1, _1, _1, _0, _0, 1, aRe, t1, u8, u8), 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(8, 32, 28, 28, 48, _3, _1, _1, _1, _1, 1, aRe, t1, f32, f32), 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(8, 64, 28, 28, 64, _3, _1, _1, _1, _1, 64, aRe, t1, u8, u8), 0, c, f1, f2);
+#endif
 #else
         result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 99, 90, 130, 99, _3, _1, _2, _1, _1, 99, aMi, t1, f32, u8), 1, c, f1, f2);
 #endif
@@ -264,4 +269,176 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------
+
+    template<class T> void* SynetConvolution8iInitAs(size_t batch, const SimdConvolutionParameters* conv, SimdSynetCompatibilityType compatibility)
+    {
+        Simd::ConvParam8i param(batch, conv, compatibility);
+        return param.Valid() ? new T(param) : NULL;
+    }
+
+#define FUNC_W(type) \
+    FuncC(SynetConvolution8iInitAs<type>, std::string(#type))
+
+    bool SynetConvolution8iWinogradAutoTest(const FuncC& f1, const FuncC& f2, SimdSynetCompatibilityType c)
+    {
+        bool result = true;
+
+        const Size _0(0, 0), _1(1, 1), _3(3, 3);
+        const float e = EPS;
+        const SimdBool t1 = SimdTrue;
+        const SimdTensorDataType f32 = SimdTensorData32f, u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aId = SimdConvolutionActivationIdentity, aRe = SimdConvolutionActivationRelu, aPr = SimdConvolutionActivationPrelu;
+
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 16, 16, 64, _3, _1, _1, _1, _1, 1, aRe, t1, u8, u8), 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 64, 16, 16, 64, _3, _1, _1, _0, _0, 1, aRe, t1, u8, u8), 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(2, 35, 13, 9, 41, _3, _1, _1, _1, _1, 1, aPr, t1, u8, u8), 1, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 33, 11, 15, 17, _3, _1, _1, _0, _0, 1, aId, t1, f32, f32), 0, c, f1, f2);
+        result = result && SynetConvolution8iForwardAutoTest(e, Param(1, 256, 10, 10, 48, _3, _1, _1, _1, _1, 1, aRe, t1, f32, u8), 1, c, f1, f2);
+
+        return result;
+    }
+
+    bool SynetConvolution8iWinogradAutoTest(const FuncC& f1, const FuncC& f2)
+    {
+        bool result = true;
+
+        SimdSynetCompatibilityType p = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iPrecise | SimdSynetCompatibilityFmaAvoid);
+        SimdSynetCompatibilityType n = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iNarrowed | SimdSynetCompatibilityFmaAvoid);
+
+        result = result && SynetConvolution8iWinogradAutoTest(f1, f2, p);
+        result = result && SynetConvolution8iWinogradAutoTest(f1, f2, n);
+
+        return result;
+    }
+
+    bool SynetConvolution8iWinogradAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution8iWinogradAutoTest(FUNC_W(Simd::Base::SynetConvolution8iNhwcWinograd), FUNC_W(Simd::Base::SynetConvolution8iGemmNN));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution8iWinogradAutoTest(FUNC_W(Simd::Avx2::SynetConvolution8iNhwcWinograd), FUNC_W(Simd::Base::SynetConvolution8iGemmNN));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool SynetConvolution8iReshapeAutoTest(const Param & p, size_t srcH, size_t srcW, SimdSynetCompatibilityType comp, FuncC f)
+    {
+        bool result = true;
+
+        Param q = p;
+        q.conv.srcH = srcH;
+        q.conv.srcW = srcW;
+        q.conv.dstH = (srcH + p.conv.padY + p.conv.padH - (p.conv.dilationY * (p.conv.kernelY - 1) + 1)) / p.conv.strideY + 1;
+        q.conv.dstW = (srcW + p.conv.padX + p.conv.padW - (p.conv.dilationX * (p.conv.kernelX - 1) + 1)) / p.conv.strideX + 1;
+
+        f.Update(q, comp);
+
+        const SimdConvolutionParameters & c = q.conv;
+        Tensor32f weight(q.WeightShape());
+        FillRandom(weight.Data(), weight.Size(), -1.0, 1.0f);
+
+        Tensor32f bias({ c.dstC });
+        FillRandom(bias.Data(), bias.Size(), -1.0, 1.0f);
+
+        Tensor32f params({ c.dstC });
+        FillRandom(params.Data(), params.Size(), 0.0f, 2.0f);
+
+        Tensor32f srcMin({ c.srcC }), srcMax({ c.srcC }), dstMin({ c.dstC }), dstMax({ c.dstC });
+        Fill(srcMin, 0.0f);
+        Fill(srcMax, 1.0f);
+        Fill(dstMin, -4.0f);
+        Fill(dstMax, 4.0f);
+        const float* stats[4] = { srcMin.Data(), srcMax.Data(), dstMin.Data(), dstMax.Data() };
+
+        Tensor8u src(q.SrcShape(), c.srcF), buf1, buf2, dst1(q.DstShape(), c.dstF), dst2(q.DstShape(), c.dstF);
+        FillRandom(src);
+        Fill(dst1, uint8_t(1));
+        Fill(dst2, uint8_t(2));
+
+        void * context1 = f.func(p.batch, &p.conv, comp);
+        void * context2 = f.func(q.batch, &q.conv, comp);
+
+        ::SimdSynetConvolution8iSetParams(context1, weight.Data(), bias.Data(), params.Data(), stats);
+        ::SimdSynetConvolution8iSetParams(context2, weight.Data(), bias.Data(), params.Data(), stats);
+
+        if (::SimdSynetConvolution8iReshape(context1, srcH, srcW))
+        {
+            TEST_LOG_SS(Info, "Test " << f.desc << " reshape from " << p.conv.srcH << "x" << p.conv.srcW << ".");
+
+            buf1.Extend({ ::SimdSynetConvolution8iExternalBufferSize(context1) });
+            buf2.Extend({ ::SimdSynetConvolution8iExternalBufferSize(context2) });
+
+            ::SimdSynetConvolution8iForward(context1, src.Data(), buf1.Data(), dst1.Data());
+            ::SimdSynetConvolution8iForward(context2, src.Data(), buf2.Data(), dst2.Data());
+
+            result = result && Compare(dst1, dst2, 0, true, 64);
+        }
+        else
+            TEST_LOG_SS(Info, "Skip " << f.desc << ": reshape is not supported.");
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        return result;
+    }
+
+    bool SynetConvolution8iReshapeAutoTest(const FuncC& f)
+    {
+        bool result = true;
+
+        const SimdBool t1 = SimdTrue;
+        const SimdTensorDataType u8 = SimdTensorData8u;
+        const SimdConvolutionActivationType aRe = SimdConvolutionActivationRelu;
+        const Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+        SimdSynetCompatibilityType c = (SimdSynetCompatibilityType)(SimdSynetCompatibility8iNarrowed | SimdSynetCompatibilityFmaAvoid);
+
+        result = result && SynetConvolution8iReshapeAutoTest(Param(1, 64, 32, 32, 64, _3, _1, _1, _1, _1, 1, aRe, t1, u8, u8), 57, 41, c, f);
+        result = result && SynetConvolution8iReshapeAutoTest(Param(4, 32, 40, 40, 48, _1, _1, _1, _0, _0, 1, aRe, t1, u8, u8), 17, 23, c, f);
+        result = result && SynetConvolution8iReshapeAutoTest(Param(2, 64, 30, 30, 64, _3, _1, _2, _1, _1, 64, aRe, t1, u8, u8), 45, 37, c, f);
+        result = result && SynetConvolution8iReshapeAutoTest(Param(1, 16, 24, 24, 24, _3, _1, _1, _0, _0, 1, aRe, ::SimdFalse, u8, u8), 31, 19, c, f);
+
+        return result;
+    }
+
+    bool SynetConvolution8iReshapeAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetConvolution8iReshapeAutoTest(FUNC_C(Simd::Base::SynetConvolution8iInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetConvolution8iReshapeAutoTest(FUNC_C(Simd::Sse41::SynetConvolution8iInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetConvolution8iReshapeAutoTest(FUNC_C(Simd::Avx2::SynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetConvolution8iReshapeAutoTest(FUNC_C(Simd::Avx512bw::SynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_AVX512VNNI_ENABLE
+        if (Simd::Avx512vnni::Enable)
+            result = result && SynetConvolution8iReshapeAutoTest(FUNC_C(Simd::Avx512vnni::SynetConvolution8iInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetConvolution8iReshapeAutoTest(FUNC_C(Simd::Neon::SynetConvolution8iInit));
+#endif 
+
+        return result;
+    }
 }
@@ -0,0 +1,143 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+#include "Test/TestTensor.h"
+
+#include "Simd/SimdSynetNetwork.hpp"
+
+namespace Test
+{
+    namespace
+    {
+        struct Net
+        {
+            SimdTensorFormatType format;
+            std::vector<Simd::SynetLayer> layers;
+            std::vector<std::shared_ptr<Tensor32f> > data;
+            size_t c, h, w;
+
+            Net(SimdTensorFormatType f, size_t c_, size_t h_, size_t w_) : format(f), c(c_), h(h_), w(w_) {}
+
+            const float * Random(size_t size, float lo = -1.0f, float hi = 1.0f)
+            {
+                data.push_back(std::make_shared<Tensor32f>(Shp(size)));
+                FillRandom(data.back()->Data(), size, lo, hi);
+                return data.back()->Data();
+            }
+
+            const float * Value(const std::vector<float> & values)
+            {
+                data.push_back(std::make_shared<Tensor32f>(Shp(values.size())));
+                memcpy(data.back()->Data(), values.data(), values.size() * sizeof(float));
+                return data.back()->Data();
+            }
+
+            void Conv(size_t dstC, size_t kernel, size_t stride, size_t group, SimdConvolutionActivationType activation, size_t src = -1)
+            {
+                SimdConvolutionParameters p;
+                p.srcC = c, p.srcH = h, p.srcW = w;
+                p.dstC = dstC;
+                p.kernelY = kernel, p.kernelX = kernel;
+                p.dilationY = 1, p.dilationX = 1;
+                p.strideY = stride, p.strideX = stride;
+                p.padY = (kernel - 1) / 2, p.padX = (kernel - 1) / 2, p.padH = (kernel - 1) / 2, p.padW = (kernel - 1) / 2;
+                p.group = group;
+                p.activation = activation;
+                p.dstH = (h + p.padY + p.padH - kernel) / stride + 1;
+                p.dstW = (w + p.padX + p.padW - kernel) / stride + 1;
+                p.srcT = SimdTensorData32f, p.dstT = SimdTensorData32f;
+                p.srcF = format, p.dstF = format;
+                const float * weight = Random(kernel * kernel * c / group * dstC);
+                const float * bias = Random(dstC);
+                const float * params = activation == SimdConvolutionActivationHswish ? Value({ 3.0f, 1.0f / 6.0f }) : Random(Simd::Max<size_t>(dstC, 2), 0.0f, 0.5f);
+                layers.push_back(Simd::SynetLayer::Convolution(p, weight, bias, params, src));
+                c = p.dstC, h = p.dstH, w = p.dstW;
+            }
+        };
+
+        Net MobileNetBlock(SimdTensorFormatType format)
+        {
+            Net n(format, 16, 18, 21);
+            n.Conv(48, 1, 1, 1, SimdConvolutionActivationRelu);
+            n.Conv(48, 3, 1, 48, SimdConvolutionActivationRelu);
+            n.Conv(16, 1, 1, 1, SimdConvolutionActivationIdentity);
+            n.layers.push_back(Simd::SynetLayer::Eltwise(SimdSynetEltwiseOperationSum, { 3, 0 }));
+            n.layers.push_back(Simd::SynetLayer::Activation(SimdConvolutionActivationRelu));
+            n.layers.push_back(Simd::SynetLayer::Scale(n.Random(n.c), n.Random(n.c)));
+            n.layers.push_back(Simd::SynetLayer::Activation(SimdConvolutionActivationLeakyRelu, n.Value({ 0.1f })));
+            n.Conv(24, 3, 1, 1, SimdConvolutionActivationIdentity);
+            n.layers.push_back(Simd::SynetLayer::Activation(SimdConvolutionActivationHswish, n.Value({ 3.0f, 1.0f / 6.0f })));
+            n.layers.push_back(Simd::SynetLayer::Pooling(true, 2, 2));
+            n.layers.push_back(Simd::SynetLayer::Softmax());
+            return n;
+        }
+    }
+
+    bool SynetNetworkAutoTest(float eps, const Net & n)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::SynetNetwork [" << (n.format == SimdTensorFormatNhwc ? "NHWC" : "NCHW") << "].");
+
+        const size_t batch = 2;
+        Tensor32f src(Shp(batch, n.layers[0].conv.srcC, n.layers[0].conv.srcH, n.layers[0].conv.srcW));
+        FillRandom(src.Data(), src.Size(), -1.0f, 1.0f);
+
+        Simd::SynetNetwork fused, plain;
+        if (!fused.Init(batch, src.Axis(1), src.Axis(2), src.Axis(3), n.format, n.layers, true) ||
+            !plain.Init(batch, src.Axis(1), src.Axis(2), src.Axis(3), n.format, n.layers, false))
+        {
+            TEST_LOG_SS(Error, "Can't initialize Simd::SynetNetwork!");
+            return false;
+        }
+        if (fused.StageNumber() >= plain.StageNumber())
+        {
+            TEST_LOG_SS(Error, "Layers are not fused: " << fused.StageNumber() << " stages instead of " << plain.StageNumber() << " !");
+            result = false;
+        }
+
+        Tensor32f dst1(Shp(fused.DstSize()), SimdTensorFormatUnknown, 1.0f);
+        Tensor32f dst2(Shp(plain.DstSize()), SimdTensorFormatUnknown, 2.0f);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(fused.Forward(src.Data(), dst1.Data()));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(plain.Forward(src.Data(), dst2.Data()));
+
+        result = result && Compare(dst1, dst2, eps, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetNetworkAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetNetworkAutoTest(EPS, MobileNetBlock(SimdTensorFormatNhwc));
+        result = result && SynetNetworkAutoTest(EPS, MobileNetBlock(SimdTensorFormatNchw));
+
+        return result;
+    }
+}
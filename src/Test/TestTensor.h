@@ -334,6 +334,7 @@ namespace Test
 
     typedef Tensor<float> Tensor32f;
     typedef Tensor<uint8_t> Tensor8u;
+    typedef Tensor<uint16_t> Tensor16u;
 
     //-------------------------------------------------------------------------
 
@@ -0,0 +1,214 @@
+/*
+* Tests for Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2018 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncT
+        {
+            typedef void(*FuncPtr)(const View & src, View & dst);
+
+            FuncPtr func;
+            String description;
+            View::Format srcFormat, dstFormat;
+
+            FuncT(const FuncPtr & f, const String & d, View::Format sf, View::Format df) : func(f), description(d), srcFormat(sf), dstFormat(df) {}
+
+            void Call(const View & src, View & dst, size_t threads, size_t threshold) const
+            {
+                size_t threadsOld = SimdGetThreadNumber(), thresholdOld = SimdGetThreadThreshold();
+                SimdSetThreadNumber(threads);
+                SimdSetThreadThreshold(threshold);
+                func(src, dst);
+                SimdSetThreadNumber(threadsOld);
+                SimdSetThreadThreshold(thresholdOld);
+            }
+        };
+
+        void BgrToGray(const View & src, View & dst)
+        {
+            SimdBgrToGray(src.data, src.width, src.height, src.stride, dst.data, dst.stride);
+        }
+
+        void BgraToGray(const View & src, View & dst)
+        {
+            SimdBgraToGray(src.data, src.width, src.height, src.stride, dst.data, dst.stride);
+        }
+
+        void BayerToBgr(const View & src, View & dst)
+        {
+            SimdBayerToBgr(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, dst.data, dst.stride);
+        }
+
+        void BayerToBgra(const View & src, View & dst)
+        {
+            SimdBayerToBgra(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, dst.data, dst.stride, 0xFF);
+        }
+
+        void GaussianBlur3x3(const View & src, View & dst)
+        {
+            SimdGaussianBlur3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+        }
+
+        void MedianFilterSquare3x3(const View & src, View & dst)
+        {
+            SimdMedianFilterSquare3x3(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+        }
+
+        void MedianFilterSquare5x5(const View & src, View & dst)
+        {
+            SimdMedianFilterSquare5x5(src.data, src.stride, src.width, src.height, src.ChannelCount(), dst.data, dst.stride);
+        }
+
+        void SobelDx(const View & src, View & dst)
+        {
+            SimdSobelDx(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+        }
+
+        void SobelDy(const View & src, View & dst)
+        {
+            SimdSobelDy(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
+        }
+    }
+
+#define FUNC_T(function, src, dst) \
+    FuncT(function, std::string(#function), View::src, View::dst)
+
+    bool ThreadThresholdAutoTest(int width, int height, size_t threads, const FuncT & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " in 1 and " << threads << " threads for size [" << width << ", " << height << "].");
+
+        View src(width, height, f.srcFormat, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, f.dstFormat, NULL, TEST_ALIGN(width));
+        View dst2(width, height, f.dstFormat, NULL, TEST_ALIGN(width));
+        Simd::Fill(dst1, 1);
+        Simd::Fill(dst2, 2);
+
+        f.Call(src, dst1, 1, SimdGetThreadThreshold());
+
+        f.Call(src, dst2, threads, 0);
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ThreadThresholdAutoTest(const FuncT & f)
+    {
+        bool result = true;
+
+        result = result && ThreadThresholdAutoTest(W, H, 4, f);
+        result = result && ThreadThresholdAutoTest(W + E, H - O + 1, 3, f);
+
+        return result;
+    }
+
+    bool ThreadThresholdAutoTest()
+    {
+        bool result = true;
+
+        result = result && ThreadThresholdAutoTest(FUNC_T(BgrToGray, Bgr24, Gray8));
+        result = result && ThreadThresholdAutoTest(FUNC_T(BgraToGray, Bgra32, Gray8));
+        result = result && ThreadThresholdAutoTest(FUNC_T(BayerToBgr, BayerGrbg, Bgr24));
+        result = result && ThreadThresholdAutoTest(FUNC_T(BayerToBgra, BayerBggr, Bgra32));
+        result = result && ThreadThresholdAutoTest(FUNC_T(GaussianBlur3x3, Bgr24, Bgr24));
+        result = result && ThreadThresholdAutoTest(FUNC_T(MedianFilterSquare3x3, Gray8, Gray8));
+        result = result && ThreadThresholdAutoTest(FUNC_T(MedianFilterSquare5x5, Bgra32, Bgra32));
+        result = result && ThreadThresholdAutoTest(FUNC_T(SobelDx, Gray8, Int16));
+        result = result && ThreadThresholdAutoTest(FUNC_T(SobelDy, Gray8, Int16));
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    bool ThreadAffinityAutoTest()
+    {
+        bool result = true;
+
+        std::vector<size_t> cpus;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (::sched_getaffinity(0, sizeof(set), &set) == 0)
+        {
+            for (size_t i = 0; i < CPU_SETSIZE; ++i)
+                if (CPU_ISSET(i, &set))
+                    cpus.push_back(i);
+        }
+#elif defined(_MSC_VER)
+        cpus.push_back(0);
+#endif
+        if (cpus.size())
+        {
+            TEST_LOG_SS(Info, "Test SimdSetThreadAffinity for " << cpus.size() << " allowed CPUs.");
+
+            if (SimdSetThreadAffinity(cpus.data(), cpus.size()) != SimdTrue)
+            {
+                TEST_LOG_SS(Error, "SimdSetThreadAffinity rejects allowed CPUs!");
+                result = false;
+            }
+            result = result && ThreadThresholdAutoTest(W, H, 4, FUNC_T(BgrToGray, Bgr24, Gray8));
+
+            if (result && SimdSetThreadAffinity(cpus.data() + cpus.size() - 1, 1) != SimdTrue)
+            {
+                TEST_LOG_SS(Error, "SimdSetThreadAffinity rejects allowed CPU " << cpus.back() << "!");
+                result = false;
+            }
+            result = result && ThreadThresholdAutoTest(W, H, 3, FUNC_T(GaussianBlur3x3, Bgr24, Bgr24));
+        }
+
+        size_t wrong[2] = { 0, size_t(1) << 20 };
+        if (result && SimdSetThreadAffinity(wrong, 2) != SimdFalse)
+        {
+            TEST_LOG_SS(Error, "SimdSetThreadAffinity accepts out-of-range CPU " << wrong[1] << "!");
+            result = false;
+        }
+
+        if (result && SimdSetThreadNumaNode(size_t(1) << 20) != SimdFalse)
+        {
+            TEST_LOG_SS(Error, "SimdSetThreadNumaNode accepts not existed NUMA node!");
+            result = false;
+        }
+
+        if (SimdSetThreadAffinity(NULL, 0) != SimdTrue)
+        {
+            TEST_LOG_SS(Error, "SimdSetThreadAffinity can't reset the binding!");
+            result = false;
+        }
+
+        return result;
+    }
+}
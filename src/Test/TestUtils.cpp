@@ -942,4 +942,29 @@ namespace Test
         }
         return true;
     }
+
+    String TempPath(const String & name)
+    {
+#ifdef WIN32
+        char buffer[MAX_PATH + 1];
+        DWORD size = ::GetTempPathA(MAX_PATH + 1, buffer);
+        String directory = size ? String(buffer, size) : String(".\\");
+        if (directory.back() != '\\')
+            directory += '\\';
+        size_t pid = ::GetCurrentProcessId();
+#else
+        const char * tmpdir = std::getenv("TMPDIR");
+        String directory = tmpdir && tmpdir[0] ? tmpdir : "/tmp";
+        if (directory.back() != '/')
+            directory += '/';
+#if defined(__linux__)
+        size_t pid = ::getpid();
+#else
+        size_t pid = 0;
+#endif
+#endif
+        std::stringstream ss;
+        ss << directory << pid << "_" << name;
+        return ss.str();
+    }
 }
@@ -206,6 +206,7 @@ namespace Test
     String DirectoryByPath(const String & path);
     bool CreatePath(const String & path);
     bool CreatePathIfNotExist(const String & path);
+    String TempPath(const String & name);
 }
 
 #define TEST_CHECK_VALUE(name) \
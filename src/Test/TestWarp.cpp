@@ -0,0 +1,166 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2020 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdWarp.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncWP
+        {
+            typedef void*(*FuncPtr)(size_t srcW, size_t srcH, size_t dstW, size_t dstH, size_t channels, const float * mat, SimdWarpFlags flags, const uint8_t * border);
+
+            FuncPtr func;
+            String desc;
+
+            FuncWP(const FuncPtr & f, const String & d) : func(f), desc(d) {}
+
+            void Update(size_t channels, SimdWarpFlags flags)
+            {
+                std::stringstream ss;
+                ss << desc << "[" << channels << "-";
+                ss << ((flags & SimdWarpInterpMask) == SimdWarpInterpNearest ? "N" : "B") << "-";
+                switch (flags & SimdWarpBorderMask)
+                {
+                case SimdWarpBorderConstant: ss << "C"; break;
+                case SimdWarpBorderTransparent: ss << "T"; break;
+                case SimdWarpBorderReplicate: ss << "R"; break;
+                default:
+                    assert(0);
+                }
+                ss << "]";
+                desc = ss.str();
+            }
+
+            void Call(const View & src, const float * mat, SimdWarpFlags flags, const uint8_t * border, View & dst) const
+            {
+                void * context = func(src.width, src.height, dst.width, dst.height, src.ChannelCount(), mat, flags, border);
+                {
+                    TEST_PERFORMANCE_TEST(desc);
+                    ((Simd::Warp*)context)->Run(src.data, src.stride, dst.data, dst.stride);
+                }
+                SimdRelease(context);
+            }
+        };
+    }
+
+#define FUNC_WP(function) \
+    FuncWP(function, std::string(#function))
+
+    bool WarpAutoTest(View::Format format, int width, int height, const float * mat, SimdWarpFlags flags, FuncWP f1, FuncWP f2)
+    {
+        bool result = true;
+
+        f1.Update(View::PixelSize(format), flags);
+        f2.Update(View::PixelSize(format), flags);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << width << ", " << height << "].");
+
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        const uint8_t border[4] = { 11, 22, 33, 44 };
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+        Simd::Fill(dst1, 0x77);
+        Simd::Fill(dst2, 0x77);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, mat, flags, border, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, mat, flags, border, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool WarpAutoTest(const float * mat, const FuncWP & f1, const FuncWP & f2)
+    {
+        bool result = true;
+
+        View::Format formats[4] = { View::Gray8, View::Uv16, View::Bgr24, View::Bgra32 };
+        for (int f = 0; f < 4; ++f)
+        {
+            for (int interp = SimdWarpInterpNearest; interp <= SimdWarpInterpBilinear; interp++)
+            {
+                for (int border = SimdWarpBorderConstant; border <= SimdWarpBorderReplicate; border += SimdWarpBorderTransparent)
+                {
+                    SimdWarpFlags flags = SimdWarpFlags(interp | border);
+                    result = result && WarpAutoTest(formats[f], W, H, mat, flags, f1, f2);
+                    result = result && WarpAutoTest(formats[f], W + O, H - O, mat, flags, f1, f2);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    bool WarpAffineAutoTest()
+    {
+        bool result = true;
+
+        const float angle = 0.3f;
+        const float mat[6] = { 1.1f * ::cos(angle), -::sin(angle), float(W) * 0.1f, ::sin(angle), 0.9f * ::cos(angle), -float(H) * 0.15f };
+
+        result = result && WarpAutoTest(mat, FUNC_WP(Simd::Base::WarpAffineInit), FUNC_WP(SimdWarpAffineInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpAutoTest(mat, FUNC_WP(Simd::Avx2::WarpAffineInit), FUNC_WP(SimdWarpAffineInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && WarpAutoTest(mat, FUNC_WP(Simd::Avx512bw::WarpAffineInit), FUNC_WP(SimdWarpAffineInit));
+#endif 
+
+        return result;
+    }
+
+    bool WarpPerspectiveAutoTest()
+    {
+        bool result = true;
+
+        const float mat[9] = { 0.9f, 0.1f, float(W) * 0.05f, -0.15f, 1.05f, float(H) * 0.1f, 0.3f / W, 0.2f / H, 1.0f };
+
+        result = result && WarpAutoTest(mat, FUNC_WP(Simd::Base::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && WarpAutoTest(mat, FUNC_WP(Simd::Avx2::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && WarpAutoTest(mat, FUNC_WP(Simd::Avx512bw::WarpPerspectiveInit), FUNC_WP(SimdWarpPerspectiveInit));
+#endif 
+
+        return result;
+    }
+}
@@ -307,6 +307,22 @@ namespace Test
         return result;
     }
 
+    bool WinogradKernel3x3Block6x6SetFilterAutoTest()
+    {
+        bool result = true;
+
+        Size _3x3(3, 3), _6x6(6, 6);
+
+        result = result && WinogradSetFilterAutoTest(_6x6, _3x3, FUNC_WF(Simd::Base::WinogradKernel3x3Block6x6SetFilter), FUNC_WF(SimdWinogradKernel3x3Block6x6SetFilter));
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && WinogradSetFilterAutoTest(_6x6, _3x3, FUNC_WF(Simd::Avx512f::WinogradKernel3x3Block6x6SetFilter), FUNC_WF(SimdWinogradKernel3x3Block6x6SetFilter));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     namespace
@@ -566,7 +582,7 @@ namespace Test
         result = result && WinogradSetInputAutoTest(128, 28, 24, _block, _core, _pad, _pad, trans, f1, f2);
         result = result && WinogradSetInputAutoTest(256, 14, 12, _block, _core, _pad, _pad, trans, f1, f2);
         result = result && WinogradSetInputAutoTest(512, 7, 6, _block, _core, _pad, _pad, trans, f1, f2);
-        if(block == 4 && pad)
+        if(block >= 4 && pad)
         {
             result = result && WinogradSetInputAutoTest(64, 40, 159, _block, _core, _pad, Size(1, 0), trans, f1, f2);
             result = result && WinogradSetInputAutoTest(64, 41, 159, _block, _core, Size(1, 0), _pad, trans, f1, f2);
@@ -674,6 +690,20 @@ namespace Test
         return result;
     }
 
+    bool WinogradKernel3x3Block6x6SetInputAutoTest()
+    {
+        bool result = true;
+
+        result = result && WinogradKernel3x3SetInputAutoTest(6, FUNC_WI(Simd::Base::WinogradKernel3x3Block6x6SetInput), FUNC_WI(SimdWinogradKernel3x3Block6x6SetInput));
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && WinogradKernel3x3SetInputAutoTest(6, FUNC_WI(Simd::Avx512f::WinogradKernel3x3Block6x6SetInput), FUNC_WI(SimdWinogradKernel3x3Block6x6SetInput));
+#endif 
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     namespace
@@ -1022,6 +1052,20 @@ namespace Test
         return result;
     }
 
+    bool WinogradKernel3x3Block6x6SetOutputAutoTest()
+    {
+        bool result = true;
+
+        result = result && WinogradKernel3x3SetOutputAutoTest(6, FUNC_WO(Simd::Base::WinogradKernel3x3Block6x6SetOutput), FUNC_WO(SimdWinogradKernel3x3Block6x6SetOutput));
+
+#ifdef SIMD_AVX512F_ENABLE
+        if (Simd::Avx512f::Enable)
+            result = result && WinogradKernel3x3SetOutputAutoTest(6, FUNC_WO(Simd::Avx512f::WinogradKernel3x3Block6x6SetOutput), FUNC_WO(SimdWinogradKernel3x3Block6x6SetOutput));
+#endif
+
+        return result;
+    }
+
     //-----------------------------------------------------------------------
 
     void ImgToCol(const float * src, size_t srcC, size_t srcH, size_t srcW, const Size& core, const Size& padB, const Size& padE, float * dst)
@@ -1313,4 +1357,9 @@ namespace Test
     {
         return WinogradKernel3x3SpecialTest(4, FUNC_WF(SimdWinogradKernel3x3Block4x4SetFilter), FUNC_WI(SimdWinogradKernel3x3Block4x4SetInput), FUNC_WO(SimdWinogradKernel3x3Block4x4SetOutput));
     }
+
+    bool WinogradKernel3x3Block6x6SpecialTest()
+    {
+        return WinogradKernel3x3SpecialTest(6, FUNC_WF(SimdWinogradKernel3x3Block6x6SetFilter), FUNC_WI(SimdWinogradKernel3x3Block6x6SetInput), FUNC_WO(SimdWinogradKernel3x3Block6x6SetOutput));
+    }
 }
@@ -371,6 +371,343 @@ namespace Test
 
     //-----------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncV2
+        {
+            typedef void(*Yuv420pPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
+            typedef void(*Yuv420pAlphaPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+            typedef void(*NvPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdYuvType yuvType);
+            typedef void(*NvAlphaPtr)(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride,
+                size_t width, size_t height, uint8_t * dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+
+            Yuv420pPtr yuv420p;
+            Yuv420pAlphaPtr yuv420pAlpha;
+            NvPtr nv;
+            NvAlphaPtr nvAlpha;
+            String description;
+
+            FuncV2(const Yuv420pPtr & f, const String & d) : yuv420p(f), yuv420pAlpha(NULL), nv(NULL), nvAlpha(NULL), description(d) {}
+            FuncV2(const Yuv420pAlphaPtr & f, const String & d) : yuv420p(NULL), yuv420pAlpha(f), nv(NULL), nvAlpha(NULL), description(d) {}
+            FuncV2(const NvPtr & f, const String & d) : yuv420p(NULL), yuv420pAlpha(NULL), nv(f), nvAlpha(NULL), description(d) {}
+            FuncV2(const NvAlphaPtr & f, const String & d) : yuv420p(NULL), yuv420pAlpha(NULL), nv(NULL), nvAlpha(f), description(d) {}
+
+            bool Interleaved() const { return nv || nvAlpha; }
+
+            void Call(const View & y, const View & u, const View & v, const View & uv, View & dst, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                const uint8_t alpha = 0x7F;
+                if (yuv420p)
+                    yuv420p(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+                if (yuv420pAlpha)
+                    yuv420pAlpha(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride, alpha, yuvType);
+                if (nv)
+                    nv(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+                if (nvAlpha)
+                    nvAlpha(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, alpha, yuvType);
+            }
+        };
+    }
+
+#define FUNC_V2(function) FuncV2(function, #function)
+
+    bool YuvToAnyV2AutoTest(int width, int height, View::Format dstType, const FuncV2 & f1, const FuncV2 & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u, v, uv;
+        if (f1.Interleaved())
+        {
+            uv.Recreate(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+            FillRandom(uv);
+        }
+        else
+        {
+            u.Recreate(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width / 2));
+            FillRandom(u);
+            v.Recreate(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width / 2));
+            FillRandom(v);
+        }
+
+        View dst1(width, height, dstType, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstType, NULL, TEST_ALIGN(width));
+
+        for (int type = SimdYuvBt601; type <= SimdYuvBt2020Full && result; ++type)
+        {
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, uv, dst1, (SimdYuvType)type));
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, uv, dst2, (SimdYuvType)type));
+
+            result = result && Compare(dst1, dst2, 0, true, 64, 255);
+        }
+
+        return result;
+    }
+
+    bool YuvToAnyV2AutoTest(View::Format dstType, const FuncV2 & f1, const FuncV2 & f2)
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(W, H, dstType, f1, f2);
+        result = result && YuvToAnyV2AutoTest(W + O * 2, H - O * 2, dstType, f1, f2);
+        result = result && YuvToAnyV2AutoTest(W - O * 2, H + O * 2, dstType, f1, f2);
+
+        return result;
+    }
+
+    bool Yuv420pToBgrV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(View::Bgr24, FUNC_V2(Simd::Base::Yuv420pToBgrV2), FUNC_V2(SimdYuv420pToBgrV2));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && YuvToAnyV2AutoTest(View::Bgr24, FUNC_V2(Simd::Avx2::Yuv420pToBgrV2), FUNC_V2(SimdYuv420pToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToBgraV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(View::Bgra32, FUNC_V2(Simd::Base::Yuv420pToBgraV2), FUNC_V2(SimdYuv420pToBgraV2));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && YuvToAnyV2AutoTest(View::Bgra32, FUNC_V2(Simd::Avx2::Yuv420pToBgraV2), FUNC_V2(SimdYuv420pToBgraV2));
+#endif 
+
+        return result;
+    }
+
+    bool Yuv420pToRgbV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(View::Rgb24, FUNC_V2(Simd::Base::Yuv420pToRgbV2), FUNC_V2(SimdYuv420pToRgbV2));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && YuvToAnyV2AutoTest(View::Rgb24, FUNC_V2(Simd::Avx2::Yuv420pToRgbV2), FUNC_V2(SimdYuv420pToRgbV2));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(View::Bgr24, FUNC_V2(Simd::Base::Nv12ToBgr), FUNC_V2(SimdNv12ToBgr));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && YuvToAnyV2AutoTest(View::Bgr24, FUNC_V2(Simd::Avx2::Nv12ToBgr), FUNC_V2(SimdNv12ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(View::Bgra32, FUNC_V2(Simd::Base::Nv12ToBgra), FUNC_V2(SimdNv12ToBgra));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && YuvToAnyV2AutoTest(View::Bgra32, FUNC_V2(Simd::Avx2::Nv12ToBgra), FUNC_V2(SimdNv12ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(View::Rgb24, FUNC_V2(Simd::Base::Nv12ToRgb), FUNC_V2(SimdNv12ToRgb));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && YuvToAnyV2AutoTest(View::Rgb24, FUNC_V2(Simd::Avx2::Nv12ToRgb), FUNC_V2(SimdNv12ToRgb));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(View::Bgr24, FUNC_V2(Simd::Base::Nv21ToBgr), FUNC_V2(SimdNv21ToBgr));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && YuvToAnyV2AutoTest(View::Bgr24, FUNC_V2(Simd::Avx2::Nv21ToBgr), FUNC_V2(SimdNv21ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(View::Bgra32, FUNC_V2(Simd::Base::Nv21ToBgra), FUNC_V2(SimdNv21ToBgra));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && YuvToAnyV2AutoTest(View::Bgra32, FUNC_V2(Simd::Avx2::Nv21ToBgra), FUNC_V2(SimdNv21ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Nv21ToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvToAnyV2AutoTest(View::Rgb24, FUNC_V2(Simd::Base::Nv21ToRgb), FUNC_V2(SimdNv21ToRgb));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && YuvToAnyV2AutoTest(View::Rgb24, FUNC_V2(Simd::Avx2::Nv21ToRgb), FUNC_V2(SimdNv21ToRgb));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
+    namespace
+    {
+        struct YuvReference
+        {
+            SimdYuvType type;
+            uint8_t red, green, blue, y, u, v;
+        };
+
+        // Values are computed in floating point with ITU-R BT.601 and BT.709 equations and rounded to nearest.
+        const YuvReference YUV_REFERENCES[] =
+        {
+            { SimdYuvBt601,   0,   0,   0,  16, 128, 128 },
+            { SimdYuvBt601, 255, 255, 255, 235, 128, 128 },
+            { SimdYuvBt601, 255,   0,   0,  81,  90, 240 },
+            { SimdYuvBt601,   0, 255,   0, 145,  54,  34 },
+            { SimdYuvBt601,   0,   0, 255,  41, 240, 110 },
+            { SimdYuvBt601, 128, 128, 128, 126, 128, 128 },
+            { SimdYuvBt601, 200, 100,  50, 123,  91, 175 },
+            { SimdYuvBt601Full,   0,   0,   0,   0, 128, 128 },
+            { SimdYuvBt601Full, 255, 255, 255, 255, 128, 128 },
+            { SimdYuvBt601Full, 255,   0,   0,  76,  85, 255 },
+            { SimdYuvBt601Full,   0, 255,   0, 150,  44,  21 },
+            { SimdYuvBt601Full,   0,   0, 255,  29, 255, 107 },
+            { SimdYuvBt601Full, 128, 128, 128, 128, 128, 128 },
+            { SimdYuvBt601Full, 200, 100,  50, 124,  86, 182 },
+            { SimdYuvBt709,   0,   0,   0,  16, 128, 128 },
+            { SimdYuvBt709, 255, 255, 255, 235, 128, 128 },
+            { SimdYuvBt709, 255,   0,   0,  63, 102, 240 },
+            { SimdYuvBt709,   0, 255,   0, 173,  42,  26 },
+            { SimdYuvBt709,   0,   0, 255,  32, 240, 118 },
+            { SimdYuvBt709, 128, 128, 128, 126, 128, 128 },
+            { SimdYuvBt709, 200, 100,  50, 117,  96, 174 },
+            { SimdYuvBt709Full,   0,   0,   0,   0, 128, 128 },
+            { SimdYuvBt709Full, 255, 255, 255, 255, 128, 128 },
+            { SimdYuvBt709Full, 255,   0,   0,  54,  99, 255 },
+            { SimdYuvBt709Full,   0, 255,   0, 182,  30,  12 },
+            { SimdYuvBt709Full,   0,   0, 255,  18, 255, 116 },
+            { SimdYuvBt709Full, 128, 128, 128, 128, 128, 128 },
+            { SimdYuvBt709Full, 200, 100,  50, 118,  92, 180 },
+        };
+
+        bool CheckUniform(const View & view, const uint8_t * value, size_t channels, int differenceMax, const String & desc)
+        {
+            for (size_t row = 0; row < view.height; ++row)
+            {
+                const uint8_t * p = view.Row<uint8_t>(row);
+                for (size_t col = 0; col < view.width; ++col, p += channels)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        if (Simd::Abs(int(p[c]) - int(value[c])) > differenceMax)
+                        {
+                            TEST_LOG_SS(Error, desc << ": value " << int(p[c]) << " at [" << col << ", " << row << ", " << c << "] instead of " << int(value[c]) << " !");
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+    }
+
+    typedef void(*BgrToYuv420pV2Ptr)(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, 
+        uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride, SimdYuvType yuvType);
+
+    bool YuvV2ReferenceAutoTest(int width, int height, BgrToYuv420pV2Ptr bgrToYuv, const String & bgrToYuvDesc, const FuncV2 & yuvToBgr)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << bgrToYuvDesc << " & " << yuvToBgr.description << " with reference values [" << width << ", " << height << "].");
+
+        View bgr(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width / 2));
+        View v(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width / 2));
+        View uv;
+
+        const char * names[] = { "Bt601", "Bt709", "Bt2020", "Bt601Full", "Bt709Full", "Bt2020Full" };
+        for (size_t i = 0; i < sizeof(YUV_REFERENCES) / sizeof(YUV_REFERENCES[0]) && result; ++i)
+        {
+            const YuvReference & r = YUV_REFERENCES[i];
+            std::stringstream color;
+            color << names[r.type] << " {" << int(r.red) << ", " << int(r.green) << ", " << int(r.blue) << "}";
+
+            Simd::FillPixel(bgr, Simd::Pixel::Bgr24(r.blue, r.green, r.red));
+            bgrToYuv(bgr.data, width, height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride, r.type);
+            result = result && CheckUniform(y, &r.y, 1, 1, bgrToYuvDesc + " Y of " + color.str());
+            result = result && CheckUniform(u, &r.u, 1, 1, bgrToYuvDesc + " U of " + color.str());
+            result = result && CheckUniform(v, &r.v, 1, 1, bgrToYuvDesc + " V of " + color.str());
+
+            const uint8_t bgrRef[3] = { r.blue, r.green, r.red };
+            Simd::Fill(y, r.y);
+            Simd::Fill(u, r.u);
+            Simd::Fill(v, r.v);
+            yuvToBgr.Call(y, u, v, uv, bgr, r.type);
+            result = result && CheckUniform(bgr, bgrRef, 3, 2, yuvToBgr.description + " of " + color.str());
+        }
+
+        return result;
+    }
+
+    bool YuvV2ReferenceAutoTest()
+    {
+        bool result = true;
+
+        result = result && YuvV2ReferenceAutoTest(W, H, Simd::Base::BgrToYuv420pV2, "Simd::Base::BgrToYuv420pV2", FUNC_V2(Simd::Base::Yuv420pToBgrV2));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::DA)
+            result = result && YuvV2ReferenceAutoTest(W, H, Simd::Avx2::BgrToYuv420pV2, "Simd::Avx2::BgrToYuv420pV2", FUNC_V2(Simd::Avx2::Yuv420pToBgrV2));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------
+
     bool YuvToAnyDataTest(bool create, int width, int height, int dx, int dy, View::Format dstType, const Func & f, int maxDifference = 0)
     {
         bool result = true;